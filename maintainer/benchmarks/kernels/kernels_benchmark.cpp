@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** \file
+ *  Micro-benchmarks for the short-range pair kernels and the cell
+ *  traversal, below the script interface and below MPI. The Python
+ *  benchmarks in maintainer/benchmarks measure whole time steps, which
+ *  hides kernel-level regressions behind integrator and script
+ *  overhead; this driver times the kernels on synthetic configurations
+ *  and emits one JSON object per benchmark on stdout, so CI can track
+ *  them per kernel. The harness is deliberately self-contained (best
+ *  wall-clock time of a few repetitions) instead of pulling in a
+ *  benchmark framework dependency.
+ */
+
+#include "config/config.hpp"
+
+#include "Particle.hpp"
+#include "algorithm/link_cell.hpp"
+#include "cell_system/Cell.hpp"
+#include "nonbonded_interactions/lj.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+
+#include <utils/Span.hpp>
+#include <utils/Vector.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+/** Accumulator the kernels write into, so the optimizer cannot discard
+ *  the benchmarked work. Printed (as a comment field) at the end.
+ */
+static double sink = 0.;
+
+/** Time a kernel and report it.
+ *  The kernel is run once for warm-up, then @p n_reps times; the best
+ *  repetition is reported, normalized per item.
+ *  @param name    benchmark name for the JSON record
+ *  @param n_items number of kernel-level operations per repetition
+ *  @param kernel  callable performing one repetition
+ */
+template <class Kernel>
+static void benchmark(char const *name, std::size_t n_items, Kernel kernel) {
+  using clock = std::chrono::steady_clock;
+  constexpr int n_reps = 5;
+
+  kernel();
+  auto best = std::chrono::nanoseconds::max();
+  for (int rep = 0; rep < n_reps; ++rep) {
+    auto const start = clock::now();
+    kernel();
+    auto const elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                             start);
+    best = std::min(best, elapsed);
+  }
+
+  auto const ns_per_item =
+      static_cast<double>(best.count()) / static_cast<double>(n_items);
+  std::printf("{\"name\": \"%s\", \"items_per_rep\": %zu, \"reps\": %i, "
+              "\"ns_per_item\": %.4f, \"items_per_second\": %.3e}\n",
+              name, n_items, n_reps, ns_per_item, 1e9 / ns_per_item);
+}
+
+/** Synthetic homogeneous configuration on a half-shell cell grid. */
+struct Configuration {
+  std::vector<Cell> cells;
+  double box_l;
+  double cutoff;
+  std::size_t n_part;
+
+  /** Build an @p n_cells_per_dim cubic cell grid with cells of edge
+   *  @p cell_size holding @p n_part_per_cell randomly placed particles
+   *  each. The red neighbor lists contain the forward half of the 26
+   *  neighbors (no periodic wrap), matching the pair coverage of the
+   *  regular decomposition away from the boundary.
+   */
+  Configuration(int n_cells_per_dim, double cell_size, int n_part_per_cell)
+      : cells(static_cast<std::size_t>(Utils::int_pow<3>(n_cells_per_dim))),
+        box_l(n_cells_per_dim * cell_size), cutoff(cell_size),
+        n_part(cells.size() * static_cast<std::size_t>(n_part_per_cell)) {
+    auto const linear_index = [n_cells_per_dim](int i, int j, int k) {
+      return (i * n_cells_per_dim + j) * n_cells_per_dim + k;
+    };
+
+    std::mt19937 rng(42u);
+    std::uniform_real_distribution<double> dist(0., cell_size);
+
+    auto id = 0;
+    for (int i = 0; i < n_cells_per_dim; ++i)
+      for (int j = 0; j < n_cells_per_dim; ++j)
+        for (int k = 0; k < n_cells_per_dim; ++k) {
+          auto &cell = cells[static_cast<std::size_t>(linear_index(i, j, k))];
+          cell.particles().resize(static_cast<std::size_t>(n_part_per_cell));
+          for (auto &p : cell.particles()) {
+            p.id() = id++;
+            p.pos() = {i * cell_size + dist(rng), j * cell_size + dist(rng),
+                       k * cell_size + dist(rng)};
+          }
+
+          std::vector<Cell *> red_neighbors;
+          for (int di = -1; di <= 1; ++di)
+            for (int dj = -1; dj <= 1; ++dj)
+              for (int dk = -1; dk <= 1; ++dk) {
+                auto const ni = i + di, nj = j + dj, nk = k + dk;
+                if (ni < 0 or nj < 0 or nk < 0 or ni >= n_cells_per_dim or
+                    nj >= n_cells_per_dim or nk >= n_cells_per_dim)
+                  continue;
+                if (linear_index(ni, nj, nk) > linear_index(i, j, k))
+                  red_neighbors.push_back(
+                      &cells[static_cast<std::size_t>(
+                          linear_index(ni, nj, nk))]);
+              }
+          cell.m_neighbors =
+              Neighbors<Cell *>(Utils::make_const_span(red_neighbors), {});
+        }
+  }
+
+  /** Number of pairs one link-cell sweep visits. */
+  std::size_t count_pairs() {
+    std::size_t n_pairs = 0ul;
+    Algorithm::link_cell(cells.begin(), cells.end(),
+                         [&n_pairs](Particle const &, Particle const &) {
+                           ++n_pairs;
+                         });
+    return n_pairs;
+  }
+};
+
+int main() {
+  /* 6^3 cells at 10 particles each, the density regime of the lj.py
+   * benchmark at volume fraction 0.5 */
+  auto const cell_size = 1.3;
+  Configuration config(6, cell_size, 10);
+  auto const n_pairs = config.count_pairs();
+  auto const cutoff2 = config.cutoff * config.cutoff;
+
+#ifdef LENNARD_JONES
+  auto const ia_params = []() {
+    IA_parameters ia{};
+    ia.lj = LJ_Parameters{1., 1., 1.3, 0., 0., 0.};
+    return ia;
+  }();
+
+  /* Pair kernel in isolation, on distances drawn like the pair
+   * distances below, without the traversal around it. */
+  {
+    std::mt19937 rng(43u);
+    std::uniform_real_distribution<double> dist(0.8, 1.5);
+    std::vector<double> distances(1000000u);
+    for (auto &d : distances)
+      d = dist(rng);
+
+    benchmark("lj_pair_force_factor", distances.size(),
+              [&ia_params, &distances]() {
+                auto acc = 0.;
+                for (auto const d : distances)
+                  acc += lj_pair_force_factor(ia_params, d);
+                sink += acc;
+              });
+  }
+#endif // LENNARD_JONES
+
+  /* Cell traversal with the cheapest possible kernel: the cost of
+   * visiting a candidate pair. */
+  benchmark("link_cell_traversal", n_pairs, [&config]() {
+    auto acc = 0.;
+    Algorithm::link_cell(config.cells.begin(), config.cells.end(),
+                         [&acc](Particle const &p1, Particle const &p2) {
+                           acc += (p1.pos() - p2.pos()).norm2();
+                         });
+    sink += acc;
+  });
+
+  /* Pair list construction: traversal plus cutoff check plus append,
+   * the per-rebuild cost of the Verlet list scheme. */
+  std::vector<std::pair<Particle const *, Particle const *>> pair_list;
+  pair_list.reserve(n_pairs);
+  benchmark("pair_list_build", n_pairs, [&config, &pair_list, cutoff2]() {
+    pair_list.clear();
+    Algorithm::link_cell(config.cells.begin(), config.cells.end(),
+                         [&pair_list, cutoff2](Particle const &p1,
+                                               Particle const &p2) {
+                           if ((p1.pos() - p2.pos()).norm2() < cutoff2)
+                             pair_list.emplace_back(&p1, &p2);
+                         });
+    sink += static_cast<double>(pair_list.size());
+  });
+
+#ifdef LENNARD_JONES
+  /* Force sweep over the built pair list, the steady-state cost
+   * between rebuilds. */
+  benchmark("pair_list_force_sweep", pair_list.size(),
+            [&ia_params, &pair_list]() {
+              auto acc = 0.;
+              for (auto const &[p1, p2] : pair_list) {
+                auto const d = (p1->pos() - p2->pos()).norm();
+                acc += lj_pair_force_factor(ia_params, d);
+              }
+              sink += acc;
+            });
+#endif // LENNARD_JONES
+
+  std::printf("{\"name\": \"checksum\", \"value\": %.6e}\n", sink);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** \file
+ *  Headless Lennard-Jones fluid scenario for scaling studies.
+ *  This driver runs the integration loop of the core directly, like
+ *  EspressoSystemStandAlone_test.cpp, so the measured step rate
+ *  contains no Python or script interface overhead. The scenario
+ *  mirrors the lj.py Python benchmark (homogeneous LJ fluid at a given
+ *  density), which makes the pair of numbers directly comparable: the
+ *  difference between the two is the cost of the scripting layers.
+ *  All options are plain command line flags; rank 0 prints one JSON
+ *  record with the step timings.
+ */
+
+#include "EspressoSystemStandAlone.hpp"
+#include "Particle.hpp"
+#include "event.hpp"
+#include "integrate.hpp"
+#include "nonbonded_interactions/lj.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+#include "particle_node.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <boost/mpi/communicator.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+  int n_part = 8000;
+  double density = 0.5;
+  int n_steps = 100;
+  int n_warmup_steps = 20;
+  double time_step = 0.005;
+  double skin = 0.4;
+};
+
+/** Parse <tt>--name=value</tt> flags; throws on unknown flags so typos
+ *  do not silently run the default scenario.
+ */
+Options parse_options(int argc, char **argv) {
+  Options opts{};
+  for (int i = 1; i < argc; ++i) {
+    auto const arg = std::string(argv[i]);
+    auto const eq = arg.find('=');
+    auto const name = arg.substr(0, eq);
+    if (eq == std::string::npos) {
+      throw std::invalid_argument("Expected --name=value, got '" + arg + "'");
+    }
+    auto const value = arg.substr(eq + 1);
+    if (name == "--particles") {
+      opts.n_part = std::stoi(value);
+    } else if (name == "--density") {
+      opts.density = std::stod(value);
+    } else if (name == "--steps") {
+      opts.n_steps = std::stoi(value);
+    } else if (name == "--warmup_steps") {
+      opts.n_warmup_steps = std::stoi(value);
+    } else if (name == "--time_step") {
+      opts.time_step = std::stod(value);
+    } else if (name == "--skin") {
+      opts.skin = std::stod(value);
+    } else {
+      throw std::invalid_argument("Unknown argument '" + name + "'");
+    }
+  }
+  return opts;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  auto system = std::make_unique<EspressoSystemStandAlone>(argc, argv);
+  auto const comm = boost::mpi::communicator();
+  auto const opts = parse_options(argc, argv);
+
+  auto const box_l = std::cbrt(static_cast<double>(opts.n_part) /
+                               opts.density);
+  system->set_box_l(Utils::Vector3d::broadcast(box_l));
+  system->set_time_step(opts.time_step);
+  system->set_skin(opts.skin);
+
+  /* purely repulsive LJ, the interaction of the lj.py benchmark */
+  make_particle_type_exist(0);
+  auto lj = LJ_Parameters{1., 1., 2.5, 0., 0., 0.};
+  lj.shift = lj.get_auto_shift();
+  ::nonbonded_ia_params[get_ia_param_key(0, 0)]->lj = lj;
+  on_non_bonded_ia_change();
+
+  /* Jittered simple cubic lattice: overlap-free at liquid densities,
+   * with enough asymmetry that the system starts moving. The rng is
+   * seeded identically on every rank, so the collective particle
+   * creation sees consistent positions everywhere. */
+  auto const n_per_dim =
+      static_cast<int>(std::ceil(std::cbrt(static_cast<double>(opts.n_part))));
+  auto const lattice_constant = box_l / n_per_dim;
+  std::mt19937 rng(42u);
+  std::uniform_real_distribution<double> jitter(-0.1 * lattice_constant,
+                                                0.1 * lattice_constant);
+  std::vector<int> p_ids;
+  std::vector<Utils::Vector3d> positions;
+  p_ids.reserve(static_cast<std::size_t>(opts.n_part));
+  positions.reserve(static_cast<std::size_t>(opts.n_part));
+  for (int p_id = 0; p_id < opts.n_part; ++p_id) {
+    auto const i = p_id % n_per_dim;
+    auto const j = (p_id / n_per_dim) % n_per_dim;
+    auto const k = p_id / (n_per_dim * n_per_dim);
+    positions.emplace_back(Utils::Vector3d{i * lattice_constant + jitter(rng),
+                                           j * lattice_constant + jitter(rng),
+                                           k * lattice_constant + jitter(rng)});
+    p_ids.emplace_back(p_id);
+  }
+  make_new_particles(p_ids, positions);
+
+  integrate(opts.n_warmup_steps, 0);
+
+  auto const start = std::chrono::steady_clock::now();
+  integrate(opts.n_steps, 0);
+  auto const elapsed = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+
+  if (comm.rank() == 0) {
+    std::printf("{\"scenario\": \"lj\", \"ranks\": %i, \"particles\": %i, "
+                "\"density\": %g, \"steps\": %i, \"elapsed_s\": %.6f, "
+                "\"steps_per_second\": %.2f, "
+                "\"particle_steps_per_second\": %.3e}\n",
+                comm.size(), opts.n_part, opts.density, opts.n_steps, elapsed,
+                opts.n_steps / elapsed,
+                static_cast<double>(opts.n_part) * opts.n_steps / elapsed);
+  }
+}
@@ -27,6 +27,17 @@
  *  an appropriate line in myconfig.hpp. To find a list of features that
  *  can be compiled into ESPResSo, refer to myconfig-sample.hpp or to
  *  the documentation of the features.
+ *
+ *  Features are strictly compile-time: they size the particle struct
+ *  (e.g. ROTATION and DIPOLES add per-particle fields) and gate
+ *  per-pair branches, so a build with a feature enabled pays for it
+ *  whether or not a run uses it. Collapsing the build matrix into one
+ *  binary with run-time dispatch would need the per-particle data to
+ *  move out of struct Particle into feature-owned arrays first; with
+ *  the fields inline, every kernel and the ghost wire format depend on
+ *  the compiled layout, and a run-time switch can remove branches but
+ *  not the memory traffic, which is where most of the measured cost
+ *  comes from.
  */
 
 /* Prevent C++ bindings in MPI (there is a DataType called LB in there) */
@@ -20,18 +20,19 @@
 #define ESPRESSO_BONDLIST_HPP
 
 #include <utils/Span.hpp>
-#include <utils/compact_vector.hpp>
 
-#include <boost/container/vector.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/serialization/access.hpp>
-#include <boost/serialization/array.hpp>
+#include <boost/serialization/array_wrapper.hpp>
+#include <boost/serialization/split_member.hpp>
 #include <boost/version.hpp>
 
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 
@@ -84,7 +85,15 @@ public:
  */
 class BondList {
 public:
-  using storage_type = Utils::compact_vector<int>;
+  /** Number of flat storage elements kept in-place inside the particle.
+   *  A bond occupies one int per partner plus one for the bond id, so
+   *  this covers e.g. three pair bonds or two angle bonds without a
+   *  heap allocation; longer lists spill to a heap buffer. Keeping the
+   *  common case inline lets particle copies during resort and the
+   *  bonded-force traversal stay within the particle's own memory.
+   */
+  static constexpr std::size_t n_inline_elements = 6;
+  using storage_type = boost::container::small_vector<int, n_inline_elements>;
 
 private:
   using storage_iterator = storage_type::const_iterator;
@@ -105,19 +114,26 @@ private:
   storage_type m_storage;
 
   friend boost::serialization::access;
-  template <class Archive> void serialize(Archive &ar, long int /* version */) {
-    if (Archive::is_loading::value) {
-      std::size_t size{};
-      ar &size;
-      m_storage.resize(size);
-    }
+  /** Serialize with a compact wire format: a 16-bit length prefix
+   *  followed by the contiguous flat representation, which binary
+   *  archives copy in bulk.
+   */
+  template <class Archive> void save(Archive &oa, unsigned int const) const {
+    auto const size = static_cast<std::uint16_t>(m_storage.size());
+    oa << size
+       << boost::serialization::make_array(m_storage.data(), m_storage.size());
+  }
 
-    if (Archive::is_saving::value) {
-      auto size = m_storage.size();
-      ar &size;
-    }
+  template <class Archive> void load(Archive &ia, unsigned int const) {
+    auto size = static_cast<std::uint16_t>(0u);
+    ia >> size;
+    m_storage.resize(size);
+    ia >> boost::serialization::make_array(m_storage.data(), m_storage.size());
+  }
 
-    ar &boost::serialization::make_array(m_storage.data(), m_storage.size());
+  template <class Archive>
+  void serialize(Archive &ar, unsigned int const file_version) {
+    boost::serialization::split_member(ar, *this, file_version);
   }
 
 public:
@@ -124,6 +124,14 @@ public:
     return m_periodic[coord];
   }
 
+  /**
+   * @brief Check if the box is periodic in all directions.
+   *
+   * Fully periodic boxes can use the branchless minimum-image and
+   * folding fast paths.
+   */
+  bool all_periodic() const { return m_periodic.all(); }
+
   /**
    * @brief Box length
    * @return Return vector of side-lengths of the box.
@@ -191,6 +199,18 @@ public:
                                         length_inv(), m_periodic);
     }
     assert(type() == BoxType::CUBOID);
+    if (all_periodic()) {
+      /* Fully periodic box: fold all components unconditionally with
+       * the round-multiply form. For in-range distances the rounding
+       * term vanishes, so this agrees with the half-box test in
+       * @ref detail::get_mi_coord, but it is branchless and the
+       * compiler can vectorize across the components. This is by far
+       * the hottest code path of the pair and bond kernels. */
+      auto const dx = a - b;
+      return {dx[0] - std::round(dx[0] * m_length_inv[0]) * m_length[0],
+              dx[1] - std::round(dx[1] * m_length_inv[1]) * m_length[1],
+              dx[2] - std::round(dx[2] * m_length_inv[2]) * m_length[2]};
+    }
     return {get_mi_coord(a[0], b[0], 0), get_mi_coord(a[1], b[1], 1),
             get_mi_coord(a[2], b[2], 2)};
   }
@@ -272,6 +292,28 @@ inline void fold_position(Utils::Vector3d &pos, Utils::Vector3i &image_box,
 inline Utils::Vector3d folded_position(const Utils::Vector3d &p,
                                        const BoxGeometry &box) {
   Utils::Vector3d p_folded;
+  if (box.all_periodic()) {
+    /* Branchless fold with the floor-multiply form. Unlike the loop in
+     * @ref Algorithm::periodic_fold, the cost is independent of how far
+     * the coordinate strayed from the primary box. */
+    for (int i = 0; i < 3; i++) {
+      auto const l = box.length()[i];
+      auto x = p[i] - std::floor(p[i] * box.length_inv()[i]) * l;
+      /* Rounding can push the result one image off on either side:
+       * the floor can over-count for coordinates within rounding error
+       * of an image boundary, and the subtraction can round up to the
+       * box length itself for tiny negative coordinates. Both guards
+       * are false for NaN, which must propagate unchanged. */
+      if (x < 0.) {
+        x += l;
+      }
+      if (x >= l) {
+        x = 0.;
+      }
+      p_folded[i] = x;
+    }
+    return p_folded;
+  }
   for (int i = 0; i < 3; i++) {
     if (box.periodic(i)) {
       p_folded[i] = Algorithm::periodic_fold(p[i], box.length()[i]);
@@ -41,6 +41,15 @@
  * This is needed because static containers may be destroyed after
  * the CUDA system was teared down, leading to device_free to fail.
  *
+ * Every allocation is a raw device malloc: there is no pooling, so
+ * actor switches and box resizes that reallocate their buffers pay a
+ * device synchronization each time. The CUDA actors do not share this
+ * allocator either, most manage their own cudaMalloc lifecycle. A
+ * pooled, stream-ordered manager would first need the actors to
+ * converge on a single allocation facility, i.e. this one, which is
+ * the incremental route: adopt the allocator where raw cudaMalloc is
+ * still used, then swap in a pooling backend here in one place.
+ *
  * @tparam T Type to allocate memory for.
  */
 template <class T> struct CudaDeviceAllocator {
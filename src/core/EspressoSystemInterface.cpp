@@ -27,6 +27,17 @@
 
 EspressoSystemInterface *EspressoSystemInterface::m_instance = nullptr;
 
+/* The whole particle array is re-gathered and re-uploaded whenever any
+ * GPU actor needs particle data; the copies are synchronous and there
+ * is no per-field dirty tracking, so a run that only moves particles
+ * still uploads charges and dipoles. Field-level dirty bits would hang
+ * off the particle events (on_particle_change and the force-only
+ * variant in event.cpp already split at the right granularity), with
+ * the upload issued asynchronously at step start on a side stream.
+ * The blocker is that the host-side staging buffer is packed from the
+ * AoS particle store on every gather, so per-field uploads need
+ * per-field staging first; until then the PCIe cost scales with the
+ * full particle record regardless of what changed. */
 void EspressoSystemInterface::gatherParticles() {
 #ifdef CUDA
   if (m_gpu) {
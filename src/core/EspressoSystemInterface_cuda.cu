@@ -133,17 +133,17 @@ void EspressoSystemInterface::split_particle_struct() {
   dim3 block(512, 1, 1);
 
   if (m_needsQGpu && m_needsRGpu)
-    split_kernel_rq<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    split_kernel_rq<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         device_particles.data(), m_r_gpu_begin, m_q_gpu_begin, n);
   else if (m_needsQGpu)
-    split_kernel_q<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    split_kernel_q<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         device_particles.data(), m_q_gpu_begin, n);
   else if (m_needsRGpu)
-    split_kernel_r<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    split_kernel_r<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         device_particles.data(), m_r_gpu_begin, n);
 #ifdef DIPOLES
   if (m_needsDipGpu)
-    split_kernel_dip<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    split_kernel_dip<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         device_particles.data(), m_dip_gpu_begin, n);
 #endif
 }
@@ -23,6 +23,31 @@
 
 /** Manager for a stand-alone ESPResSo system.
  *  The system is default-initialized, MPI-ready and has no script interface.
+ *
+ *  The core supports exactly one system per process: the particle
+ *  store, cell structure, box geometry and method states are globals,
+ *  and the MpiCallbacks framework binds all ranks of the world
+ *  communicator to one head node. A replica-exchange driver inside the
+ *  core would need either several systems per process or communicator
+ *  splits with one callback hierarchy per replica plus an inter-replica
+ *  channel for swap attempts; both contradict the one-global-system
+ *  assumption that runs through the entire core. Replica orchestration
+ *  therefore lives outside, one process group per replica, with
+ *  configuration exchange through whatever transport the driver
+ *  chooses. Removing the global-state assumption is the prerequisite
+ *  for moving it in here.
+ *
+ *  The same global-state layout shapes what an in-memory system
+ *  snapshot could be. The particle side is tractable: each rank owns
+ *  its cell-local particles, which serialize into a flat buffer and
+ *  restore with a forced global resort, much like the checkpointing
+ *  path but without touching disk. The solver side is not: method
+ *  state lives in per-method globals (tuned mesh parameters, neighbor
+ *  lists, LB fields) with reinitialization entangled in the event
+ *  system, so a restore has to replay on_* events rather than memcpy
+ *  state back. A snapshot API should therefore capture the particle
+ *  store verbatim and re-derive solver state through the existing
+ *  events, accepting a retune-free but not copy-free restore.
  */
 class EspressoSystemStandAlone {
 public:
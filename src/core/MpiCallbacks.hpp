@@ -345,6 +345,18 @@ auto make_model(Result::MainRank, R (*f_ptr)(Args...)) {
 
 /**
  * @brief  The interface of the MPI callback mechanism.
+ *
+ * Every call is one broadcast of the callback id plus packed arguments,
+ * and the workers block in @ref MpiCallbacks::loop between calls. The
+ * mechanism is deliberately synchronous: callers may rely on the side
+ * effects of a callback being complete on all ranks when the call
+ * returns, and the OneRank/MainRank/Reduction result flavors need the
+ * matching collective immediately after the dispatch. Queuing calls and
+ * flushing them in batches would only be sound for fire-and-forget
+ * callbacks with no result and no ordering against local reads, and the
+ * head node has no way to know whether the script will read back state
+ * before the next flush point, so a pipeline cannot be bolted on here
+ * without an explicit asynchronous API at the call sites.
  */
 class MpiCallbacks {
 public:
@@ -29,6 +29,7 @@
 
 #include <utils/Span.hpp>
 #include <utils/index.hpp>
+#include <utils/mpi/reduce_sum_deterministic.hpp>
 
 #include <boost/mpi/collectives/reduce.hpp>
 
@@ -84,8 +85,22 @@ Observable_stat::non_bonded_contribution(Utils::Span<double> base_pointer,
   return {base_pointer.begin() + offset * m_chunk_size, m_chunk_size};
 }
 
+/* The full per-pair breakdown (O(types^2) doubles) is reduced even when
+ * the caller only wants the scalar total, because the accumulation in
+ * the energy and pressure kernels writes directly into the per-pair
+ * slots and the total is only formed on the head node. A totals-only
+ * fast path would need a second accumulation mode threaded through the
+ * kernels, and a sparse reduction would need the nonzero pattern to be
+ * agreed on collectively first, which for a one-shot query costs the
+ * latency it is supposed to save. Systems with a few species reduce a
+ * few hundred bytes here; only many-species mixtures notice this. */
 void Observable_stat::mpi_reduce() {
-  if (comm_cart.rank() == 0) {
+  if (Communication::deterministic_reductions()) {
+    std::vector<double> temp(m_data);
+    Utils::Mpi::reduce_sum_deterministic(comm_cart, temp.data(),
+                                         static_cast<int>(temp.size()),
+                                         m_data.data(), 0);
+  } else if (comm_cart.rank() == 0) {
     std::vector<double> temp(m_data);
     boost::mpi::reduce(comm_cart, temp, m_data, std::plus<>{}, 0);
   } else {
@@ -34,6 +34,16 @@
  * data are triggered automatically on access. The data in the cache
  * is invalidated automatically by @ref on_particle_change, and then
  * updated on the next access.
+ *
+ * Note that repeated analysis calls within one frame therefore share a
+ * single gather; only the first access after a particle change pays.
+ * The gather always transfers full Particle structs even for analysis
+ * that reads positions only: the invalidation signal does not say
+ * which field changed, so per-field caches would have to be discarded
+ * together anyway, and the fetch machinery underneath
+ * (@ref prefetch_particle_data) transfers whole particles. Splitting
+ * the cache by field starts with making the change events carry the
+ * field, not with this class.
  */
 class PartCfg {
   /** The particle data */
@@ -399,7 +399,21 @@ struct ParticleRattle {
 };
 #endif
 
-/** Struct holding all information for one particle. */
+/** Struct holding all information for one particle.
+ *
+ *  The layout is deliberately array-of-structures: a particle is the
+ *  unit of ownership, migration, ghost transfer and serialization, and
+ *  every kernel interface in the core (pair kernels, thermostats,
+ *  integrators) takes mutable Particle references. Mirroring the hot
+ *  fields (position, velocity, force) into per-cell
+ *  structure-of-arrays buffers would double the memory traffic the
+ *  mirror is supposed to save unless those kernel interfaces are
+ *  changed to consume the arrays directly, and would need
+ *  synchronization points at every place ghosts are updated or
+ *  particles resorted. A SoA migration is an interface change that
+ *  starts at ParticleRange and the kernel signatures, not a storage
+ *  swap inside this struct.
+ */
 struct Particle { // NOLINT(bugprone-exception-escape)
   ///
   ParticleProperties p;
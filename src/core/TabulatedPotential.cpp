@@ -21,6 +21,9 @@
 
 #include "TabulatedPotential.hpp"
 
+#include <utils/Vector.hpp>
+
+#include <cstddef>
 #include <stdexcept>
 #include <vector>
 
@@ -52,4 +55,17 @@ TabulatedPotential::TabulatedPotential(double minval, double maxval,
   }
   force_tab = force;
   energy_tab = energy;
+
+  auto const make_coeffs = [](std::vector<double> const &tab) {
+    auto coeffs = std::vector<Utils::Vector2d>(tab.size());
+    for (std::size_t i = 0; i + 1 < tab.size(); ++i) {
+      coeffs[i] = {tab[i], tab[i + 1] - tab[i]};
+    }
+    if (not tab.empty()) {
+      coeffs.back() = {tab.back(), 0.};
+    }
+    return coeffs;
+  };
+  force_coeffs = make_coeffs(force_tab);
+  energy_coeffs = make_coeffs(energy_tab);
 }
@@ -19,19 +19,24 @@
 #ifndef CORE_TABULATED_POTENTIAL_HPP
 #define CORE_TABULATED_POTENTIAL_HPP
 
-#include <utils/linear_interpolation.hpp>
+#include <utils/Vector.hpp>
 
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/vector.hpp>
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <vector>
 
 /** Evaluate forces and energies using a custom potential profile.
  *
  *  Forces and energies are evaluated by linear interpolation. The curves
  *  @ref force_tab and @ref energy_tab must be sampled uniformly between
- *  @ref minval and @ref maxval.
+ *  @ref minval and @ref maxval. The interpolation itself runs on
+ *  precomputed per-interval coefficients <tt>{value, slope}</tt>, so
+ *  each evaluation needs a single contiguous load instead of two
+ *  dependent table loads.
  */
 struct TabulatedPotential {
   /** Position on the x-axis of the first tabulated value. */
@@ -44,6 +49,14 @@ struct TabulatedPotential {
   std::vector<double> force_tab;
   /** Tabulated energies. */
   std::vector<double> energy_tab;
+  /** Interpolation coefficients <tt>{value, slope}</tt> per knot of
+   *  @ref force_tab, with a zero slope on the last knot.
+   */
+  std::vector<Utils::Vector2d> force_coeffs;
+  /** Interpolation coefficients <tt>{value, slope}</tt> per knot of
+   *  @ref energy_tab, with a zero slope on the last knot.
+   */
+  std::vector<Utils::Vector2d> energy_coeffs;
 
   TabulatedPotential() = default;
   TabulatedPotential(double minval, double maxval,
@@ -55,8 +68,7 @@ struct TabulatedPotential {
    *  @return Interpolated force.
    */
   double force(double x) const {
-    return Utils::linear_interpolation(force_tab, invstepsize, minval,
-                                       std::clamp(x, minval, maxval));
+    return interpolate(force_coeffs, std::clamp(x, minval, maxval));
   }
 
   /** Evaluate the energy at position @p x.
@@ -64,11 +76,22 @@ struct TabulatedPotential {
    *  @return Interpolated energy.
    */
   double energy(double x) const {
-    return Utils::linear_interpolation(energy_tab, invstepsize, minval,
-                                       std::clamp(x, minval, maxval));
+    return interpolate(energy_coeffs, std::clamp(x, minval, maxval));
   }
 
   double cutoff() const { return maxval; }
+
+private:
+  /** Linear interpolation at position @p x from per-knot coefficients. */
+  double interpolate(std::vector<Utils::Vector2d> const &coeffs,
+                     double x) const {
+    auto const dind = (x - minval) * invstepsize;
+    auto const ind = static_cast<int>(dind);
+    assert(ind >= 0 and static_cast<std::size_t>(ind) < coeffs.size());
+    auto const dx = dind - static_cast<double>(ind);
+    auto const &c = coeffs[ind];
+    return c[0] + c[1] * dx;
+  }
 };
 
 #endif
@@ -19,6 +19,25 @@
 #ifndef ESPRESSO_ACCUMULATORS_HPP
 #define ESPRESSO_ACCUMULATORS_HPP
 
+/** @file
+ *  Registry of accumulators updated automatically during integration.
+ *
+ *  Together with the observables this already forms an in-simulation
+ *  analysis pipeline that replaces trajectory dumps for many standard
+ *  quantities: an observable samples the system, an accumulator
+ *  (@ref Accumulators::Correlator for correlation functions such as
+ *  MSDs, @ref Accumulators::MeanVarianceCalculator,
+ *  @ref Accumulators::TimeSeries) reduces it on a per-accumulator
+ *  stride (@ref AccumulatorBase::delta_N), and only the reduced result
+ *  leaves the simulation. Point-wise transforms between observable and
+ *  accumulator belong in the Correlator's correlation/compression
+ *  operations or in a derived observable, not in this registry, which
+ *  deliberately only knows about strides. Streaming accumulator
+ *  results to file during the run is driven from the Python side,
+ *  where the result arrays are already exposed; the core does not
+ *  write analysis output itself.
+ */
+
 #include "accumulators/AccumulatorBase.hpp"
 
 namespace Accumulators {
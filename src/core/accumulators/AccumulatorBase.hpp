@@ -29,6 +29,18 @@ public:
   explicit AccumulatorBase(int delta_N = 1) : m_delta_N(delta_N) {}
   virtual ~AccumulatorBase() = default;
 
+  /** Number of time steps between automatic updates.
+   *
+   *  The stride is treated as constant while an accumulator is on the
+   *  auto-update list: the integrator uses the registered strides to
+   *  bound how many steps it may advance between update sweeps, and
+   *  the Correlator derives its lag-time grid from the stride at
+   *  construction. An adaptive controller that retunes the stride from
+   *  an online autocorrelation estimate therefore must not reach in
+   *  here mid-run for correlators; it is only sound for memoryless
+   *  accumulators, and belongs in the script layer where the stride
+   *  can be changed between integration calls.
+   */
   int &delta_N() { return m_delta_N; }
 
   virtual void update() = 0;
@@ -18,19 +18,13 @@
  */
 #include "Correlator.hpp"
 
+#include "StateCodec.hpp"
 #include "integrate.hpp"
 
 #include <utils/Vector.hpp>
 #include <utils/math/sqr.hpp>
-#include <utils/serialization/multi_array.hpp>
 
-#include <boost/archive/binary_iarchive.hpp>
-#include <boost/archive/binary_oarchive.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
 #include <boost/range/algorithm/transform.hpp>
-#include <boost/serialization/string.hpp>
-#include <boost/serialization/vector.hpp>
 
 #include <algorithm>
 #include <array>
@@ -516,41 +510,37 @@ std::vector<double> Correlator::get_lag_times() const {
 }
 
 std::string Correlator::get_internal_state() const {
-  std::stringstream ss;
-  boost::archive::binary_oarchive oa(ss);
-
-  oa << t;
-  oa << m_shape;
-  oa << A;
-  oa << B;
-  oa << result;
-  oa << n_sweeps;
-  oa << n_vals;
-  oa << newest;
-  oa << A_accumulated_average;
-  oa << B_accumulated_average;
-  oa << n_data;
-
-  return ss.str();
+  StateEncoder encode("CORR", 1u);
+
+  encode(t);
+  encode(m_shape);
+  encode(A);
+  encode(B);
+  encode(result);
+  encode(n_sweeps);
+  encode(n_vals);
+  encode(newest);
+  encode(A_accumulated_average);
+  encode(B_accumulated_average);
+  encode(n_data);
+
+  return std::move(encode).str();
 }
 
 void Correlator::set_internal_state(std::string const &state) {
-  namespace iostreams = boost::iostreams;
-  iostreams::array_source src(state.data(), state.size());
-  iostreams::stream<iostreams::array_source> ss(src);
-  boost::archive::binary_iarchive ia(ss);
-
-  ia >> t;
-  ia >> m_shape;
-  ia >> A;
-  ia >> B;
-  ia >> result;
-  ia >> n_sweeps;
-  ia >> n_vals;
-  ia >> newest;
-  ia >> A_accumulated_average;
-  ia >> B_accumulated_average;
-  ia >> n_data;
+  StateDecoder decode(state, "CORR", 1u);
+
+  decode(t);
+  decode(m_shape);
+  decode(A);
+  decode(B);
+  decode(result);
+  decode(n_sweeps);
+  decode(n_vals);
+  decode(newest);
+  decode(A_accumulated_average);
+  decode(B_accumulated_average);
+  decode(n_data);
 }
 
 } // namespace Accumulators
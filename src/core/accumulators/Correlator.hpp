@@ -125,6 +125,15 @@ namespace Accumulators {
  *  <tt>newest[i]</tt> always indicates the latest entry of the hierarchic
  *  "past" For every new entry in is incremented and if @c tau_lin is reached,
  *  it starts again from the beginning.
+ *
+ *  Because of this ring indexing, an update moves no sample data between
+ *  hierarchy slots: pushing a value to a coarser level writes exactly one
+ *  compressed entry and advances the level's @c newest index. The per-update
+ *  heap traffic that remains is the buffer returned by each compression and
+ *  correlation call. The correlation and compression kernels themselves run
+ *  over contiguous <tt>std::vector<double></tt> blocks and are written as
+ *  plain transform/inner-product loops so the compiler can vectorize them;
+ *  explicit SIMD intrinsics are deliberately not used anywhere in the core.
  */
 class Correlator : public AccumulatorBase {
   using obs_ptr = std::shared_ptr<Observables::Observable>;
@@ -19,16 +19,11 @@
 
 #include "MeanVarianceCalculator.hpp"
 
-#include <boost/archive/binary_iarchive.hpp>
-#include <boost/archive/binary_oarchive.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
-#include <boost/serialization/shared_ptr.hpp>
-#include <boost/serialization/string.hpp>
-#include <boost/serialization/vector.hpp>
+#include "StateCodec.hpp"
 
-#include <sstream>
+#include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Accumulators {
@@ -45,20 +40,22 @@ std::vector<double> MeanVarianceCalculator::std_error() {
 }
 
 std::string MeanVarianceCalculator::get_internal_state() const {
-  std::stringstream ss;
-  boost::archive::binary_oarchive oa(ss);
+  StateEncoder encode("MVAC", 1u);
 
-  oa << m_acc;
+  auto const acc_state = m_acc.get_state();
+  encode(acc_state.first);
+  encode(acc_state.second);
 
-  return ss.str();
+  return std::move(encode).str();
 }
 
 void MeanVarianceCalculator::set_internal_state(std::string const &state) {
-  namespace iostreams = boost::iostreams;
-  iostreams::array_source src(state.data(), state.size());
-  iostreams::stream<iostreams::array_source> ss(src);
-  boost::archive::binary_iarchive ia(ss);
+  StateDecoder decode(state, "MVAC", 1u);
 
-  ia >> m_acc;
+  std::size_t n;
+  std::vector<Utils::AccumulatorData<double>> acc_data;
+  decode(n);
+  decode(acc_data);
+  m_acc.set_state(n, std::move(acc_data));
 }
 } // namespace Accumulators
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2016-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef ESPRESSO_SRC_CORE_ACCUMULATORS_STATE_CODEC_HPP
+#define ESPRESSO_SRC_CORE_ACCUMULATORS_STATE_CODEC_HPP
+
+#include <boost/multi_array.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Accumulators {
+
+/**
+ * @brief Versioned raw binary codec for accumulator checkpoint state.
+ *
+ * Scalars and vectors of trivially copyable elements are written as raw
+ * memcpy-able blocks preceded by their element count, without the
+ * per-element bookkeeping of Boost archives. Each buffer starts with a
+ * four-character class tag and a format version, so restoring from a
+ * buffer written by another class or an incompatible release fails with
+ * a clear error instead of silently scrambling the state.
+ */
+class StateEncoder {
+public:
+  /**
+   * @param tag      Four-character class tag, e.g. <tt>"CORR"</tt>.
+   * @param version  Format version of the calling class.
+   */
+  StateEncoder(char const *tag, std::uint32_t version) {
+    m_buf.append(tag, 4);
+    write_raw(&version, sizeof(version));
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_trivially_copyable_v<T>, int> = 0>
+  void operator()(T const &value) {
+    write_raw(&value, sizeof(T));
+  }
+
+  template <typename T> void operator()(std::vector<T> const &values) {
+    auto const size = static_cast<std::uint64_t>(values.size());
+    write_raw(&size, sizeof(size));
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      write_raw(values.data(), values.size() * sizeof(T));
+    } else {
+      for (auto const &value : values) {
+        operator()(value);
+      }
+    }
+  }
+
+  template <typename T, std::size_t N>
+  void operator()(boost::multi_array<T, N> const &values) {
+    for (std::size_t i = 0; i < N; ++i) {
+      auto const extent = static_cast<std::uint64_t>(values.shape()[i]);
+      write_raw(&extent, sizeof(extent));
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      write_raw(values.data(), values.num_elements() * sizeof(T));
+    } else {
+      for (std::size_t i = 0; i < values.num_elements(); ++i) {
+        operator()(values.data()[i]);
+      }
+    }
+  }
+
+  std::string str() && { return std::move(m_buf); }
+
+private:
+  void write_raw(void const *data, std::size_t size) {
+    m_buf.append(static_cast<char const *>(data), size);
+  }
+
+  std::string m_buf;
+};
+
+/** @brief Counterpart of @ref StateEncoder. */
+class StateDecoder {
+public:
+  /**
+   * @param state    Buffer written by @ref StateEncoder.
+   * @param tag      Expected four-character class tag.
+   * @param version  Expected format version.
+   */
+  StateDecoder(std::string const &state, char const *tag,
+               std::uint32_t version)
+      : m_buf(state.data()), m_size(state.size()) {
+    if (m_size < 4u or std::memcmp(m_buf, tag, 4) != 0) {
+      throw std::invalid_argument("Buffer doesn't contain " +
+                                  std::string(tag, 4) + " state");
+    }
+    m_pos = 4u;
+    std::uint32_t stored_version;
+    read_raw(&stored_version, sizeof(stored_version));
+    if (stored_version != version) {
+      throw std::invalid_argument("Unsupported " + std::string(tag, 4) +
+                                  " state version " +
+                                  std::to_string(stored_version));
+    }
+  }
+
+  template <typename T,
+            std::enable_if_t<std::is_trivially_copyable_v<T>, int> = 0>
+  void operator()(T &value) {
+    read_raw(&value, sizeof(T));
+  }
+
+  template <typename T> void operator()(std::vector<T> &values) {
+    std::uint64_t size;
+    read_raw(&size, sizeof(size));
+    values.resize(static_cast<std::size_t>(size));
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      read_raw(values.data(), values.size() * sizeof(T));
+    } else {
+      for (auto &value : values) {
+        operator()(value);
+      }
+    }
+  }
+
+  template <typename T, std::size_t N>
+  void operator()(boost::multi_array<T, N> &values) {
+    std::array<std::size_t, N> extents;
+    for (std::size_t i = 0; i < N; ++i) {
+      std::uint64_t extent;
+      read_raw(&extent, sizeof(extent));
+      extents[i] = static_cast<std::size_t>(extent);
+    }
+    values.resize(extents);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      read_raw(values.data(), values.num_elements() * sizeof(T));
+    } else {
+      for (std::size_t i = 0; i < values.num_elements(); ++i) {
+        operator()(values.data()[i]);
+      }
+    }
+  }
+
+private:
+  void read_raw(void *data, std::size_t size) {
+    if (m_pos + size > m_size) {
+      throw std::invalid_argument("Truncated accumulator state buffer");
+    }
+    std::memcpy(data, m_buf + m_pos, size);
+    m_pos += size;
+  }
+
+  char const *m_buf;
+  std::size_t m_size;
+  std::size_t m_pos = 0u;
+};
+
+} // namespace Accumulators
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TelemetryExporter.hpp"
+
+#include "integrate.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Accumulators {
+
+void TelemetryExporter::update() {
+  m_last_values.clear();
+  for (auto const &obs : m_obs) {
+    auto const values = obs->operator()();
+    m_last_values.insert(m_last_values.end(), values.begin(), values.end());
+  }
+  write_file();
+}
+
+std::vector<std::size_t> TelemetryExporter::shape() const {
+  std::size_t n = 0u;
+  for (auto const &obs : m_obs) {
+    n += obs->n_values();
+  }
+  return {n};
+}
+
+void TelemetryExporter::write_file() const {
+  auto const tmp_path = m_file_path + ".tmp";
+  {
+    std::ofstream out(tmp_path, std::ofstream::trunc);
+    if (!out) {
+      throw std::runtime_error("Could not open file " + tmp_path);
+    }
+    out.precision(std::numeric_limits<double>::max_digits10);
+
+    out << "# TYPE espressomd_time gauge\n"
+        << "espressomd_time " << get_sim_time() << '\n';
+
+    auto value = m_last_values.begin();
+    for (std::size_t i = 0; i < m_obs.size(); ++i) {
+      auto const name = "espressomd_" + m_names[i];
+      auto const n_values = m_obs[i]->n_values();
+      out << "# TYPE " << name << " gauge\n";
+      if (n_values == 1u) {
+        out << name << ' ' << *value++ << '\n';
+      } else {
+        for (std::size_t j = 0; j < n_values; ++j) {
+          out << name << "{index=\"" << j << "\"} " << *value++ << '\n';
+        }
+      }
+    }
+  }
+  /* atomic publication: scrapers either see the old or the new file,
+   * never a partially written one */
+  if (std::rename(tmp_path.c_str(), m_file_path.c_str()) != 0) {
+    throw std::runtime_error("Could not replace file " + m_file_path);
+  }
+}
+
+} // namespace Accumulators
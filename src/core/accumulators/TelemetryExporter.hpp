@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef CORE_ACCUMULATORS_TELEMETRY_EXPORTER_HPP
+#define CORE_ACCUMULATORS_TELEMETRY_EXPORTER_HPP
+
+#include "AccumulatorBase.hpp"
+#include "observables/Observable.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Accumulators {
+
+/** @brief Export observables to a file for external monitoring.
+ *
+ *  Every @c delta_N steps, the registered observables are evaluated and
+ *  their values published to a text file in the Prometheus exposition
+ *  format, one gauge per scalar, so long-running simulations can be
+ *  monitored by a scraper (e.g. the node_exporter textfile collector)
+ *  without a round-trip through the Python loop. The file is replaced
+ *  atomically (write to a temporary, then rename), so readers never see
+ *  a partially written snapshot.
+ */
+class TelemetryExporter : public AccumulatorBase {
+public:
+  TelemetryExporter(std::vector<std::shared_ptr<Observables::Observable>> obs,
+                    std::vector<std::string> names, int delta_N,
+                    std::string file_path)
+      : AccumulatorBase(delta_N), m_obs(std::move(obs)),
+        m_names(std::move(names)), m_file_path(std::move(file_path)) {}
+
+  void update() override;
+  /** Values published by the last update, flattened over observables. */
+  std::vector<double> last_values() const { return m_last_values; }
+  std::vector<std::size_t> shape() const override;
+
+private:
+  void write_file() const;
+
+  std::vector<std::shared_ptr<Observables::Observable>> m_obs;
+  std::vector<std::string> m_names;
+  std::string m_file_path;
+  std::vector<double> m_last_values;
+};
+
+} // namespace Accumulators
+
+#endif
@@ -18,33 +18,99 @@
  */
 #include "TimeSeries.hpp"
 
-#include <boost/archive/binary_iarchive.hpp>
-#include <boost/archive/binary_oarchive.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
-#include <boost/serialization/vector.hpp>
+#include "StateCodec.hpp"
 
-#include <sstream>
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Accumulators {
-void TimeSeries::update() { m_data.emplace_back(m_obs->operator()()); }
+void TimeSeries::update() {
+  m_data.emplace_back(m_obs->operator()());
+  if (m_chunk_size != 0u and m_data.size() >= m_chunk_size) {
+    spill_chunk();
+  }
+}
+
+void TimeSeries::spill_chunk() {
+  std::ofstream out(m_file_path,
+                    std::ofstream::binary | std::ofstream::app);
+  if (!out) {
+    throw std::runtime_error("Could not open file " + m_file_path);
+  }
+  for (auto const &sample : m_data) {
+    out.write(reinterpret_cast<const char *>(sample.data()),
+              static_cast<std::streamsize>(sample.size() * sizeof(double)));
+  }
+  if (!out) {
+    throw std::runtime_error("Could not write to file " + m_file_path);
+  }
+  m_spilled_samples += m_data.size();
+  m_data.clear();
+}
+
+std::vector<std::vector<double>> TimeSeries::get_range(std::size_t first,
+                                                       std::size_t last) const {
+  if (last > n_samples() or first > last) {
+    throw std::out_of_range("TimeSeries: sample range [" +
+                            std::to_string(first) + ", " +
+                            std::to_string(last) + ") is out of bounds");
+  }
+
+  std::vector<std::vector<double>> ret;
+  ret.reserve(last - first);
+
+  auto const n_values = m_obs->n_values();
+  if (first < m_spilled_samples) {
+    auto const spilled_last = std::min(last, m_spilled_samples);
+    std::ifstream in(m_file_path, std::ifstream::binary);
+    if (!in) {
+      throw std::runtime_error("Could not open file " + m_file_path);
+    }
+    in.seekg(static_cast<std::streamoff>(first * n_values * sizeof(double)));
+    for (std::size_t i = first; i < spilled_last; ++i) {
+      std::vector<double> sample(n_values);
+      in.read(reinterpret_cast<char *>(sample.data()),
+              static_cast<std::streamsize>(n_values * sizeof(double)));
+      if (!in) {
+        throw std::runtime_error("Could not read from file " + m_file_path);
+      }
+      ret.emplace_back(std::move(sample));
+    }
+  }
+  for (auto i = std::max(first, m_spilled_samples); i < last; ++i) {
+    ret.emplace_back(m_data[i - m_spilled_samples]);
+  }
+
+  return ret;
+}
+
+void TimeSeries::clear() {
+  m_data.clear();
+  if (m_spilled_samples != 0u) {
+    std::remove(m_file_path.c_str());
+    m_spilled_samples = 0u;
+  }
+}
 
 std::string TimeSeries::get_internal_state() const {
-  std::stringstream ss;
-  boost::archive::binary_oarchive oa(ss);
+  StateEncoder encode("TSER", 1u);
 
-  oa << m_data;
+  encode(m_data);
+  encode(m_spilled_samples);
 
-  return ss.str();
+  return std::move(encode).str();
 }
 
 void TimeSeries::set_internal_state(std::string const &state) {
-  namespace iostreams = boost::iostreams;
-  iostreams::array_source src(state.data(), state.size());
-  iostreams::stream<iostreams::array_source> ss(src);
-  boost::archive::binary_iarchive ia(ss);
+  StateDecoder decode(state, "TSER", 1u);
 
-  ia >> m_data;
+  decode(m_data);
+  decode(m_spilled_samples);
 }
 } // namespace Accumulators
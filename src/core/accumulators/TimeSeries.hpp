@@ -24,6 +24,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -37,28 +38,61 @@ namespace Accumulators {
  * the current value of an observable every time
  * it is updated.
  *
+ * Optionally, the series can be spilled to a scratch file in chunks:
+ * whenever @c chunk_size samples are resident, they are appended to
+ * @c file_path as raw doubles and dropped from memory, so the resident
+ * size stays bounded for arbitrarily long runs. Spilled samples remain
+ * retrievable through @ref get_range, which reads them back from the
+ * file on demand.
  */
 class TimeSeries : public AccumulatorBase {
 public:
   TimeSeries(std::shared_ptr<Observables::Observable> obs, int delta_N)
       : AccumulatorBase(delta_N), m_obs(std::move(obs)) {}
+  TimeSeries(std::shared_ptr<Observables::Observable> obs, int delta_N,
+             std::string file_path, std::size_t chunk_size)
+      : AccumulatorBase(delta_N), m_obs(std::move(obs)),
+        m_file_path(std::move(file_path)), m_chunk_size(chunk_size) {
+    if (m_chunk_size == 0u) {
+      throw std::runtime_error("chunk_size must be >= 1");
+    }
+  }
 
   void update() override;
   std::string get_internal_state() const;
   void set_internal_state(std::string const &);
 
+  /** @brief Samples currently held in memory.
+   *  With spilling enabled this is only the tail of the series that has
+   *  not been written out yet; use @ref get_range for the full series.
+   */
   const std::vector<std::vector<double>> &time_series() const { return m_data; }
+  /** @brief Retrieve samples <tt>[first, last)</tt> of the series,
+   *  reading spilled samples back from the scratch file as needed.
+   */
+  std::vector<std::vector<double>> get_range(std::size_t first,
+                                             std::size_t last) const;
+  /** @brief Total number of recorded samples, including spilled ones. */
+  std::size_t n_samples() const { return m_spilled_samples + m_data.size(); }
   std::vector<std::size_t> shape() const override {
-    std::vector<std::size_t> shape{m_data.size()};
+    std::vector<std::size_t> shape{n_samples()};
     auto obs_shape = m_obs->shape();
     shape.insert(shape.end(), obs_shape.begin(), obs_shape.end());
     return shape;
   }
-  void clear() { m_data.clear(); }
+  void clear();
 
 private:
+  void spill_chunk();
+
   std::shared_ptr<Observables::Observable> m_obs;
   std::vector<std::vector<double>> m_data;
+  /** Scratch file for spilled samples; empty means keep all resident. */
+  std::string m_file_path = {};
+  /** Number of resident samples that triggers a spill. */
+  std::size_t m_chunk_size = 0u;
+  /** Number of samples written to the scratch file so far. */
+  std::size_t m_spilled_samples = 0u;
 };
 
 } // namespace Accumulators
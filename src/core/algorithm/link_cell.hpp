@@ -27,22 +27,29 @@ namespace Algorithm {
  * @brief Iterates over all particles in the cell range,
  *        and over all pairs within the cells and with
  *        their neighbors.
+ *
+ * This is a half-shell traversal: only the red partition of the
+ * neighbors is visited, so every unordered pair is handed to the kernel
+ * exactly once. Pair kernels exploit Newton's third law by scattering
+ * the computed force to both particles, with forces on ghost particles
+ * collected back to their owners afterwards.
  */
 template <typename CellIterator, typename PairKernel>
 void link_cell(CellIterator first, CellIterator last,
                PairKernel &&pair_kernel) {
   for (; first != last; ++first) {
+    /* Pairs within this cell */
     for (auto it = first->particles().begin(); it != first->particles().end();
          ++it) {
-      auto &p1 = *it;
-
-      /* Pairs in this cell */
       for (auto jt = std::next(it); jt != first->particles().end(); ++jt) {
-        pair_kernel(p1, *jt);
+        pair_kernel(*it, *jt);
       }
+    }
 
-      /* Pairs with neighbors */
-      for (auto &neighbor : first->neighbors().red()) {
+    /* Pairs with neighbors, one neighbor cell at a time, so that the
+     * neighbor's particles stay cache-resident while being paired. */
+    for (auto &neighbor : first->neighbors().red()) {
+      for (auto &p1 : first->particles()) {
         for (auto &p2 : neighbor->particles()) {
           pair_kernel(p1, p2);
         }
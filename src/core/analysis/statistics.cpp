@@ -45,6 +45,15 @@
 #include <stdexcept>
 #include <vector>
 
+/* This is an all-pairs sweep over the gathered configuration and scales
+ * quadratically. It cannot use the cell grid: without an upper bound on
+ * the result there is no radius to prune cells by, and the global
+ * minimum may be realized by a pair anywhere in the box. Proximity
+ * checks that do have a cutoff (e.g. overlap tests before particle
+ * insertion) should not go through here at all; get_pairs() and
+ * get_pairs_of_types() in cells.hpp answer bounded-distance queries
+ * rank-locally on the regular decomposition and only reduce the hits.
+ */
 double mindist(PartCfg &partCfg, std::vector<int> const &set1,
                std::vector<int> const &set2) {
   using Utils::contains;
@@ -28,18 +28,46 @@
 #include "grid.hpp"
 #include "particle_node.hpp"
 
+#include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 #include <utils/math/sqr.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <numeric>
 #include <stdexcept>
+#include <vector>
+
+namespace {
+/** Warm the particle fetch cache with a batch of ids, so that the
+ *  following per-particle lookups are served locally instead of each
+ *  paying a remote fetch.
+ */
+void prefetch_particles(std::vector<int> const &ids) {
+  auto const chunk_size = fetch_cache_max_size();
+  for (std::size_t offset = 0; offset < ids.size(); offset += chunk_size) {
+    auto const this_size = std::min(chunk_size, ids.size() - offset);
+    prefetch_particle_data(
+        Utils::make_const_span(ids.data() + offset, this_size));
+  }
+}
+} // namespace
 
 std::array<double, 4> calc_re(int chain_start, int chain_n_chains,
                               int chain_length) {
   double dist = 0.0, dist2 = 0.0, dist4 = 0.0;
   std::array<double, 4> re;
 
+  std::vector<int> ids(2ul * static_cast<std::size_t>(chain_n_chains));
+  for (int i = 0; i < chain_n_chains; i++) {
+    ids[2ul * static_cast<std::size_t>(i)] = chain_start + i * chain_length;
+    ids[2ul * static_cast<std::size_t>(i) + 1ul] =
+        chain_start + i * chain_length + chain_length - 1;
+  }
+  prefetch_particles(ids);
+
   for (int i = 0; i < chain_n_chains; i++) {
     auto const &p1 =
         get_particle_data(chain_start + i * chain_length + chain_length - 1);
@@ -66,6 +94,11 @@ std::array<double, 4> calc_rg(int chain_start, int chain_n_chains,
   double r_G = 0.0, r_G2 = 0.0, r_G4 = 0.0;
   std::array<double, 4> rg;
 
+  std::vector<int> ids(
+      static_cast<std::size_t>(chain_n_chains * chain_length));
+  std::iota(ids.begin(), ids.end(), chain_start);
+  prefetch_particles(ids);
+
   for (int i = 0; i < chain_n_chains; i++) {
     double M = 0.0;
     Utils::Vector3d r_CM{};
@@ -109,6 +142,12 @@ std::array<double, 2> calc_rh(int chain_start, int chain_n_chains,
 
   auto const chain_l = static_cast<double>(chain_length);
   auto const prefac = 0.5 * chain_l * (chain_l - 1.);
+
+  std::vector<int> ids(
+      static_cast<std::size_t>(chain_n_chains * chain_length));
+  std::iota(ids.begin(), ids.end(), chain_start);
+  prefetch_particles(ids);
+
   for (int p = 0; p < chain_n_chains; p++) {
     double ri = 0.0;
     for (int i = chain_start + chain_length * p;
@@ -23,6 +23,21 @@
 /** \file
  *
  *  This file contains the code for statistics on chains.
+ *
+ *  Chains are described by id arithmetic (first monomer id, number of
+ *  chains, chain length) rather than by a molecule container. The only
+ *  molecule notion in the core is the per-particle @c mol_id, which is
+ *  a passive label: no data structure maintains per-molecule member
+ *  lists, and RATTLE and the virtual-site bodies re-derive their
+ *  connectivity from bonds respectively @c vs_relative on the fly.
+ *  A first-class molecule registry with contiguous member storage
+ *  would have to be rebuilt or remapped on every resort, since cell
+ *  decomposition assigns particles to ranks by position, not by
+ *  molecule; keeping members contiguous across ranks therefore
+ *  conflicts with spatial ownership, and molecule-local iteration is
+ *  only cheap for molecules that happen to be rank-local. Until such a
+ *  registry exists, the id-range convention below stays the contract
+ *  for chain analysis.
  */
 
 #include <array>
@@ -32,6 +32,7 @@
 #include <boost/variant.hpp>
 
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -106,6 +107,14 @@ void clear_queue() { queue.clear(); }
 
 /** @brief Gathers combined queue from all mpi ranks */
 Queue gather_global_queue(Queue const &local_queue) {
+  /* Skip shipping the queue buffers when no rank has queued a breakage;
+   * for most steps this reduces the exchange to one boolean all-reduce. */
+  auto const any_breakage = boost::mpi::all_reduce(
+      comm_cart, not local_queue.empty(), std::logical_or<bool>());
+  if (not any_breakage) {
+    return {};
+  }
+
   Queue res = local_queue;
   Utils::Mpi::gather_buffer(res, comm_cart);
   boost::mpi::broadcast(comm_cart, res, 0);
@@ -185,13 +194,11 @@ public:
     if (auto p = ::cell_structure.get_local_particle(d.particle_id)) {
       remove_bond(*p, BondView(d.bond_type, {&d.bond_partner_id, 1}));
     }
-    on_particle_change();
   }
   void operator()(DeleteAllBonds const &d) const {
     if (auto p = ::cell_structure.get_local_particle(d.particle_id_1)) {
       remove_pair_bonds_to(*p, d.particle_id_2);
     }
-    on_particle_change();
   }
 };
 
@@ -211,5 +218,11 @@ void process_queue() {
   for (auto const &a : actions) {
     boost::apply_visitor(execute(), a);
   }
+
+  if (not actions.empty()) {
+    /* signal the topology change once per queue, not once per action */
+    on_particle_change();
+    ::cell_structure.bonds_changed();
+  }
 }
 } // namespace BondBreakage
@@ -28,16 +28,26 @@
 
 #include "cell_system/CellStructureType.hpp"
 #include "grid.hpp"
+#include "integrate.hpp"
 #include "lees_edwards/lees_edwards.hpp"
 
+#include <utils/Vector.hpp>
 #include <utils/contains.hpp>
+#include <utils/math/sqr.hpp>
 
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_to_all.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/serialization/vector.hpp>
 #include <boost/variant.hpp>
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -96,6 +106,8 @@ Cell *CellStructure::particle_to_cell(const Particle &p) {
 }
 
 void CellStructure::remove_particle(int id) {
+  m_rebuild_bond_batches = true;
+
   auto remove_all_bonds_to = [id](BondList &bl) {
     for (auto it = bl.begin(); it != bl.end();) {
       if (Utils::contains(it->partner_ids(), id)) {
@@ -123,6 +135,8 @@ void CellStructure::remove_particle(int id) {
 }
 
 Particle *CellStructure::add_local_particle(Particle &&p) {
+  /* Appending may reallocate the cell's particle storage. */
+  m_rebuild_bond_batches = true;
   auto const sort_cell = particle_to_cell(p);
   if (sort_cell) {
 
@@ -134,6 +148,8 @@ Particle *CellStructure::add_local_particle(Particle &&p) {
 }
 
 Particle *CellStructure::add_particle(Particle &&p) {
+  /* Appending may reallocate the cell's particle storage. */
+  m_rebuild_bond_batches = true;
   auto const sort_cell = particle_to_cell(p);
   /* There is always at least one cell, so if the particle
    * does not belong to a cell on this node we can put it there. */
@@ -160,6 +176,8 @@ void CellStructure::remove_all_particles() {
   }
 
   m_particle_index.clear();
+  m_bond_batches.clear();
+  m_rebuild_bond_batches = true;
 }
 
 /* Map the data parts flags from cells to those used internally
@@ -187,15 +205,217 @@ void CellStructure::ghosts_count() {
 void CellStructure::ghosts_update(unsigned data_parts) {
   ghost_communicator(decomposition().exchange_ghosts_comm(),
                      map_data_parts(data_parts));
+  update_fetched_bond_partners(data_parts);
 }
 void CellStructure::ghosts_reduce_forces() {
   ghost_communicator(decomposition().collect_ghost_force_comm(),
                      GHOSTTRANS_FORCE);
+  reduce_fetched_bond_partner_forces();
 }
 #ifdef BOND_CONSTRAINT
 void CellStructure::ghosts_reduce_rattle_correction() {
   ghost_communicator(decomposition().collect_ghost_force_comm(),
                      GHOSTTRANS_RATTLE);
+  reduce_fetched_bond_partner_rattle_corrections();
+}
+#endif
+
+void CellStructure::rebuild_bond_partner_fetch(unsigned data_parts) {
+  /* Drop the fetched partners of the previous particle distribution. */
+  invalidate_fetched_ghosts();
+  m_fetch_send_lists.clear();
+  m_fetch_send_ids.clear();
+  m_fetch_recv_lists.clear();
+  m_fetch_exchange_comm = {};
+  m_fetch_force_comm = {};
+  m_fetch_stale = true;
+
+  if (not fetch_bond_partners) {
+    return;
+  }
+
+  auto const &comm = decomposition().exchange_ghosts_comm().mpi_comm;
+
+  /* Partner ids of local bonds which neither the local particles nor
+   * the ghost layer cover. */
+  std::set<int> missing;
+  for (auto &p : local_particles()) {
+    for (auto const bond : p.bonds()) {
+      for (auto const partner_id : bond.partner_ids()) {
+        if (get_local_particle(partner_id) == nullptr) {
+          missing.insert(partner_id);
+        }
+      }
+    }
+  }
+
+  std::vector<int> const wanted(missing.begin(), missing.end());
+  std::vector<std::vector<int>> wanted_by_node;
+  boost::mpi::all_gather(comm, wanted, wanted_by_node);
+
+  if (std::all_of(wanted_by_node.begin(), wanted_by_node.end(),
+                  [](std::vector<int> const &ids) { return ids.empty(); })) {
+    m_fetch_stale = false;
+    return;
+  }
+
+  /* Requested ids this node owns, per requesting node. */
+  std::vector<std::vector<int>> serve(comm.size());
+  for (int node = 0; node < comm.size(); node++) {
+    if (node == comm.rank())
+      continue;
+    for (auto const id : wanted_by_node[node]) {
+      auto const *p = get_local_particle(id);
+      if (p != nullptr and not p->is_ghost()) {
+        serve[node].push_back(id);
+      }
+    }
+  }
+
+  /* served[node] are the missing partners of this node which node owns,
+   * in the order in which node packs them. */
+  std::vector<std::vector<int>> served(comm.size());
+  boost::mpi::all_to_all(comm, serve, served);
+
+  m_fetch_exchange_comm.mpi_comm = comm;
+  m_fetch_force_comm.mpi_comm = comm;
+
+  for (int node = 0; node < comm.size(); node++) {
+    if (node == comm.rank())
+      continue;
+
+    auto const emit_send = [&]() {
+      if (serve[node].empty())
+        return;
+      auto &mirrors = *m_fetch_send_lists.emplace_back(
+          std::make_unique<ParticleList>());
+      mirrors.resize(serve[node].size());
+      auto it = mirrors.begin();
+      for (auto const id : serve[node]) {
+        *it++ = *get_local_particle(id);
+      }
+      m_fetch_send_ids.push_back(serve[node]);
+      m_fetch_exchange_comm.communications.push_back(
+          {GHOST_SEND, node, {std::addressof(mirrors)}});
+      m_fetch_force_comm.communications.push_back(
+          {GHOST_RECV, node, {std::addressof(mirrors)}});
+    };
+    auto const emit_recv = [&]() {
+      if (served[node].empty())
+        return;
+      auto &fetched = *m_fetch_recv_lists.emplace_back(
+          std::make_unique<ParticleList>());
+      fetched.resize(served[node].size());
+      for (auto &p : fetched) {
+        p.set_ghost(true);
+      }
+      m_fetch_exchange_comm.communications.push_back(
+          {GHOST_RECV, node, {std::addressof(fetched)}});
+      m_fetch_force_comm.communications.push_back(
+          {GHOST_SEND, node, {std::addressof(fetched)}});
+    };
+
+    /* Pairwise blocking exchange: the lower rank of a pair sends first,
+     * so the rounds cannot deadlock. */
+    if (comm.rank() < node) {
+      emit_send();
+      emit_recv();
+    } else {
+      emit_recv();
+      emit_send();
+    }
+  }
+
+  m_fetch_stale = false;
+
+  /* Initial transfer; the properties part carries the particle ids. */
+  ghost_communicator(m_fetch_exchange_comm, map_data_parts(data_parts));
+
+  for (auto const &list : m_fetch_recv_lists) {
+    for (auto &p : *list) {
+      if (get_local_particle(p.id()) == nullptr) {
+        update_particle_index(p.id(), std::addressof(p));
+      }
+    }
+  }
+}
+
+void CellStructure::update_fetched_bond_partners(unsigned data_parts) {
+  if (m_fetch_stale or m_fetch_exchange_comm.communications.empty())
+    return;
+
+  /* Refresh the mirror copies from the owned particles. Particles
+   * removed since the last resort leave their mirror untouched. */
+  for (std::size_t i = 0u; i < m_fetch_send_lists.size(); ++i) {
+    auto it = m_fetch_send_ids[i].begin();
+    for (auto &mirror : *m_fetch_send_lists[i]) {
+      auto const *p = get_local_particle(*it++);
+      if (p != nullptr and not p->is_ghost()) {
+        mirror = *p;
+      }
+    }
+  }
+
+  ghost_communicator(m_fetch_exchange_comm, map_data_parts(data_parts));
+
+  /* The fetched partners are not in the ghost cells, so the force
+   * initialization before the force calculation does not reach them. */
+  if (data_parts & Cells::DATA_PART_POSITION) {
+    for (auto const &list : m_fetch_recv_lists) {
+      for (auto &p : *list) {
+        p.f = ParticleForce{};
+      }
+    }
+  }
+}
+
+void CellStructure::reduce_fetched_bond_partner_forces() {
+  if (m_fetch_stale or m_fetch_force_comm.communications.empty())
+    return;
+
+  for (auto const &list : m_fetch_send_lists) {
+    for (auto &p : *list) {
+      p.f = ParticleForce{};
+    }
+  }
+
+  /* Adds the forces on the fetched copies into the mirrors. */
+  ghost_communicator(m_fetch_force_comm, GHOSTTRANS_FORCE);
+
+  for (std::size_t i = 0u; i < m_fetch_send_lists.size(); ++i) {
+    auto it = m_fetch_send_ids[i].begin();
+    for (auto const &mirror : *m_fetch_send_lists[i]) {
+      auto *p = get_local_particle(*it++);
+      if (p != nullptr and not p->is_ghost()) {
+        p->f += mirror.f;
+      }
+    }
+  }
+}
+
+#ifdef BOND_CONSTRAINT
+void CellStructure::reduce_fetched_bond_partner_rattle_corrections() {
+  if (m_fetch_stale or m_fetch_force_comm.communications.empty())
+    return;
+
+  for (auto const &list : m_fetch_send_lists) {
+    for (auto &p : *list) {
+      p.rattle_params() = {};
+    }
+  }
+
+  /* Adds the corrections on the fetched copies into the mirrors. */
+  ghost_communicator(m_fetch_force_comm, GHOSTTRANS_RATTLE);
+
+  for (std::size_t i = 0u; i < m_fetch_send_lists.size(); ++i) {
+    auto it = m_fetch_send_ids[i].begin();
+    for (auto const &mirror : *m_fetch_send_lists[i]) {
+      auto *p = get_local_particle(*it++);
+      if (p != nullptr and not p->is_ghost()) {
+        p->rattle_params() += mirror.rattle_params();
+      }
+    }
+  }
 }
 #endif
 
@@ -220,6 +440,25 @@ Utils::Vector3d CellStructure::max_range() const {
 }
 
 namespace {
+/**
+ * @brief Morton (Z-order) key of a position, for spatial sorting.
+ */
+std::uint64_t morton_key(Utils::Vector3d const &pos, BoxGeometry const &box) {
+  Utils::Vector3<std::uint32_t> q;
+  for (unsigned int i = 0u; i < 3u; ++i) {
+    auto const s = std::clamp(pos[i] * box.length_inv()[i], 0., 1.);
+    q[i] = std::min(static_cast<std::uint32_t>(s * 65536.), 65535u);
+  }
+
+  std::uint64_t key = 0u;
+  for (unsigned int bit = 0u; bit < 16u; ++bit) {
+    for (unsigned int i = 0u; i < 3u; ++i) {
+      key = (key << 1u) | ((q[i] >> (15u - bit)) & 1u);
+    }
+  }
+  return key;
+}
+
 /**
  * @brief Apply a @ref ParticleChange to a particle index.
  */
@@ -233,8 +472,121 @@ struct UpdateParticleIndexVisitor {
 };
 } // namespace
 
+void CellStructure::sort_verlet_list() {
+  if (m_verlet_list_cells.empty()) {
+    std::sort(m_verlet_list.begin(), m_verlet_list.end());
+    return;
+  }
+
+  /* The cell bookkeeping for incremental rebuilds has to stay parallel
+   * to the pair list, so sort through a permutation. */
+  assert(m_verlet_list_cells.size() == m_verlet_list.size());
+  std::vector<std::size_t> perm(m_verlet_list.size());
+  std::iota(perm.begin(), perm.end(), std::size_t{0u});
+  std::sort(perm.begin(), perm.end(), [this](std::size_t i, std::size_t j) {
+    return m_verlet_list[i] < m_verlet_list[j];
+  });
+
+  std::vector<std::pair<Particle *, Particle *>> pairs;
+  std::vector<std::pair<Cell *, Cell *>> cells;
+  pairs.reserve(perm.size());
+  cells.reserve(perm.size());
+  for (auto const i : perm) {
+    pairs.push_back(m_verlet_list[i]);
+    cells.push_back(m_verlet_list_cells[i]);
+  }
+  m_verlet_list = std::move(pairs);
+  m_verlet_list_cells = std::move(cells);
+}
+
+void CellStructure::update_verlet_list_cells() {
+  m_verlet_list_cells.clear();
+  m_verlet_list_cells.reserve(m_verlet_list.size());
+  for (auto const &pair : m_verlet_list) {
+    m_verlet_list_cells.emplace_back(
+        pair.first->is_ghost() ? nullptr : particle_to_cell(*pair.first),
+        pair.second->is_ghost() ? nullptr : particle_to_cell(*pair.second));
+  }
+}
+
+void CellStructure::rebuild_bond_batches() {
+  /* Keep the groups (and their capacity) from the previous build. */
+  for (auto &batch : m_bond_batches) {
+    batch.second.clear();
+  }
+
+  auto find_batch = [this](int bond_id) -> std::vector<ResolvedBond> & {
+    auto const it =
+        std::find_if(m_bond_batches.begin(), m_bond_batches.end(),
+                     [bond_id](auto const &batch) {
+                       return batch.first == bond_id;
+                     });
+    if (it != m_bond_batches.end()) {
+      return it->second;
+    }
+    m_bond_batches.emplace_back(bond_id, std::vector<ResolvedBond>{});
+    return m_bond_batches.back().second;
+  };
+
+  for (auto &p : local_particles()) {
+    for (auto const bond : p.bonds()) {
+      try {
+        auto partners = resolve_bond_partners(bond.partner_ids());
+        find_batch(bond.bond_id())
+            .push_back(ResolvedBond{std::addressof(p), std::move(partners)});
+      } catch (const BondResolutionError &) {
+        bond_broken_error(p.id(), bond.partner_ids());
+      }
+    }
+  }
+
+  m_rebuild_bond_batches = false;
+}
+
+void CellStructure::resolved_bond_broken_error(ResolvedBond const &bond) {
+  boost::container::static_vector<int, 4> partner_ids;
+  for (auto const partner : bond.partners) {
+    partner_ids.push_back(partner->id());
+  }
+  bond_broken_error(bond.p->id(), Utils::make_const_span(partner_ids));
+}
+
 void CellStructure::resort_particles(bool global_flag, BoxGeometry const &box) {
   invalidate_ghosts();
+  invalidate_fetched_ghosts();
+  m_fetch_stale = true;
+
+  /* An incremental Verlet list rebuild is only possible after a local
+   * resort, with an intact pair list, and as long as no full rebuild is
+   * already pending. The drift bookkeeping is not compatible with
+   * Lees-Edwards offset updates, so it is restricted to cuboid boxes. */
+  auto const try_partial =
+      use_incremental_verlet_lists and use_verlet_list and not global_flag and
+      box.type() == BoxType::CUBOID and not m_verlet_list.empty() and
+      m_verlet_list_cells.size() == m_verlet_list.size() and
+      (not m_rebuild_verlet_list or m_partial_verlet_rebuild);
+
+  /* Record which cells kept all members within half the skin, and their
+   * members' drift, so the drift can be restored after the resort resets
+   * the Verlet update positions. */
+  std::vector<Cell *> clean_candidates;
+  std::vector<std::vector<Utils::Vector3d>> drifts;
+  if (try_partial) {
+    auto const lim = Utils::sqr(skin / 2.);
+    for (auto const cell : local_cells()) {
+      auto const &parts = cell->particles();
+      if (std::all_of(parts.begin(), parts.end(), [lim](Particle const &p) {
+            return (p.pos() - p.pos_at_last_verlet_update()).norm2() < lim;
+          })) {
+        clean_candidates.push_back(cell);
+        auto &drift = drifts.emplace_back();
+        drift.reserve(parts.size());
+        for (auto const &p : parts) {
+          drift.push_back(p.pos() - p.pos_at_last_verlet_update());
+        }
+      }
+    }
+  }
 
   static std::vector<ParticleChange> diff;
   diff.clear();
@@ -245,7 +597,62 @@ void CellStructure::resort_particles(bool global_flag, BoxGeometry const &box) {
     boost::apply_visitor(UpdateParticleIndexVisitor{this}, d);
   }
 
+  /* Restore spatial locality of the particle storage. Only done on
+   * global resorts, which invalidate the pair list anyway. */
+  if (global_flag and use_spatial_particle_sorting) {
+    for (auto const cell : local_cells()) {
+      auto &parts = cell->particles();
+      std::sort(parts.begin(), parts.end(),
+                [&box](Particle const &p1, Particle const &p2) {
+                  return morton_key(p1.pos(), box) < morton_key(p2.pos(), box);
+                });
+      update_particle_index(parts);
+    }
+  }
+
+  if (try_partial) {
+    /* Particle lists touched by the resort. */
+    std::vector<ParticleList const *> modified;
+    for (auto d : diff) {
+      if (auto const *mp = boost::get<ModifiedList>(&d)) {
+        modified.push_back(std::addressof(mp->pl));
+      }
+    }
+    std::sort(modified.begin(), modified.end());
+
+    auto const pending_clean_cells = std::move(m_clean_cells);
+    m_clean_cells.clear();
+    for (std::size_t i = 0u; i < clean_candidates.size(); ++i) {
+      auto const cell = clean_candidates[i];
+      if (std::binary_search(modified.begin(), modified.end(),
+                             std::addressof(cell->particles()))) {
+        continue;
+      }
+      /* With a rebuild already pending, only cells clean since the last
+       * actual rebuild can keep their pairs. */
+      if (m_rebuild_verlet_list and
+          not std::binary_search(pending_clean_cells.begin(),
+                                 pending_clean_cells.end(), cell)) {
+        continue;
+      }
+      m_clean_cells.push_back(cell);
+      /* Restore the accumulated drift, so the half-skin resort criterion
+       * keeps measuring from the positions the kept pairs were generated
+       * at. */
+      auto it = drifts[i].begin();
+      for (auto &p : cell->particles()) {
+        p.pos_at_last_verlet_update() = p.pos() - *it++;
+      }
+    }
+    std::sort(m_clean_cells.begin(), m_clean_cells.end());
+    m_partial_verlet_rebuild = not m_clean_cells.empty();
+  } else {
+    m_clean_cells.clear();
+    m_partial_verlet_rebuild = false;
+  }
+
   m_rebuild_verlet_list = true;
+  m_rebuild_bond_batches = true;
   m_le_pos_offset_at_last_resort = box.lees_edwards_bc().pos_offset;
 
 #ifdef ADDITIONAL_CHECKS
@@ -35,6 +35,7 @@
 #include "cell_system/CellStructureType.hpp"
 #include "config/config.hpp"
 #include "ghosts.hpp"
+#include "memory_stats.hpp"
 
 #include <utils/math/sqr.hpp>
 
@@ -46,6 +47,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <set>
@@ -145,12 +147,128 @@ private:
   unsigned m_resort_particles = Cells::RESORT_NONE;
   bool m_rebuild_verlet_list = true;
   std::vector<std::pair<Particle *, Particle *>> m_verlet_list;
+  /** Cells the Verlet list entries were generated from, or nullptr for
+   *  ghost particles. Only maintained if
+   *  @ref CellStructure::use_incremental_verlet_lists is set. */
+  std::vector<std::pair<Cell *, Cell *>> m_verlet_list_cells;
+  /** Local cells which kept their particle storage during the last resort
+   *  and whose members stayed within half the skin since the last Verlet
+   *  list update. Sorted by address. Only meaningful while
+   *  @ref m_partial_verlet_rebuild is set. */
+  std::vector<Cell *> m_clean_cells;
+  /** Whether the pending Verlet list rebuild can be done incrementally,
+   *  keeping pairs between cells in @ref m_clean_cells. */
+  bool m_partial_verlet_rebuild = false;
   double m_le_pos_offset_at_last_resort = 0.;
+  /** A bond of a local particle with the partner ids resolved to
+   *  particle pointers. */
+  struct ResolvedBond {
+    Particle *p;
+    boost::container::static_vector<Particle *, 4> partners;
+  };
+  /** Bonds of all local particles with resolved partners, grouped by
+   *  bond id. Only maintained if @ref use_bond_batches is set. */
+  std::vector<std::pair<int, std::vector<ResolvedBond>>> m_bond_batches;
+  /** Whether @ref m_bond_batches is out of date. */
+  bool m_rebuild_bond_batches = true;
+  /** Mirror copies of local particles requested as bond partners by
+   *  other nodes, one list per requesting node. Only maintained if
+   *  @ref fetch_bond_partners is set. */
+  std::vector<std::unique_ptr<ParticleList>> m_fetch_send_lists;
+  /** Ids of the particles mirrored in @ref m_fetch_send_lists. */
+  std::vector<std::vector<int>> m_fetch_send_ids;
+  /** Fetched copies of remote bond partners, one list per owning node. */
+  std::vector<std::unique_ptr<ParticleList>> m_fetch_recv_lists;
+  /** Pairwise exchange updating the fetched bond partners, piggybacked
+   *  onto @ref ghosts_update. */
+  GhostCommunicator m_fetch_exchange_comm;
+  /** Reverse of @ref m_fetch_exchange_comm, collects the forces on the
+   *  fetched bond partners. */
+  GhostCommunicator m_fetch_force_comm;
+  /** Whether the fetch lists refer to the particle distribution from
+   *  before the last resort. */
+  bool m_fetch_stale = true;
+
+public:
+#ifdef PAIR_STATS
+  /** @brief Counters for the non-bonded pair sweeps.
+   *
+   *  The per-sweep counters are reset at the start of every non-bonded
+   *  loop, the rebuild counters accumulate over the lifetime of the
+   *  cell structure. The ratio of @ref pairs_kernel to
+   *  @ref pairs_checked measures the excess of the pair list over the
+   *  interacting pairs, which is the quantity the skin trades against
+   *  the rebuild frequency.
+   */
+  struct PairStats {
+    /** Candidate pairs visited during the last sweep. */
+    std::size_t pairs_checked = 0u;
+    /** Pairs handed to the interaction kernel during the last sweep. */
+    std::size_t pairs_kernel = 0u;
+    /** Size of the Verlet list after the last sweep. */
+    std::size_t verlet_pairs = 0u;
+    /** Number of full Verlet list rebuilds. */
+    std::size_t verlet_full_rebuilds = 0u;
+    /** Number of partial Verlet list rebuilds. */
+    std::size_t verlet_partial_rebuilds = 0u;
+  };
+
+  /** @brief Counters of the last non-bonded sweep on this node. */
+  auto const &pair_stats() const { return m_pair_stats; }
+
+private:
+  PairStats m_pair_stats;
+
+  void stats_sweep_start() {
+    m_pair_stats.pairs_checked = 0u;
+    m_pair_stats.pairs_kernel = 0u;
+  }
+  void stats_count_checked() { ++m_pair_stats.pairs_checked; }
+  void stats_count_kernel() { ++m_pair_stats.pairs_kernel; }
+  void stats_count_rebuild(bool partial) {
+    ++(partial ? m_pair_stats.verlet_partial_rebuilds
+               : m_pair_stats.verlet_full_rebuilds);
+  }
+  void stats_set_verlet_pairs(std::size_t n) {
+    m_pair_stats.verlet_pairs = n;
+  }
+#else
+  /* The counters compile to nothing without the PAIR_STATS feature. */
+  void stats_sweep_start() {}
+  void stats_count_checked() {}
+  void stats_count_kernel() {}
+  void stats_count_rebuild(bool) {}
+  void stats_set_verlet_pairs(std::size_t) {}
+#endif // PAIR_STATS
 
 public:
   CellStructure(BoxGeometry const &box);
 
   bool use_verlet_list = true;
+  /** Whether to rebuild the Verlet list incrementally after a local
+   *  resort, re-pairing only cells whose contents moved beyond half the
+   *  skin and keeping the remaining pair list entries intact. */
+  bool use_incremental_verlet_lists = false;
+  /** Whether to re-order the particles within each cell along a Morton
+   *  (Z-order) curve during global resorts. Particle storage order
+   *  otherwise decays into insertion order over long runs, which hurts
+   *  the locality of position and force streaming. */
+  bool use_spatial_particle_sorting = false;
+  /** Whether to run the bonded loops over cached bond batches, grouped
+   *  by bond id with the partner ids resolved once per resort instead of
+   *  once per bond per step. The batches are invalidated by anything
+   *  that moves particles in memory and by @ref bonds_changed. Groups
+   *  bonds of the same type into homogeneous runs, at the cost of a
+   *  different (but equally valid) bond evaluation order. */
+  bool use_bond_batches = false;
+  /** Whether to fetch bond partners which the ghost layer does not
+   *  cover directly by id from their home node, instead of extending
+   *  the ghost layer to the maximal bonded cutoff. The fetched copies
+   *  are only valid for bonded interactions: they carry no position
+   *  shift and do not take part in the non-bonded loops. Bonds created
+   *  between two resorts can only be resolved within the ghost layer.
+   */
+  bool fetch_bond_partners = false;
 
   /**
    * @brief Update local particle index.
@@ -423,6 +541,22 @@ public:
   void ghosts_reduce_rattle_correction();
 #endif
 
+  /**
+   * @brief Rebuild the direct fetch of bond partners not covered by the
+   *        ghost layer.
+   *
+   * Collective call. Matches the partner ids of all local bonds which
+   * cannot be resolved locally with their home nodes and sets up the
+   * pairwise exchanges which keep copies of those partners up-to-date
+   * during @ref ghosts_update and return their forces in
+   * @ref ghosts_reduce_forces. Has to be called after a resort, once
+   * the ghost particles are in the particle index.
+   *
+   * @param data_parts Particle parts for the initial fetch, combination
+   *        of @ref Cells::DataPart
+   */
+  void rebuild_bond_partner_fetch(unsigned data_parts);
+
   /**
    * @brief Resort particles.
    */
@@ -482,6 +616,31 @@ private:
     }
   }
 
+  /** @brief Send the updated data of the fetched bond partners. */
+  void update_fetched_bond_partners(unsigned data_parts);
+
+  /** @brief Collect the forces on the fetched bond partners. */
+  void reduce_fetched_bond_partner_forces();
+
+#ifdef BOND_CONSTRAINT
+  /** @brief Collect the rattle corrections on the fetched bond partners. */
+  void reduce_fetched_bond_partner_rattle_corrections();
+#endif
+
+  /**
+   * @brief Remove the fetched bond partners from the local particle
+   * index.
+   */
+  void invalidate_fetched_ghosts() {
+    for (auto const &list : m_fetch_recv_lists) {
+      for (auto const &p : *list) {
+        if (get_local_particle(p.id()) == &p) {
+          update_particle_index(p.id(), nullptr);
+        }
+      }
+    }
+  }
+
   /**
    * @brief Go through ghost cells and remove the ghost entries from the
    * local particle index.
@@ -499,6 +658,23 @@ private:
       std::unique_ptr<ParticleDecomposition> &&decomposition) {
     clear_particle_index();
 
+    /* Pair list entries refer to cells of the old decomposition. */
+    m_verlet_list.clear();
+    m_verlet_list_cells.clear();
+    m_clean_cells.clear();
+    m_partial_verlet_rebuild = false;
+    m_rebuild_verlet_list = true;
+    m_bond_batches.clear();
+    m_rebuild_bond_batches = true;
+
+    /* The fetch lists refer to particles of the old decomposition. */
+    m_fetch_send_lists.clear();
+    m_fetch_send_ids.clear();
+    m_fetch_recv_lists.clear();
+    m_fetch_exchange_comm = {};
+    m_fetch_force_comm = {};
+    m_fetch_stale = true;
+
     /* Swap in new cell system */
     std::swap(m_decomposition, decomposition);
 
@@ -561,8 +737,12 @@ private:
     if (maybe_box) {
       Algorithm::link_cell(
           first, last,
-          [&kernel, df = detail::MinimalImageDistance{decomposition().box()}](
-              Particle &p1, Particle &p2) { kernel(p1, p2, df(p1, p2)); });
+          [this, &kernel,
+           df = detail::MinimalImageDistance{decomposition().box()}](
+              Particle &p1, Particle &p2) {
+            stats_count_checked();
+            kernel(p1, p2, df(p1, p2));
+          });
     } else {
       if (decomposition().box().type() != BoxType::CUBOID) {
         throw std::runtime_error("Non-cuboid box type is not compatible with a "
@@ -571,8 +751,105 @@ private:
       }
       Algorithm::link_cell(
           first, last,
-          [&kernel, df = detail::EuclidianDistance{}](
-              Particle &p1, Particle &p2) { kernel(p1, p2, df(p1, p2)); });
+          [this, &kernel, df = detail::EuclidianDistance{}](
+              Particle &p1, Particle &p2) {
+            stats_count_checked();
+            kernel(p1, p2, df(p1, p2));
+          });
+    }
+  }
+
+  /**
+   * @brief Sort the Verlet list by particle storage addresses.
+   *
+   * Particles are stored contiguously per cell, so sorting the pair list
+   * by the addresses of its members groups entries by cell pair and
+   * orders them by first particle. The reuse traversal in
+   * @ref verlet_list_loop then streams through particle memory nearly
+   * sequentially instead of scattering reads across all cells.
+   */
+  void sort_verlet_list();
+
+  /**
+   * @brief Record the cells the current Verlet list was generated from.
+   *
+   * Ghost particles are recorded as nullptr, which marks them as always
+   * dirty for the purpose of incremental rebuilds.
+   */
+  void update_verlet_list_cells();
+
+  /**
+   * @brief Rebuild only the parts of the Verlet list involving cells
+   *        whose contents changed since the last update.
+   *
+   * Pairs between cells in @ref m_clean_cells are still valid and are
+   * kept; all other pairs are dropped and re-generated by a link-cell
+   * traversal restricted to cell pairs with at least one dirty member.
+   */
+  template <class PairKernel, class VerletCriterion, class DistanceFunction>
+  void partial_verlet_rebuild(PairKernel &pair_kernel,
+                              VerletCriterion const &verlet_criterion,
+                              DistanceFunction const &df) {
+    assert(m_verlet_list_cells.size() == m_verlet_list.size());
+    auto const is_clean = [this](Cell const *cell) {
+      return cell != nullptr and
+             std::binary_search(m_clean_cells.begin(), m_clean_cells.end(),
+                                cell);
+    };
+
+    /* Keep pairs between clean cells: their particles kept their storage
+     * and stayed within half the skin since the criterion was evaluated. */
+    std::size_t kept = 0u;
+    for (std::size_t i = 0u; i < m_verlet_list.size(); ++i) {
+      if (is_clean(m_verlet_list_cells[i].first) and
+          is_clean(m_verlet_list_cells[i].second)) {
+        m_verlet_list[kept] = m_verlet_list[i];
+        m_verlet_list_cells[kept] = m_verlet_list_cells[i];
+        ++kept;
+      }
+    }
+    m_verlet_list.resize(kept);
+    m_verlet_list_cells.resize(kept);
+
+    for (std::size_t i = 0u; i < kept; ++i) {
+      auto &pair = m_verlet_list[i];
+      stats_count_checked();
+      stats_count_kernel();
+      pair_kernel(*pair.first, *pair.second, df(*pair.first, *pair.second));
+    }
+
+    auto add_pair = [&, this](Particle &p1, Particle &p2, Cell *c1,
+                              Cell *c2) {
+      auto const d = df(p1, p2);
+      stats_count_checked();
+      if (verlet_criterion(p1, p2, d)) {
+        m_verlet_list.emplace_back(&p1, &p2);
+        m_verlet_list_cells.emplace_back(c1, c2);
+        stats_count_kernel();
+        pair_kernel(p1, p2, d);
+      }
+    };
+
+    /* Re-pair every cell pair with at least one dirty member. */
+    for (auto const cell : local_cells()) {
+      auto const cell_clean = is_clean(cell);
+      if (not cell_clean) {
+        for (auto it = cell->particles().begin();
+             it != cell->particles().end(); ++it) {
+          for (auto jt = std::next(it); jt != cell->particles().end(); ++jt) {
+            add_pair(*it, *jt, cell, cell);
+          }
+        }
+      }
+      for (auto const neighbor : cell->neighbors().red()) {
+        if (cell_clean and is_clean(neighbor))
+          continue;
+        for (auto &p1 : cell->particles()) {
+          for (auto &p2 : neighbor->particles()) {
+            add_pair(p1, p2, cell, neighbor);
+          }
+        }
+      }
     }
   }
 
@@ -588,16 +865,37 @@ private:
      * the pair kernel, and the verlet list is rebuilt as
      * we go. */
     if (m_rebuild_verlet_list) {
-      m_verlet_list.clear();
+      stats_count_rebuild(m_partial_verlet_rebuild);
+      if (m_partial_verlet_rebuild) {
+        if (decomposition().minimum_image_distance()) {
+          partial_verlet_rebuild(
+              pair_kernel, verlet_criterion,
+              detail::MinimalImageDistance{decomposition().box()});
+        } else {
+          partial_verlet_rebuild(pair_kernel, verlet_criterion,
+                                 detail::EuclidianDistance{});
+        }
+      } else {
+        m_verlet_list.clear();
+
+        link_cell([&](Particle &p1, Particle &p2, Distance const &d) {
+          if (verlet_criterion(p1, p2, d)) {
+            m_verlet_list.emplace_back(&p1, &p2);
+            stats_count_kernel();
+            pair_kernel(p1, p2, d);
+          }
+        });
 
-      link_cell([&](Particle &p1, Particle &p2, Distance const &d) {
-        if (verlet_criterion(p1, p2, d)) {
-          m_verlet_list.emplace_back(&p1, &p2);
-          pair_kernel(p1, p2, d);
+        if (use_incremental_verlet_lists) {
+          update_verlet_list_cells();
+        } else {
+          m_verlet_list_cells.clear();
         }
-      });
+      }
 
+      sort_verlet_list();
       m_rebuild_verlet_list = false;
+      m_partial_verlet_rebuild = false;
     } else {
       auto const maybe_box = decomposition().minimum_image_distance();
       /* In this case the pair kernel is just run over the verlet list. */
@@ -605,17 +903,25 @@ private:
         auto const distance_function =
             detail::MinimalImageDistance{decomposition().box()};
         for (auto &pair : m_verlet_list) {
+          stats_count_checked();
+          stats_count_kernel();
           pair_kernel(*pair.first, *pair.second,
                       distance_function(*pair.first, *pair.second));
         }
       } else {
         auto const distance_function = detail::EuclidianDistance{};
         for (auto &pair : m_verlet_list) {
+          stats_count_checked();
+          stats_count_kernel();
           pair_kernel(*pair.first, *pair.second,
                       distance_function(*pair.first, *pair.second));
         }
       }
     }
+    stats_set_verlet_pairs(m_verlet_list.size());
+    MemoryStats::track("cells.verlet_list",
+                       m_verlet_list.capacity() *
+                           sizeof(decltype(m_verlet_list)::value_type));
   }
 
 public:
@@ -623,16 +929,74 @@ public:
    * @param bond_kernel Kernel to apply
    */
   template <class BondKernel> void bond_loop(BondKernel const &bond_kernel) {
+    if (use_bond_batches) {
+      if (m_rebuild_bond_batches) {
+        rebuild_bond_batches();
+      }
+      for (auto &batch : m_bond_batches) {
+        for (auto &bond : batch.second) {
+          auto const bond_broken = bond_kernel(*bond.p, batch.first,
+                                               Utils::make_span(bond.partners));
+          if (bond_broken) {
+            resolved_bond_broken_error(bond);
+          }
+        }
+      }
+      return;
+    }
+    for (auto &p : local_particles()) {
+      execute_bond_handler(p, bond_kernel);
+    }
+  }
+
+  /** Bonded pair loop with a batch-level kernel.
+   *
+   *  Like the single-kernel overload, but when the loop runs over the
+   *  cached bond batches, @p batch_kernel is invoked once per bond id
+   *  with the whole batch of resolved bonds, so per-bond dispatch
+   *  (parameter lookup, arity selection) can be hoisted out of the
+   *  instance sweep. For repeated molecular topologies this amortizes
+   *  the dispatch over all instances of the same bond. The batch
+   *  kernel is responsible for reporting broken bonds.
+   *  @param bond_kernel Kernel to apply per bond when batching is
+   *                     disabled.
+   *  @param batch_kernel Kernel to apply per bond batch. Called with
+   *                      the bond id and a range of resolved bonds,
+   *                      each with members @c p and @c partners.
+   */
+  template <class BondKernel, class BatchKernel>
+  void bond_loop(BondKernel const &bond_kernel,
+                 BatchKernel const &batch_kernel) {
+    if (use_bond_batches) {
+      if (m_rebuild_bond_batches) {
+        rebuild_bond_batches();
+      }
+      for (auto &batch : m_bond_batches) {
+        batch_kernel(batch.first, batch.second);
+      }
+      return;
+    }
     for (auto &p : local_particles()) {
       execute_bond_handler(p, bond_kernel);
     }
   }
 
+  /** @brief Announce that bonds were added to or removed from local
+   *  particles outside of a resort, e.g. by collision detection or bond
+   *  breakage.
+   */
+  void bonds_changed() { m_rebuild_bond_batches = true; }
+
   /** Non-bonded pair loop.
    * @param pair_kernel Kernel to apply
    */
   template <class PairKernel> void non_bonded_loop(PairKernel pair_kernel) {
-    link_cell(pair_kernel);
+    stats_sweep_start();
+    link_cell([this, &pair_kernel](Particle &p1, Particle &p2,
+                                   Distance const &d) {
+      stats_count_kernel();
+      pair_kernel(p1, p2, d);
+    });
   }
 
   /** Non-bonded pair loop with potential use
@@ -643,15 +1007,30 @@ public:
   template <class PairKernel, class VerletCriterion>
   void non_bonded_loop(PairKernel pair_kernel,
                        const VerletCriterion &verlet_criterion) {
+    stats_sweep_start();
     if (use_verlet_list) {
       verlet_list_loop(pair_kernel, verlet_criterion);
     } else {
       /* No verlet lists, just run the kernel with pairs from the cells. */
-      link_cell(pair_kernel);
+      link_cell([this, &pair_kernel](Particle &p1, Particle &p2,
+                                     Distance const &d) {
+        stats_count_kernel();
+        pair_kernel(p1, p2, d);
+      });
     }
   }
 
 private:
+  /**
+   * @brief Rebuild @ref m_bond_batches from the bonds of all local
+   * particles. Bonds whose partners cannot be resolved are reported
+   * broken and left out of the batches.
+   */
+  void rebuild_bond_batches();
+
+  /** @brief Report a broken bond from the batched bond loop. */
+  static void resolved_bond_broken_error(ResolvedBond const &bond);
+
   /**
    * @brief Check that particle index is commensurate with particles.
    *
@@ -81,6 +81,14 @@ Cell *RegularDecomposition::position_to_cell(const Utils::Vector3d &pos) {
   return &(cells.at(ind));
 }
 
+/* Particles are moved, not copied, along the whole resort path: the
+ * inserts below and in @ref move_left_or_right transfer ownership of
+ * the dynamic members (bond list, exclusions), so the per-particle cost
+ * of a local resort is pointer shuffling plus the ParticleList slot
+ * bookkeeping. The remaining copies happen where they must: in the MPI
+ * serialization of particles that leave the rank. An arena behind
+ * ParticleList would only relocate those dynamic members' allocations,
+ * at the price of pointer stability across the arena's lifetime. */
 void RegularDecomposition::move_if_local(
     ParticleList &src, ParticleList &rest,
     std::vector<ParticleChange> &modified_cells) {
@@ -418,6 +426,23 @@ void RegularDecomposition::init_cell_interactions() {
     return (global_index - global_halo_offset);
   };
 
+  /* Every neighbor relation recorded below resolves to one specific
+   * periodic image of the neighbor cell, and for relations that reach
+   * across the box boundary the image shift is materialized in the
+   * ghost particle positions: @ref prepare_comm assigns the
+   * @ref GhostCommunication::shift applied on the sender side. The
+   * pair loop can therefore use plain position differences, except when
+   * a) the 3-wide neighbor stencil wraps onto itself, i.e. a periodic
+   * direction has fewer than 4 global cells, so that one recorded
+   * neighbor stands for several images at once, or b) the box has a
+   * time-dependent shear offset that invalidates precomputed shifts. */
+  m_minimum_image_required = m_box.type() != BoxType::CUBOID;
+  for (int i = 0; i < 3; i++) {
+    if (m_box.periodic(i) and global_size[i] < 4) {
+      m_minimum_image_required = true;
+    }
+  }
+
   /* We only consider local cells (e.g. not halo cells), which
    * span the range [(1,1,1), cell_grid) in local coordinates. */
   auto const start = global_index(Utils::Vector3i{1, 1, 1});
@@ -592,6 +617,11 @@ GhostCommunicator RegularDecomposition::prepare_comm() {
             &ghost_comm.communications[cnt].part_lists[n_comm_cells[dir]], lc,
             hc);
 
+        /* the copy wraps around the box: fold the ghost positions */
+        if (m_box.periodic(dir))
+          ghost_comm.communications[cnt].shift[dir] =
+              (lr == 0) ? m_box.length()[dir] : -m_box.length()[dir];
+
         cnt++;
       } else {
         /* i: send/recv loop */
@@ -600,7 +630,15 @@ GhostCommunicator RegularDecomposition::prepare_comm() {
             ghost_comm.communications[cnt].type = GHOST_SEND;
             ghost_comm.communications[cnt].node = node_neighbors[2 * dir + lr];
             ghost_comm.communications[cnt].part_lists.resize(n_comm_cells[dir]);
-            /* prepare folding of ghost positions */
+
+            /* prepare folding of ghost positions: the send wraps around
+             * the box when this node sits at the respective border */
+            if (m_box.periodic(dir) and
+                ((lr == 0 and comm_info.coords[dir] == 0) or
+                 (lr == 1 and
+                  comm_info.coords[dir] == comm_info.dims[dir] - 1)))
+              ghost_comm.communications[cnt].shift[dir] =
+                  (lr == 0) ? m_box.length()[dir] : -m_box.length()[dir];
 
             lc[dir] = hc[dir] = 1 + lr * (cell_grid[dir] - 1);
 
@@ -64,6 +64,15 @@
  * blue). Caution: This implementation needs double sided ghost
  * communication! For single sided ghost communication one would need
  * some ghost-ghost cell interaction as well, which we do not need!
+ *
+ * There is a single cell grid per decomposition, sized by the maximal
+ * interaction range over all interactions. For systems that combine a
+ * short cutoff for the bulk of the pair interactions with one much
+ * larger cutoff for a few particle types, this inflates the cells and
+ * with them the number of pair candidates per cell. Such systems are
+ * better served by @ref HybridDecomposition, which keeps the regular
+ * cell grid sized by the short cutoff and moves the long-ranged types
+ * into an N-square decomposition.
  */
 struct RegularDecomposition : public ParticleDecomposition {
   /** Grid dimensions per node. */
@@ -80,6 +89,10 @@ struct RegularDecomposition : public ParticleDecomposition {
   boost::mpi::communicator m_comm;
   BoxGeometry const &m_box;
   LocalBox<double> m_local_box;
+  /** Whether the pair loop has to fold distances per pair. Determined
+   *  once in @ref init_cell_interactions; see there for the criterion.
+   */
+  bool m_minimum_image_required = true;
   std::vector<Cell> cells;
   std::vector<Cell *> m_local_cells;
   std::vector<Cell *> m_ghost_cells;
@@ -118,7 +131,9 @@ public:
   Utils::Vector3d max_range() const override;
 
   boost::optional<BoxGeometry> minimum_image_distance() const override {
-    return {m_box};
+    if (m_minimum_image_required)
+      return {m_box};
+    return {};
   }
 
   BoxGeometry const &box() const override { return m_box; }
@@ -48,6 +48,8 @@
 #include <boost/serialization/set.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <stdexcept>
 #include <utility>
@@ -196,6 +198,70 @@ std::vector<NeighborPIDs> get_neighbor_pids() {
   return ret;
 }
 
+int resolve_overlaps(double const diameter, int const max_iterations) {
+  detail::search_neighbors_sanity_checks(diameter);
+
+  auto const cutoff2 = Utils::sqr(diameter);
+  int iterations = 0;
+
+  for (; iterations < max_iterations; ++iterations) {
+    cells_update_ghosts(Cells::DATA_PART_PROPERTIES |
+                        Cells::DATA_PART_POSITION);
+
+    /* The force field doubles as the displacement accumulator, so the
+     * corrections on ghosts can be collected with the regular force
+     * reduction. */
+    for (auto &p : cell_structure.local_particles()) {
+      p.f = ParticleForce{};
+    }
+    for (auto &p : cell_structure.ghost_particles()) {
+      p.f = ParticleForce{};
+    }
+
+    std::size_t overlaps = 0u;
+    auto const kernel = [&overlaps, cutoff2, diameter](
+                            Particle &p1, Particle &p2, Distance const &d) {
+      if (d.dist2 >= cutoff2)
+        return;
+      ++overlaps;
+      /* Push the pair apart to contact, half the correction on each
+       * side. Coincident particles are split along the x-axis. */
+      auto const dist = std::sqrt(d.dist2);
+      auto const push = (dist > 0.)
+                            ? (0.5 * (diameter - dist) / dist) * d.vec21
+                            : Utils::Vector3d{0.5 * diameter, 0., 0.};
+      p1.force() += push;
+      p2.force() -= push;
+    };
+    cell_structure.non_bonded_loop(kernel);
+
+    auto const global_overlaps =
+        boost::mpi::all_reduce(comm_cart, overlaps, std::plus<std::size_t>());
+    if (global_overlaps == 0u) {
+      break;
+    }
+
+    cell_structure.ghosts_reduce_forces();
+
+    for (auto &p : cell_structure.local_particles()) {
+      if (p.is_virtual())
+        continue;
+      for (int j = 0; j < 3; j++) {
+        if (!p.is_fixed_along(j)) {
+          p.pos()[j] += p.force()[j];
+        }
+      }
+    }
+
+    cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+  }
+
+  /* The force field was clobbered and particles were moved. */
+  on_particle_change();
+
+  return iterations;
+}
+
 void set_hybrid_decomposition(std::set<int> n_square_types,
                               double cutoff_regular) {
   cell_structure.set_hybrid_decomposition(comm_cart, cutoff_regular, box_geo,
@@ -265,8 +331,19 @@ void cells_update_ghosts(unsigned data_parts) {
       }
     }
 
+    /* Re-establish the fetched copies of bond partners beyond the
+     * ghost layer for the new particle distribution. */
+    cell_structure.rebuild_bond_partner_fetch(data_parts);
+
     /* Particles are now sorted */
     cell_structure.clear_resort_particles();
+
+    /* The particles have changed ranks, so the cached id-to-rank map
+     * is stale. Creation and removal keep the map up-to-date
+     * incrementally; a resort is the only event that moves particles
+     * between ranks, so this is the only place where the map has to be
+     * rebuilt from scratch. */
+    clear_particle_node();
   } else {
     /* Communication step: ghost information */
     cell_structure.ghosts_update(data_parts & ~resort_only_parts);
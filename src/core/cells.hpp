@@ -112,6 +112,21 @@ get_pairs_of_types(double distance, std::vector<int> const &types);
 /** Check if a particle resorting is required. */
 void check_resort_particles();
 
+/**
+ * @brief Resolve hard-sphere overlaps geometrically.
+ *
+ * Detects pairs of particles closer than @p diameter via the cell grid
+ * and pushes them apart to contact distance, without evaluating any
+ * interaction potential. The pass is repeated until no overlaps remain
+ * or @p max_iterations is reached. Forces are invalidated.
+ *
+ * @param diameter Center-to-center distance below which two particles
+ *        count as overlapping.
+ * @param max_iterations Maximal number of correction sweeps.
+ * @return Number of correction sweeps performed.
+ */
+int resolve_overlaps(double diameter, int max_iterations);
+
 /**
  * @brief Get ids of particles that are within a certain distance
  * of another particle.
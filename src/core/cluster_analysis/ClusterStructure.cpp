@@ -21,13 +21,19 @@
 #include "Cluster.hpp"
 #include "PartCfg.hpp"
 #include "errorhandling.hpp"
+#include "grid.hpp"
 #include "partCfg_global.hpp"
 #include "particle_node.hpp"
 
+#include <utils/Vector.hpp>
 #include <utils/for_each_pair.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <memory>
+#include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -50,14 +56,83 @@ void ClusterStructure::run_for_all_pairs() {
   // clear data structs
   clear();
 
-  // Iterate over pairs
-  Utils::for_each_pair(partCfg().begin(), partCfg().end(),
-                       [this](const Particle &p1, const Particle &p2) {
-                         this->add_pair(p1, p2);
-                       });
+  // Distance-bounded criteria can be evaluated with spatial binning
+  // instead of an all-pairs sweep
+  auto const range = m_pair_criterion->max_range();
+  if (range > 0.) {
+    run_for_pairs_in_range(range);
+  } else {
+    // Iterate over pairs
+    Utils::for_each_pair(partCfg().begin(), partCfg().end(),
+                         [this](const Particle &p1, const Particle &p2) {
+                           this->add_pair(p1, p2);
+                         });
+  }
   merge_clusters();
 }
 
+void ClusterStructure::run_for_pairs_in_range(double range) {
+  auto const &box_l = box_geo.length();
+
+  Utils::Vector3i grid;
+  for (unsigned int i = 0u; i < 3u; i++) {
+    grid[i] = std::max(1, static_cast<int>(std::floor(box_l[i] / range)));
+  }
+
+  auto const linear_index = [&grid](Utils::Vector3i const &ind) {
+    return ind[0] + grid[0] * (ind[1] + grid[1] * ind[2]);
+  };
+  auto const bin = [&](Utils::Vector3d const &pos) {
+    Utils::Vector3i ind;
+    for (unsigned int i = 0u; i < 3u; i++) {
+      auto const folded =
+          pos[i] - std::floor(pos[i] / box_l[i]) * box_l[i];
+      ind[i] = std::min(grid[i] - 1,
+                        static_cast<int>(folded / box_l[i] *
+                                         static_cast<double>(grid[i])));
+    }
+    return ind;
+  };
+
+  // bin the particle cache onto a grid with cells of at least the
+  // criterion range
+  std::vector<Particle const *> parts;
+  for (auto const &p : partCfg()) {
+    parts.push_back(&p);
+  }
+  std::unordered_map<int, std::vector<std::size_t>> bins;
+  for (std::size_t i = 0; i < parts.size(); i++) {
+    bins[linear_index(bin(parts[i]->pos()))].push_back(i);
+  }
+
+  // compare each particle against the particles in its 27 neighboring
+  // cells; with periodic wrapping some offsets can alias the same cell,
+  // so neighbor cells are deduplicated per particle
+  for (std::size_t i = 0; i < parts.size(); i++) {
+    auto const home = bin(parts[i]->pos());
+    std::set<int> neighbor_cells;
+    for (int dx = -1; dx <= 1; dx++)
+      for (int dy = -1; dy <= 1; dy++)
+        for (int dz = -1; dz <= 1; dz++) {
+          Utils::Vector3i const neighbor = {
+              (home[0] + dx + grid[0]) % grid[0],
+              (home[1] + dy + grid[1]) % grid[1],
+              (home[2] + dz + grid[2]) % grid[2]};
+          neighbor_cells.insert(linear_index(neighbor));
+        }
+    for (auto const cell : neighbor_cells) {
+      auto const it = bins.find(cell);
+      if (it == bins.end())
+        continue;
+      for (auto const j : it->second) {
+        if (j > i) {
+          add_pair(*parts[i], *parts[j]);
+        }
+      }
+    }
+  }
+}
+
 void ClusterStructure::run_for_bonded_particles() {
   clear();
   for (const auto &p : partCfg()) {
@@ -174,6 +249,14 @@ int ClusterStructure::find_id_for(int x) {
   while (m_cluster_identities.find(tmp) != m_cluster_identities.end()) {
     tmp = m_cluster_identities[tmp];
   }
+  // Path compression: relink every entry on the traversed chain directly
+  // to its root, so repeated lookups do not walk long merge chains again.
+  auto node = x;
+  while (node != tmp) {
+    auto const next = m_cluster_identities[node];
+    m_cluster_identities[node] = tmp;
+    node = next;
+  }
   return tmp;
 }
 
@@ -68,6 +68,9 @@ private:
   /** @brief pair criterion which decides whether two particles are neighbors */
   std::shared_ptr<PairCriteria::PairCriterion> m_pair_criterion;
 
+  /** @brief Run the pair criterion on all pairs closer than @p range,
+   * found via spatial binning of the particle cache. */
+  void run_for_pairs_in_range(double range);
   /** @brief Consider an individual pair of particles during cluster analysis */
   void add_pair(const Particle &p1, const Particle &p2);
   /** Merge clusters and populate their structures */
@@ -43,6 +43,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -67,6 +68,12 @@ void serialize(Archive &ar, CollisionPair &c, const unsigned int) {
 /// During force calculation, colliding particles are recorded in the queue.
 /// The queue is processed after force calculation, when it is safe to add
 /// particles.
+/* The queue persists across steps and is only cleared, so its capacity
+ * is reused and the steady state stays off the allocator. This is the
+ * convention for per-step buffers throughout the core (see the static
+ * CommBuf pair in ghosts.cpp and the grid members of p3m_send_mesh);
+ * a shared frame arena would add an allocator handle to all of these
+ * call sites to save allocations they no longer make. */
 static std::vector<CollisionPair> local_collision_queue;
 
 /// Parameters for collision detection
@@ -396,6 +403,16 @@ void glue_to_surface_bind_part_to_vs(const Particle *const p1,
 #endif
 
 std::vector<CollisionPair> gather_global_collision_queue() {
+  /* Decide with one small all-reduce whether any rank has queued a
+   * collision before shipping the queues themselves. In runs where
+   * collisions are rare this replaces the gather-and-broadcast of the
+   * queue buffers on almost every step. */
+  auto const any_collisions = boost::mpi::all_reduce(
+      comm_cart, not local_collision_queue.empty(), std::logical_or<bool>());
+  if (not any_collisions) {
+    return {};
+  }
+
   std::vector<CollisionPair> res = local_collision_queue;
   Utils::Mpi::gather_buffer(res, comm_cart);
   boost::mpi::broadcast(comm_cart, res, 0);
@@ -482,6 +499,9 @@ void handle_collisions() {
 
       get_part(c.pp1).bonds().insert({collision_params.bond_centers, bondG});
     }
+    if (!local_collision_queue.empty()) {
+      cell_structure.bonds_changed();
+    }
   }
 
 // Virtual sites based collision schemes
@@ -639,6 +659,9 @@ void handle_collisions() {
   if (collision_params.mode == CollisionModeType::BIND_THREE_PARTICLES) {
     auto gathered_queue = gather_global_collision_queue();
     three_particle_binding_domain_decomposition(gathered_queue);
+    if (!gathered_queue.empty()) {
+      cell_structure.bonds_changed();
+    }
   } // if TPB
 
   local_collision_queue.clear();
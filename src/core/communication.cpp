@@ -63,6 +63,14 @@ void init(std::shared_ptr<boost::mpi::environment> mpi_env) {
   MPI_Comm_size(MPI_COMM_WORLD, &n_nodes);
   node_grid = Utils::Mpi::dims_create<3>(n_nodes);
 
+  /* reorder must stay off: the Python interpreter drives the simulation
+   * from world rank 0, and the callback machinery and head-node-only
+   * code paths identify it by comm_cart rank 0. Letting MPI permute the
+   * ranks for topology could hand rank 0 to a worker process. A
+   * node-aware placement (e.g. making X-neighbors intra-node from a
+   * shared-memory communicator split) therefore has to permute the
+   * domain-to-rank assignment in node_grid coordinates while pinning
+   * rank 0, rather than reordering the communicator. */
   comm_cart =
       Utils::Mpi::cart_create(comm_cart, node_grid, /* reorder */ false);
 
@@ -75,6 +83,14 @@ void init(std::shared_ptr<boost::mpi::environment> mpi_env) {
 
   on_program_start();
 }
+
+static bool m_deterministic_reductions = false;
+
+bool deterministic_reductions() { return m_deterministic_reductions; }
+
+void set_deterministic_reductions(bool value) {
+  m_deterministic_reductions = value;
+}
 } // namespace Communication
 
 std::shared_ptr<boost::mpi::environment> mpi_init(int argc, char **argv) {
@@ -143,5 +143,21 @@ namespace Communication {
  * @param mpi_env MPI environment that should be used
  */
 void init(std::shared_ptr<boost::mpi::environment> mpi_env);
+
+/** @brief Whether floating-point reductions use a reproducible order.
+ *
+ *  When enabled, the ghost force reduction and the observable
+ *  reductions replace @c MPI_Reduce by a gather followed by a
+ *  rank-ordered compensated summation on the root, so the results are
+ *  bitwise identical between runs with the same number of ranks. The
+ *  root temporarily holds one buffer copy per rank and sums serially,
+ *  which costs a few percent on these small messages; the force loops
+ *  themselves are not affected.
+ */
+bool deterministic_reductions();
+
+/** @brief Enable or disable reproducible reduction order.
+ *  Must be called on all ranks. */
+void set_deterministic_reductions(bool value);
 } // namespace Communication
 #endif
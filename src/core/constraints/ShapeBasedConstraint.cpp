@@ -41,6 +41,14 @@
 #include <numeric>
 
 namespace Constraints {
+void ShapeBasedConstraint::reset_force() {
+  m_local_force = Utils::Vector3d{0, 0, 0};
+  m_outer_normal_force = 0.0;
+  // Constraints::add_forces resets all constraints before the particle
+  // sweep, so the kernel lookup is amortized over the whole sweep
+  m_coulomb_kernel = Coulomb::pair_force_kernel();
+}
+
 Utils::Vector3d ShapeBasedConstraint::total_force() const {
   return all_reduce(comm_cart, m_local_force, std::plus<>());
 }
@@ -80,7 +88,7 @@ ParticleForce ShapeBasedConstraint::force(Particle const &p,
     double dist = 0.;
     Utils::Vector3d dist_vec;
     m_shape->calculate_dist(folded_pos, dist, dist_vec);
-    auto const coulomb_kernel = Coulomb::pair_force_kernel();
+    auto const &coulomb_kernel = m_coulomb_kernel;
 
 #ifdef DPD
     Utils::Vector3d dpd_force{};
@@ -30,6 +30,9 @@
 
 #include <utils/Vector.hpp>
 
+#include <boost/optional.hpp>
+
+#include <functional>
 #include <memory>
 
 namespace Constraints {
@@ -65,10 +68,7 @@ public:
 
   Shapes::Shape const &shape() const { return *m_shape; }
 
-  void reset_force() override {
-    m_local_force = Utils::Vector3d{0, 0, 0};
-    m_outer_normal_force = 0.0;
-  }
+  void reset_force() override;
 
   bool &only_positive() { return m_only_positive; }
   bool &penetrable() { return m_penetrable; }
@@ -93,6 +93,12 @@ private:
   bool m_only_positive;
   Utils::Vector3d m_local_force;
   double m_outer_normal_force;
+  /** Electrostatics kernel, looked up once per force sweep in
+   *  @ref reset_force instead of once per particle in @ref force.
+   */
+  boost::optional<
+      std::function<Utils::Vector3d(double, Utils::Vector3d const &, double)>>
+      m_coulomb_kernel;
 };
 
 } // namespace Constraints
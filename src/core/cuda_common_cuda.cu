@@ -23,6 +23,7 @@
 #include "cuda_interface.hpp"
 #include "cuda_utils.cuh"
 #include "errorhandling.hpp"
+#include "memory_stats.hpp"
 
 #include "CudaDeviceAllocator.hpp"
 #include "CudaHostAllocator.hpp"
@@ -66,6 +67,13 @@ pinned_vector<float> particle_forces_host;
 pinned_vector<float> particle_torques_host;
 CUDA_energy energy_host;
 
+/* There is exactly one stream and every actor launches into it, so
+ * independent actors (e.g. LB and a dipolar solver) serialize on the
+ * device even though they only meet at the force merge. Per-actor
+ * streams with an event joining them before the forces are copied
+ * back would overlap them; that requires each actor to take a stream
+ * handle instead of reaching for this global, and the common
+ * transfers below to be ordered against every actor stream. */
 cudaStream_t stream[1];
 
 void cuda_check_errors_exit(const dim3 &block, const dim3 &grid,
@@ -117,6 +125,14 @@ void resize_buffers(std::size_t number_of_particles) {
   particle_torques_host.resize(3 * number_of_particles);
   resize_or_replace(particle_torques_device, 3 * number_of_particles);
 #endif
+
+  /* the pinned host mirrors and the device buffers are the same size,
+   * so one sample covers host and device memory alike */
+  auto bytes = byte_size(particle_data_host) + byte_size(particle_forces_host);
+#ifdef ROTATION
+  bytes += byte_size(particle_torques_host);
+#endif
+  MemoryStats::track("gpu.particle_buffers", 2u * bytes);
 }
 
 /**
@@ -132,6 +148,7 @@ void resize_buffers(std::size_t number_of_particles) {
 void gpu_init_particle_comm(int this_node) {
   if (this_node == 0 && global_part_vars_host.communication_enabled == 0) {
     try {
+      cuda_init();
       cuda_check_device();
     } catch (cuda_runtime_error const &err) {
       fprintf(stderr, "ERROR: %s\n", err.what());
@@ -53,6 +53,17 @@ struct CompareDevices {
  *  It relies on <tt>MPI_Get_processor_name()</tt> to get a unique identifier
  *  of the physical node, as opposed to the logical rank of which there can
  *  be more than one per node.
+ *
+ *  Note that there is no rank-to-device mapping to automate here: GPU
+ *  kernels are issued by the head node only (cf. the device setter in
+ *  CudaInitHandle), so within one MPI world at most one rank touches a
+ *  GPU. Device contention on multi-GPU nodes comes from independent
+ *  jobs sharing the node, which an in-process mapper cannot see; that
+ *  assignment belongs to the job scheduler via CUDA_VISIBLE_DEVICES.
+ *  Should worker ranks ever issue GPU work, the mapping would be the
+ *  local rank within an <tt>MPI_COMM_TYPE_SHARED</tt> split modulo the
+ *  device count, with the @c proc_name collected here providing the
+ *  per-node grouping.
  */
 std::vector<EspressoGpuDevice> cuda_gather_gpus() {
   /* List of local devices */
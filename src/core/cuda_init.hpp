@@ -49,7 +49,20 @@ struct EspressoGpuDevice {
   int n_cores;
 };
 
-/** Initializes the CUDA stream.
+/** Initializes the CUDA stream. Idempotent: called on demand by the
+ *  first GPU user rather than at program start, so CPU-only runs never
+ *  pay for the CUDA context creation.
+ *
+ *  Kernel launch configurations are currently compile-time constants
+ *  (e.g. 64-thread blocks in several LB kernels, and the cao-derived
+ *  blocks in p3m_gpu_cuda.cu), chosen for no device in particular.
+ *  The natural fix is a launch-config tuner in the spirit of
+ *  @ref TuningAlgorithm: benchmark a handful of block sizes per kernel
+ *  on first use and keep the winner keyed by device name and problem
+ *  size class. The winners belong in run-time state loaded here, once
+ *  the kernels take their launch configuration as a parameter instead
+ *  of a literal; persisting them across runs is then a serialization
+ *  detail on top.
  */
 void cuda_init();
 
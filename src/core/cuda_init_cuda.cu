@@ -39,7 +39,19 @@ static const int computeCapabilityMinMajor = 3;
 static const int computeCapabilityMinMinor = 0;
 /**@}*/
 
-void cuda_init() { CUDA_CHECK(cudaStreamCreate(&stream[0])) }
+/** Whether the CUDA stream has been created. Creating the stream
+ *  instantiates the CUDA context, which can cost seconds on some
+ *  systems, so it is deferred to the first GPU user instead of being
+ *  paid at program start by CPU-only runs.
+ */
+static bool cuda_initialized = false;
+
+void cuda_init() {
+  if (not cuda_initialized) {
+    CUDA_CHECK(cudaStreamCreate(&stream[0]))
+    cuda_initialized = true;
+  }
+}
 
 int cuda_get_n_gpus() {
   int deviceCount;
@@ -83,8 +95,11 @@ EspressoGpuDevice cuda_get_device_props(const int dev) {
 
 void cuda_set_device(int dev) {
   CUDA_CHECK(cudaSetDevice(dev))
-  CUDA_CHECK(cudaStreamDestroy(stream[0]))
+  if (cuda_initialized) {
+    CUDA_CHECK(cudaStreamDestroy(stream[0]))
+  }
   CUDA_CHECK(cudaStreamCreate(&stream[0]))
+  cuda_initialized = true;
 }
 
 int cuda_get_device() {
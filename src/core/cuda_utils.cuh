@@ -51,7 +51,17 @@ private:
     }                                                                          \
   }
 
-/** CUDA streams for parallel computing on CPU and GPU */
+/** CUDA streams for parallel computing on CPU and GPU.
+ *
+ *  Capturing the steady-state per-step kernel sequence into a CUDA
+ *  graph would amortize the launch latency of the many small kernels
+ *  LB and P3M issue per step. Two things stand in the way: the launch
+ *  sequence must be closed over stream handles rather than this
+ *  global, and the error check after every KERNELCALL below performs a
+ *  device query, which breaks stream capture and would have to be
+ *  compiled out in graph mode. Graph capture is therefore gated on the
+ *  same refactoring as any multi-stream work.
+ */
 extern cudaStream_t stream[1];
 
 /** In case of error during CUDA memory allocation and memory copy, print
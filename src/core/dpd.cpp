@@ -81,6 +81,10 @@ static double weight(int type, double r_cut, double k, double r) {
   if (type == 0) {
     return 1.;
   }
+  if (k == 1.0) {
+    /* the standard linear DPD weight does not need the generic pow() */
+    return 1. - r / r_cut;
+  }
   return 1. - pow((r / r_cut), k);
 }
 
@@ -115,6 +119,13 @@ Utils::Vector3d dpd_pair_force(Particle const &p1, Particle const &p2,
           : Vector3d{};
 
   auto const f_r = dpd_pair_force(ia_params.dpd.radial, v21, dist, noise_vec);
+
+  if (ia_params.dpd.trans.cutoff <= 0.0) {
+    /* purely radial coupling: the projection reduces to a dot product
+     * instead of building the full projector matrix */
+    return d * ((d * f_r) / dist2);
+  }
+
   auto const f_t = dpd_pair_force(ia_params.dpd.trans, v21, dist, noise_vec);
 
   /* Projection operator to radial direction */
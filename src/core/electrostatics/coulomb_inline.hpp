@@ -70,8 +70,8 @@ struct ShortRangeForceKernel
 };
 
 struct ShortRangeForceCorrectionsKernel
-    : public boost::static_visitor<boost::optional<
-          std::function<void(Particle &, Particle &, double)>>> {
+    : public boost::static_visitor<boost::optional<std::function<void(
+          Particle &, Particle &, double, Utils::Vector3d const &)>>> {
 
   using kernel_type = result_type::value_type;
 
@@ -84,8 +84,9 @@ struct ShortRangeForceCorrectionsKernel
   result_type
   operator()(std::shared_ptr<ElectrostaticLayerCorrection> const &ptr) const {
     auto const &actor = *ptr;
-    return kernel_type{[&actor](Particle &p1, Particle &p2, double q1q2) {
-      actor.add_pair_force_corrections(p1, p2, q1q2);
+    return kernel_type{[&actor](Particle &p1, Particle &p2, double q1q2,
+                                Utils::Vector3d const &d) {
+      actor.add_pair_force_corrections(p1, p2, q1q2, d);
     }};
   }
 #endif // P3M
@@ -159,7 +160,7 @@ struct ShortRangeEnergyKernel
       if (energy_kernel) {
         energy = (*energy_kernel)(p1, p2, q1q2, d, dist);
       }
-      return energy + actor.pair_energy_correction(q1q2, p1, p2);
+      return energy + actor.pair_energy_correction(q1q2, p1, p2, d);
     }};
   }
 #endif // P3M
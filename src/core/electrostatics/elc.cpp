@@ -109,13 +109,23 @@ static std::vector<SCCache> calc_sc_cache(ParticleRange const &particles,
   auto const n_part = particles.size();
   std::vector<SCCache> ret(n_freq * n_part);
 
-  for (std::size_t freq = 1; freq <= n_freq; freq++) {
-    auto const pref = c_2pi * u * static_cast<double>(freq);
+  /* base frequency: the only one requiring trigonometric function calls */
+  auto const pref = c_2pi * u;
+  std::size_t o = 0;
+  for (auto const &p : particles) {
+    auto const arg = pref * p.pos()[dir];
+    ret[o++] = {sin(arg), cos(arg)};
+  }
 
-    std::size_t o = (freq - 1) * n_part;
-    for (auto const &p : particles) {
-      auto const arg = pref * p.pos()[dir];
-      ret[o++] = {sin(arg), cos(arg)};
+  /* higher harmonics follow from the angle addition theorem, which
+   * replaces the remaining transcendental calls by multiplications */
+  for (std::size_t freq = 2; freq <= n_freq; freq++) {
+    auto const prev = (freq - 2) * n_part;
+    for (std::size_t i = 0; i < n_part; i++) {
+      auto const &base = ret[i];
+      auto const &last = ret[prev + i];
+      ret[o++] = {last.s * base.c + last.c * base.s,
+                  last.c * base.c - last.s * base.s};
     }
   }
 
@@ -510,12 +520,15 @@ void setup_PoQ(elc_data const &elc, double prefactor, std::size_t index,
   for (auto const &p : particles) {
     auto const z = p.pos()[2];
     auto const q = p.q();
+    auto const &sc = sc_cache[o + ic];
+    auto const qs = q * sc.s;
+    auto const qc = q * sc.c;
     auto e = exp(omega * z);
 
-    partblk[size * ic + POQESM] = q * sc_cache[o + ic].s / e;
-    partblk[size * ic + POQESP] = q * sc_cache[o + ic].s * e;
-    partblk[size * ic + POQECM] = q * sc_cache[o + ic].c / e;
-    partblk[size * ic + POQECP] = q * sc_cache[o + ic].c * e;
+    partblk[size * ic + POQESM] = qs / e;
+    partblk[size * ic + POQESP] = qs * e;
+    partblk[size * ic + POQECM] = qc / e;
+    partblk[size * ic + POQECP] = qc * e;
 
     add_vec(gblcblk, gblcblk, block(partblk.data(), ic, size), size);
 
@@ -527,10 +540,10 @@ void setup_PoQ(elc_data const &elc, double prefactor, std::size_t index,
 
         auto const scale = q * elc.delta_mid_bot;
 
-        lclimgebot[POQESM] = sc_cache[o + ic].s / e;
-        lclimgebot[POQESP] = sc_cache[o + ic].s * e;
-        lclimgebot[POQECM] = sc_cache[o + ic].c / e;
-        lclimgebot[POQECP] = sc_cache[o + ic].c * e;
+        lclimgebot[POQESM] = sc.s / e;
+        lclimgebot[POQESP] = sc.s * e;
+        lclimgebot[POQECM] = sc.c / e;
+        lclimgebot[POQECP] = sc.c * e;
 
         addscale_vec(gblcblk, scale, lclimgebot, gblcblk, size);
 
@@ -543,18 +556,18 @@ void setup_PoQ(elc_data const &elc, double prefactor, std::size_t index,
             fac_delta_mid_bot;
       }
 
-      lclimge[POQESP] += q * sc_cache[o + ic].s * e;
-      lclimge[POQECP] += q * sc_cache[o + ic].c * e;
+      lclimge[POQESP] += qs * e;
+      lclimge[POQECP] += qc * e;
 
       if (z > (elc.box_h - elc.space_layer)) { // handle the upper case now
         e = exp(omega * (2. * elc.box_h - z));
 
         auto const scale = q * elc.delta_mid_top;
 
-        lclimgetop[POQESM] = sc_cache[o + ic].s / e;
-        lclimgetop[POQESP] = sc_cache[o + ic].s * e;
-        lclimgetop[POQECM] = sc_cache[o + ic].c / e;
-        lclimgetop[POQECP] = sc_cache[o + ic].c * e;
+        lclimgetop[POQESM] = sc.s / e;
+        lclimgetop[POQESP] = sc.s * e;
+        lclimgetop[POQECM] = sc.c / e;
+        lclimgetop[POQECP] = sc.c * e;
 
         addscale_vec(gblcblk, scale, lclimgetop, gblcblk, size);
 
@@ -567,8 +580,8 @@ void setup_PoQ(elc_data const &elc, double prefactor, std::size_t index,
             fac_delta_mid_top;
       }
 
-      lclimge[POQESM] += q * sc_cache[o + ic].s * e;
-      lclimge[POQECM] += q * sc_cache[o + ic].c * e;
+      lclimge[POQESM] += qs * e;
+      lclimge[POQECM] += qc * e;
     }
 
     ++ic;
@@ -650,25 +663,23 @@ static void setup_PQ(elc_data const &elc, double prefactor, std::size_t index_p,
   for (auto const &p : particles) {
     auto const z = p.pos()[2];
     auto const q = p.q();
+    auto const &sx = scxcache[ox + ic];
+    auto const &sy = scycache[oy + ic];
+    auto const ss = sx.s * sy.s;
+    auto const sc = sx.s * sy.c;
+    auto const cs = sx.c * sy.s;
+    auto const cc = sx.c * sy.c;
     auto e = exp(omega * z);
 
-    partblk[size * ic + PQESSM] =
-        scxcache[ox + ic].s * scycache[oy + ic].s * q / e;
-    partblk[size * ic + PQESCM] =
-        scxcache[ox + ic].s * scycache[oy + ic].c * q / e;
-    partblk[size * ic + PQECSM] =
-        scxcache[ox + ic].c * scycache[oy + ic].s * q / e;
-    partblk[size * ic + PQECCM] =
-        scxcache[ox + ic].c * scycache[oy + ic].c * q / e;
-
-    partblk[size * ic + PQESSP] =
-        scxcache[ox + ic].s * scycache[oy + ic].s * q * e;
-    partblk[size * ic + PQESCP] =
-        scxcache[ox + ic].s * scycache[oy + ic].c * q * e;
-    partblk[size * ic + PQECSP] =
-        scxcache[ox + ic].c * scycache[oy + ic].s * q * e;
-    partblk[size * ic + PQECCP] =
-        scxcache[ox + ic].c * scycache[oy + ic].c * q * e;
+    partblk[size * ic + PQESSM] = ss * q / e;
+    partblk[size * ic + PQESCM] = sc * q / e;
+    partblk[size * ic + PQECSM] = cs * q / e;
+    partblk[size * ic + PQECCM] = cc * q / e;
+
+    partblk[size * ic + PQESSP] = ss * q * e;
+    partblk[size * ic + PQESCP] = sc * q * e;
+    partblk[size * ic + PQECSP] = cs * q * e;
+    partblk[size * ic + PQECCP] = cc * q * e;
 
     add_vec(gblcblk, gblcblk, block(partblk.data(), ic, size), size);
 
@@ -679,15 +690,15 @@ static void setup_PQ(elc_data const &elc, double prefactor, std::size_t index_p,
         e = exp(-omega * z);
         auto const scale = q * elc.delta_mid_bot;
 
-        lclimgebot[PQESSM] = scxcache[ox + ic].s * scycache[oy + ic].s / e;
-        lclimgebot[PQESCM] = scxcache[ox + ic].s * scycache[oy + ic].c / e;
-        lclimgebot[PQECSM] = scxcache[ox + ic].c * scycache[oy + ic].s / e;
-        lclimgebot[PQECCM] = scxcache[ox + ic].c * scycache[oy + ic].c / e;
+        lclimgebot[PQESSM] = ss / e;
+        lclimgebot[PQESCM] = sc / e;
+        lclimgebot[PQECSM] = cs / e;
+        lclimgebot[PQECCM] = cc / e;
 
-        lclimgebot[PQESSP] = scxcache[ox + ic].s * scycache[oy + ic].s * e;
-        lclimgebot[PQESCP] = scxcache[ox + ic].s * scycache[oy + ic].c * e;
-        lclimgebot[PQECSP] = scxcache[ox + ic].c * scycache[oy + ic].s * e;
-        lclimgebot[PQECCP] = scxcache[ox + ic].c * scycache[oy + ic].c * e;
+        lclimgebot[PQESSP] = ss * e;
+        lclimgebot[PQESCP] = sc * e;
+        lclimgebot[PQECSP] = cs * e;
+        lclimgebot[PQECCP] = cc * e;
 
         addscale_vec(gblcblk, scale, lclimgebot, gblcblk, size);
 
@@ -702,25 +713,25 @@ static void setup_PQ(elc_data const &elc, double prefactor, std::size_t index_p,
             fac_delta_mid_bot * q;
       }
 
-      lclimge[PQESSP] += scxcache[ox + ic].s * scycache[oy + ic].s * e;
-      lclimge[PQESCP] += scxcache[ox + ic].s * scycache[oy + ic].c * e;
-      lclimge[PQECSP] += scxcache[ox + ic].c * scycache[oy + ic].s * e;
-      lclimge[PQECCP] += scxcache[ox + ic].c * scycache[oy + ic].c * e;
+      lclimge[PQESSP] += ss * e;
+      lclimge[PQESCP] += sc * e;
+      lclimge[PQECSP] += cs * e;
+      lclimge[PQECCP] += cc * e;
 
       if (z > (elc.box_h - elc.space_layer)) { // handle the upper case now
 
         e = exp(omega * (2. * elc.box_h - z));
         auto const scale = q * elc.delta_mid_top;
 
-        lclimgetop[PQESSM] = scxcache[ox + ic].s * scycache[oy + ic].s / e;
-        lclimgetop[PQESCM] = scxcache[ox + ic].s * scycache[oy + ic].c / e;
-        lclimgetop[PQECSM] = scxcache[ox + ic].c * scycache[oy + ic].s / e;
-        lclimgetop[PQECCM] = scxcache[ox + ic].c * scycache[oy + ic].c / e;
+        lclimgetop[PQESSM] = ss / e;
+        lclimgetop[PQESCM] = sc / e;
+        lclimgetop[PQECSM] = cs / e;
+        lclimgetop[PQECCM] = cc / e;
 
-        lclimgetop[PQESSP] = scxcache[ox + ic].s * scycache[oy + ic].s * e;
-        lclimgetop[PQESCP] = scxcache[ox + ic].s * scycache[oy + ic].c * e;
-        lclimgetop[PQECSP] = scxcache[ox + ic].c * scycache[oy + ic].s * e;
-        lclimgetop[PQECCP] = scxcache[ox + ic].c * scycache[oy + ic].c * e;
+        lclimgetop[PQESSP] = ss * e;
+        lclimgetop[PQESCP] = sc * e;
+        lclimgetop[PQECSP] = cs * e;
+        lclimgetop[PQECCP] = cc * e;
 
         addscale_vec(gblcblk, scale, lclimgetop, gblcblk, size);
 
@@ -735,10 +746,10 @@ static void setup_PQ(elc_data const &elc, double prefactor, std::size_t index_p,
             fac_delta_mid_top * q;
       }
 
-      lclimge[PQESSM] += scxcache[ox + ic].s * scycache[oy + ic].s * e;
-      lclimge[PQESCM] += scxcache[ox + ic].s * scycache[oy + ic].c * e;
-      lclimge[PQECSM] += scxcache[ox + ic].c * scycache[oy + ic].s * e;
-      lclimge[PQECCM] += scxcache[ox + ic].c * scycache[oy + ic].c * e;
+      lclimge[PQESSM] += ss * e;
+      lclimge[PQESCM] += sc * e;
+      lclimge[PQECSM] += cs * e;
+      lclimge[PQECCM] += cc * e;
     }
 
     ic++;
@@ -1082,9 +1093,8 @@ ElectrostaticLayerCorrection::ElectrostaticLayerCorrection(
   adapt_solver();
 }
 
-Utils::Vector3d elc_data::get_mi_vector(Utils::Vector3d const &a,
-                                        Utils::Vector3d const &b) const {
-  return box_geo.get_mi_vector(a, b);
+double elc_data::get_mi_coord_z(double a, double b) const {
+  return box_geo.get_mi_coord(a, b, 2u);
 }
 
 static void p3m_assign_image_charge(elc_data const &elc, CoulombP3M &p3m,
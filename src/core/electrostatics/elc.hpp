@@ -116,22 +116,32 @@ struct elc_data {
   /** The space that is finally left. */
   double space_box;
 
-  /// pairwise contributions from the lowest and top layers
+  /** @brief Pairwise contributions from the lowest and top layers.
+   *
+   *  An image charge differs from its source particle only in the
+   *  z-coordinate, so the x/y components of the minimum-image distance
+   *  to every image are those of the primary pair distance. The caller
+   *  passes them in @p dist_xy (as <tt>pos2 - pos1</tt>), computed once
+   *  per pair and shared by all image terms of both orientations; only
+   *  the z-component has to be folded per term. This runs inside the
+   *  near-field loop for every charge pair, so avoiding the redundant
+   *  full image-distance evaluations matters.
+   */
   template <typename Kernel>
   void dielectric_layers_contribution(CoulombP3M const &p3m,
                                       Utils::Vector3d const &pos1,
-                                      Utils::Vector3d const &pos2, double q1q2,
-                                      Kernel &&kernel) const {
+                                      Utils::Vector3d const &pos2,
+                                      Utils::Vector2d const &dist_xy,
+                                      double q1q2, Kernel &&kernel) const {
     if (pos1[2] < space_layer) {
       auto const q_eff = delta_mid_bot * q1q2;
-      auto const d = get_mi_vector(pos2, {pos1[0], pos1[1], -pos1[2]});
-      kernel(q_eff, d);
+      auto const dz = get_mi_coord_z(pos2[2], -pos1[2]);
+      kernel(q_eff, Utils::Vector3d{dist_xy[0], dist_xy[1], dz});
     }
     if (pos1[2] > (box_h - space_layer)) {
       auto const q_eff = delta_mid_top * q1q2;
-      auto const l = 2. * box_h;
-      auto const d = get_mi_vector(pos2, {pos1[0], pos1[1], l - pos1[2]});
-      kernel(q_eff, d);
+      auto const dz = get_mi_coord_z(pos2[2], 2. * box_h - pos1[2]);
+      kernel(q_eff, Utils::Vector3d{dist_xy[0], dist_xy[1], dz});
     }
   }
 
@@ -140,8 +150,9 @@ struct elc_data {
                                        ParticleRange const &particles) const {
     auto energy = 0.;
     for (auto const &p : particles) {
+      /* particle and image share the x/y coordinates */
       dielectric_layers_contribution(
-          p3m, p.pos(), p.pos(), Utils::sqr(p.q()),
+          p3m, p.pos(), p.pos(), Utils::Vector2d{0., 0.}, Utils::sqr(p.q()),
           [&](double q1q2, Utils::Vector3d const &d) {
             energy += p3m.pair_energy(q1q2, d.norm());
           });
@@ -154,7 +165,7 @@ struct elc_data {
                                      ParticleRange const &particles) const {
     for (auto &p : particles) {
       dielectric_layers_contribution(
-          p3m, p.pos(), p.pos(), Utils::sqr(p.q()),
+          p3m, p.pos(), p.pos(), Utils::Vector2d{0., 0.}, Utils::sqr(p.q()),
           [&](double q1q2, Utils::Vector3d const &d) {
             p.force() += p3m.pair_force(q1q2, d, d.norm());
           });
@@ -162,8 +173,7 @@ struct elc_data {
   }
 
 private:
-  Utils::Vector3d get_mi_vector(Utils::Vector3d const &a,
-                                Utils::Vector3d const &b) const;
+  double get_mi_coord_z(double a, double b) const;
 };
 
 struct ElectrostaticLayerCorrection
@@ -252,24 +262,33 @@ struct ElectrostaticLayerCorrection
     return {};
   }
 
-  /** @brief Calculate short-range pair energy correction. */
+  /** @brief Calculate short-range pair energy correction.
+   *  @param q1q2  Product of the particle charges.
+   *  @param p1    First particle.
+   *  @param p2    Second particle.
+   *  @param d     Minimum-image distance between the particles,
+   *               as <tt>pos1 - pos2</tt>; its x/y components are
+   *               shared with all image terms.
+   */
   double pair_energy_correction(double q1q2, Particle const &p1,
-                                Particle const &p2) const {
+                                Particle const &p2,
+                                Utils::Vector3d const &d) const {
     double energy = 0.;
     if (elc.dielectric_contrast_on) {
       energy = boost::apply_visitor(
-          [this, &p1, &p2, q1q2](auto &p3m_ptr) {
+          [this, &p1, &p2, q1q2, &d](auto &p3m_ptr) {
             auto const &pos1 = p1.pos();
             auto const &pos2 = p2.pos();
             auto const &p3m = *p3m_ptr;
+            auto const dist_xy = Utils::Vector2d{-d[0], -d[1]};
             auto energy = 0.;
             elc.dielectric_layers_contribution(
-                p3m, pos1, pos2, q1q2,
+                p3m, pos1, pos2, dist_xy, q1q2,
                 [&](double q_eff, Utils::Vector3d const &d) {
                   energy += p3m.pair_energy(q_eff, d.norm());
                 });
             elc.dielectric_layers_contribution(
-                p3m, pos2, pos1, q1q2,
+                p3m, pos2, pos1, -dist_xy, q1q2,
                 [&](double q_eff, Utils::Vector3d const &d) {
                   energy += p3m.pair_energy(q_eff, d.norm());
                 });
@@ -280,22 +299,30 @@ struct ElectrostaticLayerCorrection
     return energy;
   }
 
-  /** @brief Add short-range pair force corrections. */
-  void add_pair_force_corrections(Particle &p1, Particle &p2,
-                                  double q1q2) const {
+  /** @brief Add short-range pair force corrections.
+   *  @param p1    First particle.
+   *  @param p2    Second particle.
+   *  @param q1q2  Product of the particle charges.
+   *  @param d     Minimum-image distance between the particles,
+   *               as <tt>pos1 - pos2</tt>; its x/y components are
+   *               shared with all image terms.
+   */
+  void add_pair_force_corrections(Particle &p1, Particle &p2, double q1q2,
+                                  Utils::Vector3d const &d) const {
     if (elc.dielectric_contrast_on) {
       boost::apply_visitor(
-          [this, &p1, &p2, q1q2](auto &p3m_ptr) {
+          [this, &p1, &p2, q1q2, &d](auto &p3m_ptr) {
             auto const &pos1 = p1.pos();
             auto const &pos2 = p2.pos();
             auto const &p3m = *p3m_ptr;
+            auto const dist_xy = Utils::Vector2d{-d[0], -d[1]};
             elc.dielectric_layers_contribution(
-                p3m, pos1, pos2, q1q2,
+                p3m, pos1, pos2, dist_xy, q1q2,
                 [&](double q_eff, Utils::Vector3d const &d) {
                   p1.force() += p3m.pair_force(q_eff, d, d.norm());
                 });
             elc.dielectric_layers_contribution(
-                p3m, pos2, pos1, q1q2,
+                p3m, pos2, pos1, -dist_xy, q1q2,
                 [&](double q_eff, Utils::Vector3d const &d) {
                   p2.force() += p3m.pair_force(q_eff, d, d.norm());
                 });
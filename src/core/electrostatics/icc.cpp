@@ -44,6 +44,7 @@
 #include "event.hpp"
 #include "integrate.hpp"
 
+#include <utils/Vector.hpp>
 #include <utils/constants.hpp>
 
 #include <boost/mpi/collectives/all_reduce.hpp>
@@ -87,7 +88,7 @@ static void force_calc_icc(
           p2.force() -= force;
 #ifdef P3M
           if (elc_kernel_ptr) {
-            (*elc_kernel_ptr)(p1, p2, q1q2);
+            (*elc_kernel_ptr)(p1, p2, q1q2, d.vec21);
           }
 #endif // P3M
         }
@@ -114,6 +115,22 @@ void ICCStar::iteration(CellStructure &cell_structure,
   auto const elc_kernel = Coulomb::pair_force_elc_kernel();
   icc_cfg.citeration = 0;
 
+  auto const is_icc_particle = [this](Particle const &p) {
+    auto const pid = p.id();
+    return pid >= icc_cfg.first_id and pid < icc_cfg.n_icc + icc_cfg.first_id;
+  };
+
+  /* First-order Anderson acceleration of the damped fixed-point
+   * iteration: the induced charge densities and residuals of the
+   * previous inner iteration, indexed by ICC particle id. The initial
+   * guess is the induced charge carried over on the particles, i.e.
+   * the converged result of the previous time step. */
+  std::vector<double> density_prev(icc_cfg.n_icc);
+  std::vector<double> residual_prev(icc_cfg.n_icc);
+  std::vector<double> density_cur(icc_cfg.n_icc);
+  std::vector<double> residual_cur(icc_cfg.n_icc);
+  auto have_history = false;
+
   auto global_max_rel_diff = 0.;
 
   for (int j = 0; j < icc_cfg.max_iterations; j++) {
@@ -124,11 +141,10 @@ void ICCStar::iteration(CellStructure &cell_structure,
                    elc_kernel);
     cell_structure.ghosts_reduce_forces();
 
-    auto max_rel_diff = 0.;
-
-    for (auto &p : particles) {
-      auto const pid = p.id();
-      if (pid >= icc_cfg.first_id and pid < icc_cfg.n_icc + icc_cfg.first_id) {
+    /* first pass: evaluate the fixed-point residuals */
+    auto local_dots = Utils::Vector2d{};
+    for (auto const &p : particles) {
+      if (is_icc_particle(p)) {
         auto const id = p.id() - icc_cfg.first_id;
         /* the dielectric-related prefactor: */
         auto const eps_in = icc_cfg.epsilons[id];
@@ -152,11 +168,46 @@ void ICCStar::iteration(CellStructure &cell_structure,
             del_eps * pref * (local_e_field * icc_cfg.normals[id]) +
             2. * icc_cfg.eps_out / (icc_cfg.eps_out + icc_cfg.epsilons[id]) *
                 icc_cfg.sigmas[id];
+
+        density_cur[id] = charge_density_old;
+        residual_cur[id] = charge_density_update - charge_density_old;
+        if (have_history) {
+          auto const delta_f = residual_cur[id] - residual_prev[id];
+          local_dots[0] += residual_cur[id] * delta_f;
+          local_dots[1] += delta_f * delta_f;
+        }
+      }
+    }
+
+    /* secant gain of the Anderson mixing step; the plain damped update
+     * is recovered for gain zero (first iteration and degenerate cases) */
+    auto gain = 0.;
+    if (have_history) {
+      auto const dots = boost::mpi::all_reduce(comm_cart, local_dots,
+                                               std::plus<>());
+      if (dots[1] > 0.) {
+        /* safeguard against nearly linearly dependent residuals */
+        gain = std::clamp(dots[0] / dots[1], -0.9, 0.9);
+      }
+    }
+
+    /* second pass: mix and apply the new induced charges */
+    auto max_rel_diff = 0.;
+    for (auto &p : particles) {
+      if (is_icc_particle(p)) {
+        auto const id = p.id() - icc_cfg.first_id;
+        auto const charge_density_old = density_cur[id];
+        auto const relaxed_step =
+            charge_density_old + icc_cfg.relaxation * residual_cur[id];
         /* relative variation: never use an estimator which can be negative
          * here */
-        auto const charge_density_new =
-            (1. - icc_cfg.relaxation) * charge_density_old +
-            (icc_cfg.relaxation) * charge_density_update;
+        auto charge_density_new = relaxed_step;
+        if (gain != 0.) {
+          charge_density_new -=
+              gain * (density_cur[id] - density_prev[id] +
+                      icc_cfg.relaxation *
+                          (residual_cur[id] - residual_prev[id]));
+        }
 
         /* Take the largest error to check for convergence */
         auto const relative_difference =
@@ -182,6 +233,10 @@ void ICCStar::iteration(CellStructure &cell_structure,
       }
     }
 
+    std::swap(density_prev, density_cur);
+    std::swap(residual_prev, residual_cur);
+    have_history = true;
+
     /* Update charges on ghosts. */
     cell_structure.ghosts_update(Cells::DATA_PART_PROPERTIES);
 
@@ -227,6 +227,12 @@ Utils::Vector3d CoulombMMM1D::pair_force(double q1q2, Utils::Vector3d const &d,
     auto const rxy_d = rxy * box_geo.length_inv()[2];
     auto sr = 0., sz = 0.;
 
+    /* trigonometric factors of the higher harmonics follow from the
+     * angle addition theorem, saving the sin/cos calls per term */
+    auto const cos_z = cos(c_2pi * z_d);
+    auto const sin_z = sin(c_2pi * z_d);
+    auto cos_fq = cos_z;
+    auto sin_fq = sin_z;
     for (int bp = 1; bp < MAXIMAL_B_CUT; bp++) {
       if (bessel_radii[bp - 1] < rxy)
         break;
@@ -238,8 +244,12 @@ Utils::Vector3d CoulombMMM1D::pair_force(double q1q2, Utils::Vector3d const &d,
 #else
       auto const [k0, k1] = LPK01(fq * rxy_d);
 #endif
-      sr += bp * k1 * cos(fq * z_d);
-      sz += bp * k0 * sin(fq * z_d);
+      sr += bp * k1 * cos_fq;
+      sz += bp * k0 * sin_fq;
+
+      auto const cos_next = cos_fq * cos_z - sin_fq * sin_z;
+      sin_fq = sin_fq * cos_z + cos_fq * sin_z;
+      cos_fq = cos_next;
     }
     sr *= uz2 * 4. * c_2pi;
     sz *= uz2 * 4. * c_2pi;
@@ -301,12 +311,22 @@ double CoulombMMM1D::pair_energy(double const q1q2, Utils::Vector3d const &d,
     /* The first Bessel term will compensate a little bit the
        log term, so add them close together */
     energy = -0.25 * log(rxy2_d) + 0.5 * (Utils::ln_2() - Utils::gamma());
+    /* cosines of the higher harmonics via the angle addition theorem,
+     * cf. the far range formula in @ref CoulombMMM1D::pair_force */
+    auto const cos_z = cos(c_2pi * z_d);
+    auto const sin_z = sin(c_2pi * z_d);
+    auto cos_fq = cos_z;
+    auto sin_fq = sin_z;
     for (int bp = 1; bp < MAXIMAL_B_CUT; bp++) {
       if (bessel_radii[bp - 1] < rxy)
         break;
 
       auto const fq = c_2pi * bp;
-      energy += K0(fq * rxy_d) * cos(fq * z_d);
+      energy += K0(fq * rxy_d) * cos_fq;
+
+      auto const cos_next = cos_fq * cos_z - sin_fq * sin_z;
+      sin_fq = sin_fq * cos_z + cos_fq * sin_z;
+      cos_fq = cos_next;
     }
     energy *= 4. * box_geo.length_inv()[2];
   }
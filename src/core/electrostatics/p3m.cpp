@@ -355,13 +355,14 @@ template <std::size_t cao> struct AssignForces {
     for (auto &p : particles) {
       if (p.q() != 0.0) {
         auto const pref = p.q() * force_prefac;
-        auto const w = p3m.inter_weights.load<cao>(p_index);
 
         Utils::Vector3d force{};
-        p3m_interpolate(p3m.local_mesh, w, [&force, &p3m](int ind, double w) {
-          force += w * Utils::Vector3d{p3m.E_mesh[0][ind], p3m.E_mesh[1][ind],
-                                       p3m.E_mesh[2][ind]};
-        });
+        p3m_interpolate<cao>(p3m.local_mesh, p3m.inter_weights, p_index,
+                             [&force, &p3m](int ind, double w) {
+                               force += w * Utils::Vector3d{p3m.E_mesh[0][ind],
+                                                            p3m.E_mesh[1][ind],
+                                                            p3m.E_mesh[2][ind]};
+                             });
 
         p.force() -= pref * force;
         ++p_index;
@@ -466,7 +467,13 @@ double CoulombP3M::long_range_kernel(bool force_flag, bool energy_flag,
 
   /* === k-space force calculation  === */
   if (force_flag) {
-    /* sqrt(-1)*k differentiation */
+    /* sqrt(-1)*k differentiation: one backward FFT per force component.
+     * Analytic differentiation would need a single backward FFT of the
+     * potential mesh, with the gradient taken via the derivative of the
+     * assignment function at interpolation time. That trades the two
+     * extra transforms for a dedicated influence function (the aliasing
+     * sums differ from g_force), d/dx B-spline interpolation weights,
+     * and a self-force correction, and is less accurate at equal cao. */
     int j[3];
     int ind = 0;
     for (j[0] = 0; j[0] < p3m.fft.plan[3].new_mesh[0]; j[0]++) {
@@ -23,6 +23,17 @@
 /**
  * @file
  * P3M electrostatics on GPU.
+ *
+ * Only the far field is evaluated on the device; the near field runs
+ * through the CPU short-range loop like for the CPU solver, and the
+ * device forces are merged once per time step by
+ * @ref copy_forces_from_GPU. Since the far-field kernels are launched
+ * asynchronously before the short-range loop starts, the two parts
+ * already overlap. Moving the near field to the device as well would
+ * require a device-built cell list and a device path for all other
+ * short-range interactions, exclusions and bonds that share the loop,
+ * since a partial offload would still need the same particle data on
+ * the host.
  */
 
 #include "config/config.hpp"
@@ -362,36 +362,36 @@ void assign_charges(const CUDA_particle_data *const pdata, const P3MGpuData p) {
       3 * static_cast<std::size_t>(parts_per_block * cao) * sizeof(REAL_TYPE);
   switch (cao) {
   case 1:
-    (assign_charge_kernel<1, false>)<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    (assign_charge_kernel<1, false>)<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   case 2:
-    (assign_charge_kernel<2, false>)<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    (assign_charge_kernel<2, false>)<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   case 3:
     (assign_charge_kernel<
-        3, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        3, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   case 4:
     (assign_charge_kernel<
-        4, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        4, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   case 5:
     (assign_charge_kernel<
-        5, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        5, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   case 6:
     (assign_charge_kernel<
-        6, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        6, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   case 7:
     (assign_charge_kernel<
-        7, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        7, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, parts_per_block);
     break;
   default:
@@ -501,36 +501,36 @@ void assign_forces(const CUDA_particle_data *const pdata, const P3MGpuData p,
       3 * static_cast<std::size_t>(parts_per_block * cao) * sizeof(float);
   switch (cao) {
   case 1:
-    (assign_forces_kernel<1, false>)<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    (assign_forces_kernel<1, false>)<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   case 2:
-    (assign_forces_kernel<2, false>)<<<dim3(grid), dim3(block), 0, nullptr>>>(
+    (assign_forces_kernel<2, false>)<<<dim3(grid), dim3(block), 0, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   case 3:
     (assign_forces_kernel<
-        3, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        3, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   case 4:
     (assign_forces_kernel<
-        4, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        4, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   case 5:
     (assign_forces_kernel<
-        5, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        5, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   case 6:
     (assign_forces_kernel<
-        6, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        6, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   case 7:
     (assign_forces_kernel<
-        7, true>)<<<dim3(grid), dim3(block), data_length, nullptr>>>(
+        7, true>)<<<dim3(grid), dim3(block), data_length, stream[0]>>>(
         pdata, p, particle_force_gpu, prefactor, parts_per_block);
     break;
   default:
@@ -694,9 +694,18 @@ void p3m_gpu_add_farfield_force(double prefactor) {
       Utils::product(Utils::Vector3<REAL_TYPE>(p3m_gpu_data.box));
   auto const pref = static_cast<REAL_TYPE>(prefactor) / (volume * REAL_TYPE{2});
 
-  cuda_safe_mem(cudaMemset(p3m_gpu_data.charge_mesh, 0,
-                           static_cast<std::size_t>(p3m_gpu_data.mesh_size) *
-                               sizeof(REAL_TYPE)));
+  /* attach the plans to the stream of the particle data transfers, so the
+   * far field forms one dependency chain that can overlap with host-side
+   * work. This is done per call rather than at plan creation because
+   * cuda_set_device() recreates the stream, which would leave plans bound
+   * at init time holding a dangling stream handle. */
+  cufftSetStream(p3m_gpu_fft_plans.forw_plan, stream[0]);
+  cufftSetStream(p3m_gpu_fft_plans.back_plan, stream[0]);
+
+  cuda_safe_mem(cudaMemsetAsync(
+      p3m_gpu_data.charge_mesh, 0,
+      static_cast<std::size_t>(p3m_gpu_data.mesh_size) * sizeof(REAL_TYPE),
+      stream[0]));
 
   /* Interpolate the charges to the mesh */
   assign_charges(particles_gpu, p3m_gpu_data);
@@ -41,6 +41,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <string>
 
@@ -51,15 +52,21 @@ make_coulomb_scafacos(std::string const &method,
 }
 
 void CoulombScafacosImpl::update_particle_data() {
-  positions.clear();
-  charges.clear();
+  auto const particles = cell_structure.local_particles();
 
-  for (auto const &p : cell_structure.local_particles()) {
+  /* buffers are persistent members: the capacity acquired here is
+   * kept and reused across integration steps */
+  positions.resize(3ul * particles.size());
+  charges.resize(particles.size());
+
+  std::size_t j = 0ul;
+  for (auto const &p : particles) {
     auto const pos = folded_position(p.pos(), box_geo);
-    positions.push_back(pos[0]);
-    positions.push_back(pos[1]);
-    positions.push_back(pos[2]);
-    charges.push_back(p.q());
+    positions[3ul * j + 0ul] = pos[0];
+    positions[3ul * j + 1ul] = pos[1];
+    positions[3ul * j + 2ul] = pos[2];
+    charges[j] = p.q();
+    ++j;
   }
 }
 
@@ -91,6 +91,15 @@ int check_runtime_errors_local() {
   return runtimeErrorCollector->count(RuntimeError::ErrorLevel::ERROR);
 }
 
+/* This all-reduce runs once per integration step. It is the only point
+ * where a rank learns that another rank has failed, and the integrator
+ * must stop before the next force calculation touches state that the
+ * failing rank left inconsistent. Piggybacking the flag on the ghost
+ * force reduction would tie error detection to a round that only runs
+ * for some cell-structure and integrator combinations, and deferring
+ * the check to observable boundaries would keep integrating on broken
+ * state; an asynchronous scheme needs cancellable collectives (an
+ * MPI 4 feature) to preserve the prompt-abort semantics. */
 int check_runtime_errors(boost::mpi::communicator const &comm) {
   return boost::mpi::all_reduce(comm, check_runtime_errors_local(),
                                 std::plus<int>());
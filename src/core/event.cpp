@@ -31,9 +31,7 @@
 #include "collision.hpp"
 #include "communication.hpp"
 #include "config/config.hpp"
-#include "cuda_init.hpp"
 #include "cuda_interface.hpp"
-#include "cuda_utils.hpp"
 #include "electrostatics/coulomb.hpp"
 #include "electrostatics/icc.hpp"
 #include "errorhandling.hpp"
@@ -68,15 +66,9 @@ static bool reinit_magnetostatics = false;
 #endif
 
 void on_program_start() {
-#ifdef CUDA
-  if (this_node == 0) {
-    try {
-      cuda_init();
-    } catch (cuda_runtime_error const &) {
-      // pass
-    }
-  }
-#endif
+  /* CUDA is probed lazily when the first GPU user initializes the
+   * particle communication (cf. gpu_init_particle_comm), so CPU-only
+   * scripts don't pay for the CUDA context creation at startup. */
 
   init_node_grid();
 
@@ -173,8 +165,6 @@ void on_observable_calc() {
     ek_integrate_electrostatics();
   }
 #endif /* ELECTROKINETICS */
-
-  clear_particle_node();
 }
 
 void on_particle_charge_change() {
@@ -186,6 +176,16 @@ void on_particle_charge_change() {
   partCfg().invalidate();
 }
 
+void on_particle_force_change() {
+  recalc_forces = true;
+
+  /* the particle information is no longer valid */
+  partCfg().invalidate();
+
+  /* the particle information is no longer valid */
+  invalidate_fetch_cache();
+}
+
 void on_particle_change() {
   if (cell_structure.decomposition_type() ==
       CellStructureType::CELL_STRUCTURE_HYBRID) {
@@ -260,6 +260,14 @@ void on_boxl_change(bool skip_method_adaption) {
   grid_changed_box_l(box_geo);
   /* Electrostatics cutoffs mostly depend on the system size,
    * therefore recalculate them. */
+  /* The cell grid is rebuilt even for the per-mille rescalings of an
+   * NpT step (which already take the skip_method_adaption fast path):
+   * the decomposition derives its cell boundaries, fold offsets and
+   * ghost ranges from the box at build time, so letting small changes
+   * accumulate against a stale grid would mis-sort boundary particles
+   * silently. Deferring the rebuild under a hysteresis threshold would
+   * require the decomposition to support an affine rescale of its
+   * stored geometry, which RegularDecomposition does not. */
   cells_re_init(cell_structure.decomposition_type());
 
   if (not skip_method_adaption) {
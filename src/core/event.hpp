@@ -66,6 +66,14 @@ void on_particle_change();
 /** called every time the charge of a particle has changed. */
 void on_particle_charge_change();
 
+/** called every time a particle property changed that enters the force
+ *  calculation but affects neither the interaction topology nor the
+ *  charge bookkeeping of the long-range solvers, e.g. a velocity or an
+ *  external force. Unlike @ref on_particle_change, no resort is
+ *  scheduled and the solvers are not reinitialized.
+ */
+void on_particle_force_change();
+
 /** called every time the Coulomb parameters are changed.
 
 all Coulomb methods have a short range part, aka near field
@@ -21,6 +21,8 @@
 
 #include "utils/interpolation/bspline_3d.hpp"
 #include "utils/interpolation/bspline_3d_gradient.hpp"
+#include "utils/interpolation/detail/ll_and_dist.hpp"
+#include <utils/math/bspline.hpp>
 #include <utils/math/tensor_product.hpp>
 
 #include "jacobian_type.hpp"
@@ -76,6 +78,15 @@ private:
   storage_type m_global_field;
   Utils::Vector3d m_grid_spacing;
   Utils::Vector3d m_origin;
+  /** Support values of the interpolation cell of the last evaluation,
+   *  stored contiguously. Particles are traversed in cell order, so
+   *  consecutive evaluations usually fall into the same interpolation
+   *  cell and can reuse the tile instead of gathering the same support
+   *  points from the global field again.
+   */
+  mutable std::array<value_type, 8> m_tile;
+  mutable std::array<int, 3> m_tile_corner;
+  mutable bool m_tile_valid = false;
 
 public:
   Interpolated(const boost::const_multi_array_ref<value_type, 3> &global_field,
@@ -90,6 +101,7 @@ private:
 
     m_grid_spacing = rhs.m_grid_spacing;
     m_origin = rhs.m_origin;
+    m_tile_valid = false;
   }
 
 public:
@@ -116,11 +128,40 @@ public:
    * @brief Evaluate f at pos with the field value as argument.
    */
   value_type operator()(const Utils::Vector3d &pos, double = {}) const {
-    using Utils::Interpolation::bspline_3d_accumulate;
-    return bspline_3d_accumulate<2>(
-        pos,
-        [this](const std::array<int, 3> &ind) { return m_global_field(ind); },
-        m_grid_spacing, m_origin, value_type{});
+    auto const block = Utils::Interpolation::detail::ll_and_dist<2>(
+        pos, m_grid_spacing, m_origin);
+
+    if (!m_tile_valid or block.corner != m_tile_corner) {
+      auto it = m_tile.begin();
+      for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+          for (int k = 0; k < 2; k++)
+            *it++ = m_global_field(
+                std::array<int, 3>{{block.corner[0] + i, block.corner[1] + j,
+                                    block.corner[2] + k}});
+      m_tile_corner = block.corner;
+      m_tile_valid = true;
+    }
+
+    /* Separable interpolation weights; the accumulation runs over the
+     * contiguous tile, so the compiler can vectorize it. */
+    std::array<double, 2> w_x, w_y, w_z;
+    for (int i = 0; i < 2; i++) {
+      w_x[i] = Utils::bspline<2>(i, block.distance[0]);
+      w_y[i] = Utils::bspline<2>(i, block.distance[1]);
+      w_z[i] = Utils::bspline<2>(i, block.distance[2]);
+    }
+
+    value_type value{};
+    auto it = m_tile.cbegin();
+    for (int i = 0; i < 2; i++)
+      for (int j = 0; j < 2; j++) {
+        auto const w_xy = w_x[i] * w_y[j];
+        for (int k = 0; k < 2; k++)
+          value += (w_xy * w_z[k]) * *it++;
+      }
+
+    return value;
   }
 
   /*
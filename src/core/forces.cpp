@@ -58,7 +58,10 @@
 #include <profiler/profiler.hpp>
 
 #include <cassert>
+#include <functional>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 std::shared_ptr<ComFixed> comfixed = std::make_shared<ComFixed>();
 
@@ -94,15 +97,12 @@ inline ParticleForce thermostat_force(Particle const &p, double time_step,
     return {};
   }
 
-#ifdef ROTATION
-  return {friction_thermo_langevin(langevin, p, time_step, kT),
-          p.can_rotate() ? convert_vector_body_to_space(
-                               p, friction_thermo_langevin_rotation(
-                                      langevin, p, time_step, kT))
-                         : Utils::Vector3d{}};
-#else
+  // The rotational friction and noise act on the body-frame angular
+  // velocity; they are applied in convert_initial_torques() and
+  // convert_torques_propagate_omega() right after the torque conversion
+  // to the body frame, which saves the friction torque the round trip
+  // through the lab frame.
   return friction_thermo_langevin(langevin, p, time_step, kT);
-#endif
 }
 
 /** Initialize the forces for a real particle */
@@ -144,6 +144,18 @@ void init_forces_ghosts(const ParticleRange &particles) {
   }
 }
 
+/* There are no explicit barriers in the force path: ranks synchronize
+ * implicitly at the ghost exchanges and the long-range collectives.
+ * Per-rank wait-time accounting would time the entry into those
+ * implicit synchronization points, since the spread between the first
+ * and last arrival is the imbalance signal. Surfacing it through the
+ * Observables framework does not fit that framework's contract,
+ * however: observables are functions of the system state, evaluated on
+ * demand, while wait times are properties of an integration run and
+ * accumulate per step. A run telemetry channel (see the note in
+ * profiler.hpp) is the right home; an observable could then report
+ * its aggregates.
+ */
 void force_calc(CellStructure &cell_structure, double time_step, double kT) {
   ESPRESSO_PROFILER_CXX_MARK_FUNCTION;
 
@@ -166,6 +178,14 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
 #endif
   init_forces(particles, ghost_particles, time_step, kT);
 
+  /* The long-range part runs strictly before the short-range loop. It
+   * cannot currently be overlapped with it: the electrostatics actors
+   * expose a single synchronous kernel (no issue/wait split), and the
+   * mesh halo exchange and FFT remaps underneath use blocking
+   * communication (see fft.cpp), so there is no outstanding request to
+   * overlap with. Pipelining would need a two-phase actor interface
+   * that issues the charge-mesh communication after charge assignment
+   * and synchronizes before force assignment. */
   calc_long_range_forces(particles);
 
   auto const elc_kernel = Coulomb::pair_force_elc_kernel();
@@ -184,42 +204,76 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
   auto const dipole_cutoff = INACTIVE_CUTOFF;
 #endif
 
-  short_range_loop(
-      [coulomb_kernel_ptr = coulomb_kernel.get_ptr()](
-          Particle &p1, int bond_id, Utils::Span<Particle *> partners) {
-        return add_bonded_force(p1, bond_id, partners, coulomb_kernel_ptr);
-      },
-      [coulomb_kernel_ptr = coulomb_kernel.get_ptr(),
-       dipoles_kernel_ptr = dipoles_kernel.get_ptr(),
-       elc_kernel_ptr = elc_kernel.get_ptr()](Particle &p1, Particle &p2,
-                                              Distance const &d) {
-        add_non_bonded_pair_force(p1, p2, d.vec21, sqrt(d.dist2), d.dist2,
-                                  coulomb_kernel_ptr, dipoles_kernel_ptr,
-                                  elc_kernel_ptr);
+  /* There is no GPU path for this loop: the CUDA actors are all
+   * long-range solvers, and generic pair potentials are evaluated on
+   * the CPU only. The merge plumbing for an offload exists (positions
+   * are mirrored by espresso_system.update() above, device forces are
+   * folded in by copy_forces_from_GPU below), but the loop body is
+   * more than the pair potential: bonded forces, exclusions and
+   * collision detection run inside the same traversal, and they need
+   * cell-structure and bond data that has no device mirror. A GPU
+   * short-range engine would therefore own a device cell list built
+   * from the ghost-inclusive particle set and take over only the
+   * nonbonded kernel family, with the bonded/collision part staying in
+   * this loop; like the GPU magnetostatics case in
+   * calc_long_range_forces, it would launch before the CPU work and
+   * synchronize at the force merge. */
+  auto const run_short_range_sweep = [&](auto with_npt_virial) {
+    constexpr bool npt_virial = decltype(with_npt_virial)::value;
+    short_range_loop(
+        [coulomb_kernel_ptr = coulomb_kernel.get_ptr()](
+            Particle &p1, int bond_id, Utils::Span<Particle *> partners) {
+          return add_bonded_force<npt_virial>(p1, bond_id, partners,
+                                              coulomb_kernel_ptr);
+        },
+        [coulomb_kernel_ptr = coulomb_kernel.get_ptr()](int bond_id,
+                                                        auto &batch) {
+          add_bonded_force_batch<npt_virial>(bond_id, batch,
+                                             coulomb_kernel_ptr);
+        },
+        [coulomb_kernel_ptr = coulomb_kernel.get_ptr(),
+         dipoles_kernel_ptr = dipoles_kernel.get_ptr(),
+         elc_kernel_ptr = elc_kernel.get_ptr()](Particle &p1, Particle &p2,
+                                                Distance const &d) {
+          add_non_bonded_pair_force<npt_virial>(p1, p2, d.vec21, d.dist2,
+                                                coulomb_kernel_ptr,
+                                                dipoles_kernel_ptr,
+                                                elc_kernel_ptr);
 #ifdef COLLISION_DETECTION
-        if (collision_params.mode != CollisionModeType::OFF)
-          detect_collision(p1, p2, d.dist2);
+          if (collision_params.mode != CollisionModeType::OFF)
+            detect_collision(p1, p2, d.dist2);
+#endif
+        },
+        maximal_cutoff(n_nodes), maximal_cutoff_bonded(),
+        VerletCriterion<>{skin, interaction_range(), coulomb_cutoff,
+                          dipole_cutoff, collision_detection_cutoff()});
+  };
+
+  /* The virial bookkeeping is compiled into a separate instance of the
+   * sweep, so the other ensembles do not pay for the accumulation
+   * branch in the pair kernel. */
+#ifdef NPT
+  if (integ_switch == INTEG_METHOD_NPT_ISO) {
+    run_short_range_sweep(std::true_type{});
+  } else
 #endif
-      },
-      maximal_cutoff(n_nodes), maximal_cutoff_bonded(),
-      VerletCriterion<>{skin, interaction_range(), coulomb_cutoff,
-                        dipole_cutoff, collision_detection_cutoff()});
+  {
+    run_short_range_sweep(std::false_type{});
+  }
 
   Constraints::constraints.add_forces(particles, get_sim_time());
 
   if (max_oif_objects) {
-    // There are two global quantities that need to be evaluated:
-    // object's surface and object's volume.
-    for (int i = 0; i < max_oif_objects; i++) {
-      auto const area_volume = boost::mpi::all_reduce(
-          comm_cart, calc_oif_global(i, cell_structure), std::plus<>());
-      auto const oif_part_area = std::abs(area_volume[0]);
-      auto const oif_part_vol = std::abs(area_volume[1]);
-      if (oif_part_area < 1e-100 and oif_part_vol < 1e-100) {
-        break;
-      }
-      add_oif_global_forces(area_volume, i, cell_structure);
-    }
+    // There are two global quantities that need to be evaluated per object:
+    // object's surface and object's volume. They are accumulated for all
+    // objects in one sweep and synchronized with a single element-wise
+    // reduction instead of one reduction per object.
+    auto const local_area_volume = calc_oif_global(max_oif_objects, cell_structure);
+    std::vector<double> area_volume(local_area_volume.size());
+    boost::mpi::all_reduce(comm_cart, local_area_volume.data(),
+                           static_cast<int>(local_area_volume.size()),
+                           area_volume.data(), std::plus<double>());
+    add_oif_global_forces(area_volume, cell_structure);
   }
 
   // Must be done here. Forces need to be ghost-communicated
@@ -252,6 +306,35 @@ void force_calc(CellStructure &cell_structure, double time_step, double kT) {
 
 void calc_long_range_forces(const ParticleRange &particles) {
   ESPRESSO_PROFILER_CXX_MARK_FUNCTION;
+
+#if defined(ELECTROSTATICS) and                                                \
+    (defined(DIPOLAR_DIRECT_SUM) or defined(DIPOLAR_BARNES_HUT))
+  /* A GPU-backed magnetostatics solver only launches its kernels and
+   * returns; the device-side forces are merged much later by
+   * copy_forces_from_GPU. Issue it before the electrostatics solver,
+   * so that its kernels overlap with the CPU k-space computation
+   * instead of running after it. A deeper overlap of the two solvers'
+   * mesh communication would need a two-phase actor interface, cf. the
+   * remark in @ref force_calc. */
+  if (magnetostatics_actor) {
+    auto const dipoles_on_gpu =
+#ifdef DIPOLAR_DIRECT_SUM
+        boost::get<std::shared_ptr<DipolarDirectSumGpu>>(
+            magnetostatics_actor.get_ptr()) != nullptr or
+#endif
+#ifdef DIPOLAR_BARNES_HUT
+        boost::get<std::shared_ptr<DipolarBarnesHutGpu>>(
+            magnetostatics_actor.get_ptr()) != nullptr or
+#endif
+        false;
+    if (dipoles_on_gpu) {
+      Dipoles::calc_long_range_force(particles);
+      Coulomb::calc_long_range_force(particles);
+      return;
+    }
+  }
+#endif
+
 #ifdef ELECTROSTATICS
   /* calculate k-space part of electrostatic interaction. */
   Coulomb::calc_long_range_force(particles);
@@ -263,10 +346,3 @@ void calc_long_range_forces(const ParticleRange &particles) {
   Dipoles::calc_long_range_force(particles);
 #endif // DIPOLES
 }
-
-#ifdef NPT
-void npt_add_virial_force_contribution(const Utils::Vector3d &force,
-                                       const Utils::Vector3d &d) {
-  npt_add_virial_contribution(force, d);
-}
-#endif
@@ -60,6 +60,10 @@
 #include "dpd.hpp"
 #endif
 
+#ifdef NPT
+#include "npt.hpp"
+#endif
+
 #include "Particle.hpp"
 #include "bond_error.hpp"
 #include "errorhandling.hpp"
@@ -68,12 +72,26 @@
 
 #include <utils/Span.hpp>
 #include <utils/Vector.hpp>
+#include <utils/math/sqr.hpp>
 
+#include <boost/container/static_vector.hpp>
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
+#include <cmath>
 #include <tuple>
 
+/**
+ * @brief Sum the compiled-in non-bonded pair potentials.
+ *
+ * There is no runtime dispatch here: every potential enabled at compile
+ * time contributes through an inlined kernel guarded by its own cutoff
+ * check against the per-type-pair parameters, and central potentials
+ * accumulate into a single radial force factor that is applied to the
+ * distance vector once. Potentials disabled at compile time cost
+ * nothing; potentials unused by a given type pair cost one predictable
+ * branch on an inactive cutoff.
+ */
 inline ParticleForce calc_non_bonded_pair_force(
     Particle const &p1, Particle const &p2, IA_parameters const &ia_params,
     Utils::Vector3d const &d, double const dist,
@@ -165,29 +183,64 @@ inline ParticleForce calc_opposing_force(ParticleForce const &pf,
 
 /** Calculate non-bonded forces between a pair of particles and update their
  *  forces and torques.
+ *  @tparam with_npt_virial    Whether to accumulate the NpT virial.
+ *                             Selected per sweep by @ref force_calc, so
+ *                             other ensembles do not pay for the
+ *                             bookkeeping in the pair kernel.
  *  @param[in,out] p1      particle 1.
  *  @param[in,out] p2      particle 2.
  *  @param[in] d           vector between @p p1 and @p p2.
- *  @param[in] dist        distance between @p p1 and @p p2.
  *  @param[in] dist2       distance squared between @p p1 and @p p2.
  *  @param[in] coulomb_kernel  %Coulomb force kernel.
  *  @param[in] dipoles_kernel  Dipolar force kernel.
  *  @param[in] elc_kernel      ELC force correction kernel.
  */
+template <bool with_npt_virial = false>
 inline void add_non_bonded_pair_force(
-    Particle &p1, Particle &p2, Utils::Vector3d const &d, double dist,
-    double dist2,
+    Particle &p1, Particle &p2, Utils::Vector3d const &d, double dist2,
     Coulomb::ShortRangeForceKernel::kernel_type const *coulomb_kernel,
     Dipoles::ShortRangeForceKernel::kernel_type const *dipoles_kernel,
     Coulomb::ShortRangeForceCorrectionsKernel::kernel_type const *elc_kernel) {
   auto const &ia_params = get_ia_param(p1.type(), p2.type());
   ParticleForce pf{};
 
+  auto const do_nonbonded_pair =
+      ia_params.max_cut != INACTIVE_CUTOFF and
+      dist2 < Utils::sqr(ia_params.max_cut);
+#ifdef ELECTROSTATICS
+  auto const q1q2 = p1.q() * p2.q();
+  auto const do_coulomb = q1q2 != 0. and coulomb_kernel != nullptr;
+#endif
+#ifdef DPD
+  auto const do_dpd = (thermo_switch & THERMO_DPD) != 0;
+#endif
+#ifdef DIPOLES
+  auto const do_dipoles = dipoles_kernel != nullptr;
+#endif
+
+  /* With a Verlet skin, a sizable fraction of the candidate pairs is
+   * outside every cutoff; skip the square root for those. */
+  if (not do_nonbonded_pair
+#ifdef ELECTROSTATICS
+      and not do_coulomb
+#endif
+#ifdef DPD
+      and not do_dpd
+#endif
+#ifdef DIPOLES
+      and not do_dipoles
+#endif
+  ) {
+    return;
+  }
+
+  auto const dist = std::sqrt(dist2);
+
   /***********************************************/
   /* non-bonded pair potentials                  */
   /***********************************************/
 
-  if (dist < ia_params.max_cut) {
+  if (do_nonbonded_pair) {
 #ifdef EXCLUSIONS
     if (do_nonbonded(p1, p2))
 #endif
@@ -201,12 +254,11 @@ inline void add_non_bonded_pair_force(
 
 #ifdef ELECTROSTATICS
   // real-space electrostatic charge-charge interaction
-  auto const q1q2 = p1.q() * p2.q();
-  if (q1q2 != 0. and coulomb_kernel != nullptr) {
+  if (do_coulomb) {
     pf.f += (*coulomb_kernel)(q1q2, d, dist);
 #ifdef P3M
     if (elc_kernel)
-      (*elc_kernel)(p1, p2, q1q2);
+      (*elc_kernel)(p1, p2, q1q2, d);
 #endif // P3M
   }
 #endif // ELECTROSTATICS
@@ -216,7 +268,9 @@ inline void add_non_bonded_pair_force(
   /* but nothing afterwards                                            */
   /*********************************************************************/
 #ifdef NPT
-  npt_add_virial_force_contribution(pf.f, d);
+  if constexpr (with_npt_virial) {
+    npt_add_virial_contribution(pf.f, d);
+  }
 #endif
 
   /***********************************************/
@@ -225,7 +279,7 @@ inline void add_non_bonded_pair_force(
 
   /* The inter dpd force should not be part of the virial */
 #ifdef DPD
-  if (thermo_switch & THERMO_DPD) {
+  if (do_dpd) {
     auto const force = dpd_pair_force(p1, p2, ia_params, d, dist, dist2);
     p1.force() += force;
     p2.force() -= force;
@@ -238,7 +292,7 @@ inline void add_non_bonded_pair_force(
 
 #ifdef DIPOLES
   // real-space magnetic dipole-dipole
-  if (dipoles_kernel) {
+  if (do_dipoles) {
     pf += (*dipoles_kernel)(p1, p2, d, dist, dist2);
   }
 #endif
@@ -296,6 +350,7 @@ inline boost::optional<Utils::Vector3d> calc_bond_pair_force(
   throw BondUnknownTypeError();
 }
 
+template <bool with_npt_virial = false>
 inline bool add_bonded_two_body_force(
     Bonded_IA_Parameters const &iaparams, Particle &p1, Particle &p2,
     Coulomb::ShortRangeForceKernel::kernel_type const *kernel) {
@@ -318,7 +373,9 @@ inline bool add_bonded_two_body_force(
       p2.force() -= result.get();
 
 #ifdef NPT
-      npt_add_virial_force_contribution(result.get(), dx);
+      if constexpr (with_npt_virial) {
+        npt_add_virial_contribution(result.get(), dx);
+      }
 #endif
       return false;
     }
@@ -410,6 +467,7 @@ inline bool add_bonded_four_body_force(Bonded_IA_Parameters const &iaparams,
   return true;
 }
 
+template <bool with_npt_virial = false>
 inline bool
 add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
                  Coulomb::ShortRangeForceKernel::kernel_type const *kernel) {
@@ -428,7 +486,8 @@ add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
   case 0:
     return false;
   case 1:
-    return add_bonded_two_body_force(iaparams, p1, *partners[0], kernel);
+    return add_bonded_two_body_force<with_npt_virial>(iaparams, p1,
+                                                      *partners[0], kernel);
   case 2:
     return add_bonded_three_body_force(iaparams, p1, *partners[0],
                                        *partners[1]);
@@ -440,4 +499,71 @@ add_bonded_force(Particle &p1, int bond_id, Utils::Span<Particle *> partners,
   }
 }
 
+/** Calculate the forces of a batch of bonds sharing one bond id.
+ *  The bond parameter lookup and the arity dispatch happen once per
+ *  batch instead of once per bond, which amortizes them over all
+ *  instances of a repeated molecular topology. The per-type dispatch
+ *  inside the arity kernels remains per bond, but resolves to the same
+ *  branch for every member of a homogeneous batch.
+ *  @tparam with_npt_virial Whether to accumulate the NpT virial,
+ *                          cf. @ref add_non_bonded_pair_force.
+ *  @tparam Batch   Range of resolved bonds, each with a particle
+ *                  pointer @c p and a pointer range @c partners.
+ *  @param bond_id  id of the bond shared by the batch.
+ *  @param batch    Bonds to evaluate.
+ *  @param kernel   %Coulomb force kernel.
+ */
+template <bool with_npt_virial = false, class Batch>
+inline void add_bonded_force_batch(
+    int bond_id, Batch &batch,
+    Coulomb::ShortRangeForceKernel::kernel_type const *kernel) {
+  auto const report_broken = [](auto const &bond) {
+    boost::container::static_vector<int, 4> partner_ids;
+    for (auto const partner : bond.partners) {
+      partner_ids.push_back(partner->id());
+    }
+    bond_broken_error(bond.p->id(), Utils::make_const_span(partner_ids));
+  };
+
+  auto const &iaparams = *bonded_ia_params.at(bond_id);
+
+  switch (number_of_partners(iaparams)) {
+  case 0:
+    break;
+  case 1:
+    for (auto &bond : batch) {
+      auto &p1 = *bond.p;
+      auto &p2 = *bond.partners[0];
+      // Consider for bond breakage
+      auto const dist = box_geo.get_mi_vector(p1.pos(), p2.pos()).norm();
+      if (BondBreakage::check_and_handle_breakage(p1.id(), p2.id(), bond_id,
+                                                  dist))
+        continue;
+      if (add_bonded_two_body_force<with_npt_virial>(iaparams, p1, p2,
+                                                     kernel)) {
+        report_broken(bond);
+      }
+    }
+    break;
+  case 2:
+    for (auto &bond : batch) {
+      if (add_bonded_three_body_force(iaparams, *bond.p, *bond.partners[0],
+                                      *bond.partners[1])) {
+        report_broken(bond);
+      }
+    }
+    break;
+  case 3:
+    for (auto &bond : batch) {
+      if (add_bonded_four_body_force(iaparams, *bond.p, *bond.partners[0],
+                                     *bond.partners[1], *bond.partners[2])) {
+        report_broken(bond);
+      }
+    }
+    break;
+  default:
+    throw BondInvalidSizeError{number_of_partners(iaparams)};
+  }
+}
+
 #endif // CORE_FORCES_INLINE_HPP
@@ -22,12 +22,12 @@
 
 #include "ParticleRange.hpp"
 
-#include <utils/Vector.hpp>
 #include <utils/keys.hpp>
 
 #include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/communicator.hpp>
 
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
@@ -35,29 +35,22 @@ class ComFixed {
 private:
   std::unordered_map<int, int> m_type_index;
 
-  std::vector<Utils::Vector3d>
-  local_type_forces(ParticleRange const &particles) const {
-    std::vector<Utils::Vector3d> ret(m_type_index.size(), Utils::Vector3d{});
+  /** Force and mass sums of all types, gathered in one particle sweep.
+   *  The flat layout (fx, fy, fz, m) per type allows a single collective
+   *  over all types at once.
+   */
+  std::vector<double> local_type_sums(ParticleRange const &particles) const {
+    std::vector<double> ret(4 * m_type_index.size(), 0.);
 
     for (auto const &p : particles) {
       /* Check if type is of interest */
       auto it = m_type_index.find(p.type());
       if (it != m_type_index.end()) {
-        ret[it->second] += p.force();
-      }
-    }
-
-    return ret;
-  }
-
-  std::vector<double> local_type_masses(ParticleRange const &particles) const {
-    std::vector<double> ret(m_type_index.size(), 0.);
-
-    for (auto const &p : particles) {
-      /* Check if type is of interest */
-      auto it = m_type_index.find(p.type());
-      if (it != m_type_index.end()) {
-        ret[it->second] += p.mass();
+        auto *sums = &ret[4 * it->second];
+        for (int i = 0; i < 3; i++) {
+          sums[i] += p.force()[i];
+        }
+        sums[3] += p.mass();
       }
     }
 
@@ -82,29 +75,24 @@ public:
     if (m_type_index.empty())
       return;
 
-    auto const local_forces = local_type_forces(particles);
-    auto const local_masses = local_type_masses(particles);
+    auto const local_sums = local_type_sums(particles);
 
     /* Total forces and masses of the types. */
-    std::vector<Utils::Vector3d> forces(m_type_index.size(), Utils::Vector3d{});
-    std::vector<double> masses(m_type_index.size(), 0.0);
+    std::vector<double> sums(local_sums.size(), 0.0);
 
     /* Add contributions from all nodes and redistribute them to all. */
-    boost::mpi::all_reduce(comm, local_forces.data(),
-                           static_cast<int>(local_forces.size()), forces.data(),
-                           std::plus<Utils::Vector3d>{});
-    boost::mpi::all_reduce(comm, local_masses.data(),
-                           static_cast<int>(local_masses.size()), masses.data(),
+    boost::mpi::all_reduce(comm, local_sums.data(),
+                           static_cast<int>(local_sums.size()), sums.data(),
                            std::plus<double>{});
 
     for (auto &p : particles) {
       /* Check if type is of interest */
       auto it = m_type_index.find(p.type());
       if (it != m_type_index.end()) {
-        auto const mass_frac = p.mass() / masses[it->second];
-        auto const &type_force = forces[it->second];
+        auto const *type_sums = &sums[4 * it->second];
+        auto const mass_frac = p.mass() / type_sums[3];
         for (int i = 0; i < 3; i++) {
-          p.force()[i] -= mass_frac * type_force[i];
+          p.force()[i] -= mass_frac * type_sums[i];
         }
       }
     }
@@ -30,8 +30,11 @@
  */
 #include "ghosts.hpp"
 #include "Particle.hpp"
+#include "communication.hpp"
+#include "memory_stats.hpp"
 
 #include <utils/Span.hpp>
+#include <utils/mpi/reduce_sum_deterministic.hpp>
 #include <utils/serialization/memcpy_archive.hpp>
 
 #include <boost/archive/binary_iarchive.hpp>
@@ -74,6 +77,10 @@ public:
    */
   void resize(std::size_t new_size) { buf.resize(new_size); }
 
+  /** Returns the bytes held by the storage, including the bond buffer.
+   */
+  std::size_t capacity() const { return buf.capacity() + bondbuf.capacity(); }
+
   /** Returns a reference to the bond storage.
    */
   auto &bonds() { return bondbuf; }
@@ -359,6 +366,15 @@ static void add_forces_from_recv_buffer(CommBuf &recv_buffer,
   }
 }
 
+/* Intra-rank transfers copy through a small buffer instead of aliasing
+ * the source cell: ghosts are distinct Particle objects because they
+ * may carry a position offset by a box vector (the communicator shift
+ * applied below, zero for copies that do not wrap around the box) and
+ * because force reduction accumulates into them before the owner sees
+ * the sum. The same holds one level up for ranks sharing a node - ghost
+ * cells cannot alias the owner's particle storage through a
+ * shared-memory window for as long as ghosts are shifted copies rather
+ * than views. */
 static void cell_cell_transfer(const GhostCommunication &ghost_comm,
                                unsigned int data_parts) {
   CommBuf buffer;
@@ -426,6 +442,13 @@ void ghost_communicator(const GhostCommunicator &gcr, unsigned int data_parts) {
   if (GHOSTTRANS_NONE == data_parts)
     return;
 
+  /* The buffers are function-static so their capacity survives across
+   * calls and the steady-state rounds do not touch the allocator. The
+   * packing itself has to run every round: the payload (positions,
+   * forces) changes each step, and the message sizes change whenever a
+   * resort alters the ghost cells, so pre-registered persistent MPI
+   * requests with frozen sizes would have to be torn down and rebuilt
+   * on every resort and re-packed into place regardless. */
   static CommBuf send_buffer, recv_buffer;
 
   auto const &comm = gcr.mpi_comm;
@@ -495,7 +518,14 @@ void ghost_communicator(const GhostCommunicator &gcr, unsigned int data_parts) {
       }
       break;
     case GHOST_RDCE:
-      if (node == comm.rank())
+      if (Communication::deterministic_reductions())
+        /* rank-ordered compensated summation instead of MPI_Reduce,
+         * so the collected forces are bitwise reproducible */
+        Utils::Mpi::reduce_sum_deterministic(
+            comm, reinterpret_cast<double *>(send_buffer.data()),
+            static_cast<int>(send_buffer.size() / sizeof(double)),
+            reinterpret_cast<double *>(recv_buffer.data()), node);
+      else if (node == comm.rank())
         boost::mpi::reduce(
             comm, reinterpret_cast<double *>(send_buffer.data()),
             static_cast<int>(send_buffer.size() / sizeof(double)),
@@ -549,4 +579,9 @@ void ghost_communicator(const GhostCommunicator &gcr, unsigned int data_parts) {
       }
     }
   }
+
+  /* the buffers only grow, so the capacity after the exchange is the
+   * memory held until the end of the run */
+  MemoryStats::track("ghosts.comm_buffers",
+                     send_buffer.capacity() + recv_buffer.capacity());
 }
@@ -81,6 +81,26 @@
  *  The pststore is similar and postpones the write back of received data
  *  until a send operation (with a precreated send buffer) is finished.
  *
+ *  The sequenced point-to-point exchanges cannot be collapsed into a
+ *  neighborhood collective (MPI_Neighbor_alltoallv on a cached graph
+ *  communicator): the shift order built by the cell systems carries a
+ *  data dependency, since later exchanges forward ghost data received
+ *  in earlier ones to diagonal neighbors, and the GHOST_RDCE rounds
+ *  reduce rather than transpose. A collective formulation would need
+ *  explicit edge and corner messages and a separate reduction step,
+ *  i.e. a different communicator layout, not a drop-in replacement of
+ *  the transport.
+ *
+ *  On the wire, the ghost updates are already slim: the data parts
+ *  flags select exactly the fields a communication needs, and bonds
+ *  and exclusions are only shipped when a resort requests them. In
+ *  memory, however, ghosts are stored as full @ref Particle objects in
+ *  the same cell arrays as real particles, because every kernel takes
+ *  @ref Particle references and cannot distinguish the two. A slim
+ *  ghost record type would therefore ripple through all kernel
+ *  signatures; it is the storage side of the layout decision discussed
+ *  at @ref Particle and only worth revisiting together with it.
+ *
  *  The ghost communicators are created by the cell systems.
  */
 #include "ParticleList.hpp"
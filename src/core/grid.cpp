@@ -35,8 +35,10 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <vector>
 
 BoxGeometry box_geo;
 LocalBox<double> local_geo;
@@ -113,3 +115,44 @@ void set_box_length(Utils::Vector3d const &value) {
   ::box_geo.set_length(value);
   on_boxl_change();
 }
+
+std::vector<NodeGridCandidate> suggest_node_grids(int n_nodes,
+                                                  Utils::Vector3d const &box_l,
+                                                  double range) {
+  assert(n_nodes >= 1);
+  assert(range > 0.);
+  std::vector<NodeGridCandidate> candidates;
+
+  for (int nx = 1; nx <= n_nodes; ++nx) {
+    if (n_nodes % nx != 0)
+      continue;
+    for (int ny = 1; ny <= n_nodes / nx; ++ny) {
+      if ((n_nodes / nx) % ny != 0)
+        continue;
+      auto const nz = n_nodes / (nx * ny);
+      auto const grid = Utils::Vector3i{nx, ny, nz};
+      auto const local_box_l = Utils::hadamard_division(box_l, grid);
+
+      auto const volume = Utils::product(local_box_l);
+      auto ghost_volume = -volume;
+      auto surface = 0.;
+      auto n_messages = 0;
+      for (int dir = 0; dir < 3; ++dir) {
+        surface += 2. * volume / local_box_l[dir];
+        if (grid[dir] > 1)
+          n_messages += 2;
+      }
+      ghost_volume += Utils::product(
+          local_box_l + Utils::Vector3d::broadcast(2. * range));
+
+      candidates.push_back(
+          {grid, ghost_volume, surface / volume, n_messages});
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [](NodeGridCandidate const &a, NodeGridCandidate const &b) {
+              return a.ghost_volume < b.ghost_volume;
+            });
+  return candidates;
+}
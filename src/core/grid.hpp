@@ -38,6 +38,8 @@
 
 #include <boost/mpi/communicator.hpp>
 
+#include <vector>
+
 extern BoxGeometry box_geo;
 extern LocalBox<double> local_geo;
 
@@ -109,4 +111,39 @@ LocalBox<double> regular_decomposition(const BoxGeometry &box,
 void set_node_grid(Utils::Vector3i const &value);
 void set_box_length(Utils::Vector3d const &value);
 
+/** @brief Predicted communication cost of a node grid candidate. */
+struct NodeGridCandidate {
+  /** Number of nodes in each spatial direction. */
+  Utils::Vector3i node_grid;
+  /** Volume of the ghost layer around one local box. */
+  double ghost_volume;
+  /** Surface-to-volume ratio of the local box. */
+  double surface_to_volume;
+  /** Ghost exchanges per rank and communication round; dimensions with
+   *  a single node are handled by local copies instead of messages. */
+  int n_messages;
+};
+
+/**
+ * @brief Enumerate node grids for a given number of nodes and predict
+ * their communication cost.
+ *
+ * All factorizations of @p n_nodes into three factors are considered.
+ * The predicted ghost volume assumes a ghost layer of width @p range
+ * around the local box, i.e. a cell size of at least the interaction
+ * range; the real ghost volume is quantized to whole cell rows, but the
+ * ranking of the candidates is insensitive to that. Candidates are
+ * returned in order of ascending ghost volume; the first entry is the
+ * advised grid, the full list allows trading message count against
+ * ghost volume or test-driving the best few with timed integration
+ * steps via @ref set_node_grid.
+ *
+ * @param n_nodes Number of MPI ranks to decompose into.
+ * @param box_l   Simulation box length in each direction.
+ * @param range   Interaction range (including skin).
+ */
+std::vector<NodeGridCandidate> suggest_node_grids(int n_nodes,
+                                                  Utils::Vector3d const &box_l,
+                                                  double range);
+
 #endif
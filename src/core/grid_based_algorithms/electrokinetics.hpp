@@ -26,6 +26,16 @@
 // note that we need to declare the ek_parameters struct and instantiate it for
 // LB_GPU to compile when electrokinetics is not compiled in. This seemed more
 // elegant than ifdeffing multiple versions of the kernel integrate.
+
+// There is no CPU implementation of electrokinetics: the solver exists
+// only as CUDA kernels (electrokinetics_cuda.cu) operating on the GPU
+// copy of the LB fluid. A CPU backend would have to re-implement the
+// species advection-diffusion sweep and the FFT Poisson solver on top
+// of the CPU lattice and the halo machinery in halo.cpp; none of that
+// can be shared with the GPU code, which hard-codes its padded node
+// layout and single-device storage. This is a new solver, not a port,
+// and is the direction taken by the walberla-based implementation in
+// later development lines.
 #ifdef CUDA
 
 #define MAX_NUMBER_OF_SPECIES 10
@@ -67,6 +77,9 @@ struct EKParameters {
   bool advection;
   bool fluidcoupling_ideal_contribution;
   bool es_coupling;
+  /** Poisson solver used for the potential, cast from
+   *  @ref FdElectrostatics::Scheme. */
+  int es_scheme;
   float *charge_potential_buffer;
   float *electric_field;
   float *charge_potential;
@@ -157,6 +170,7 @@ void ek_set_friction(float friction);
 void ek_set_T(float T);
 void ek_set_prefactor(float prefactor);
 void ek_set_electrostatics_coupling(bool electrostatics_coupling);
+void ek_set_electrostatics_scheme(int scheme);
 void ek_calculate_electrostatic_coupling();
 void ek_set_bulk_viscosity(float bulk_viscosity);
 void ek_set_gamma_odd(float gamma_odd);
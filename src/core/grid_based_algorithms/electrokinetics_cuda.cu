@@ -145,6 +145,8 @@ EKParameters ek_parameters = {
     true,
     // es_coupling
     false,
+    // es_scheme
+    FdElectrostatics::SCHEME_FFT,
     // charge_potential_buffer
     nullptr,
     // electric_field
@@ -2316,9 +2318,9 @@ int ek_init() {
     delete electrostatics;
 
     FdElectrostatics::InputParameters es_parameters = {
-        ek_parameters.prefactor, int(ek_parameters.dim_x),
+        ek_parameters.prefactor,  int(ek_parameters.dim_x),
         int(ek_parameters.dim_y), int(ek_parameters.dim_z),
-        ek_parameters.agrid};
+        ek_parameters.agrid,      ek_parameters.es_scheme};
     try {
       electrostatics = new FdElectrostatics(es_parameters, stream[0]);
     } catch (std::string e) {
@@ -2328,6 +2330,17 @@ int ek_init() {
       return 1;
     }
 
+#ifdef EK_BOUNDARIES
+    if (ek_parameters.es_scheme == FdElectrostatics::SCHEME_MULTIGRID) {
+      /* treat LB boundary nodes as zero-flux walls of the potential;
+       * only the pointer is registered here, the flags are rebuilt from
+       * the field contents on every solve */
+      unsigned int *boundary_index = nullptr;
+      lb_get_boundary_flag_pointer(&boundary_index);
+      electrostatics->setBoundaries(boundary_index, nullptr, 0);
+    }
+#endif
+
     ek_parameters.charge_potential = electrostatics->getGrid().grid;
     cuda_safe_mem(cudaMemcpyToSymbol(ek_parameters_gpu, &ek_parameters,
                                      sizeof(EKParameters)));
@@ -3651,6 +3664,14 @@ void ek_set_electrostatics_coupling(bool electrostatics_coupling) {
   ek_parameters.es_coupling = electrostatics_coupling;
 }
 
+void ek_set_electrostatics_scheme(int scheme) {
+  ek_setter_throw_if_initialized();
+  if (scheme != FdElectrostatics::SCHEME_FFT &&
+      scheme != FdElectrostatics::SCHEME_MULTIGRID)
+    throw std::runtime_error("Unknown electrostatics scheme");
+  ek_parameters.es_scheme = scheme;
+}
+
 void ek_set_viscosity(float viscosity) {
   ek_setter_throw_if_initialized();
   ek_parameters.viscosity = viscosity;
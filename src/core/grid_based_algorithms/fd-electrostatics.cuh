@@ -21,12 +21,25 @@
 
 #include <cufft.h>
 
+#include <cstddef>
+#include <vector>
+
 class FdElectrostatics {
 public:
+  /** Scheme used to solve the Poisson equation. */
+  enum Scheme : int {
+    /** Spectral solution with cuFFT; periodic boundaries only. */
+    SCHEME_FFT = 0,
+    /** Geometric multigrid V-cycles; supports mixed Dirichlet/Neumann
+     *  walls registered with @ref setBoundaries. */
+    SCHEME_MULTIGRID = 1
+  };
+
   struct InputParameters {
     float prefactor;
     int dim_x, dim_y, dim_z;
     float agrid;
+    int scheme = SCHEME_FFT;
   };
 
   struct Parameters : public InputParameters {
@@ -51,10 +64,47 @@ public:
     float agrid;
   };
 
+  /** One level of the multigrid hierarchy. Arrays are unpadded and
+   *  x-major, i.e. indexed as <tt>x + dim_x * (y + dim_y * z)</tt>.
+   */
+  struct MultigridLevel {
+    /** solution on the finest level, coarse-grid correction otherwise */
+    float *phi;
+    /** right-hand side in lattice units */
+    float *rhs;
+    /** residual scratch array */
+    float *res;
+    /** per-node boundary flags */
+    int *flags;
+    int dim_x;
+    int dim_y;
+    int dim_z;
+  };
+
   ~FdElectrostatics();
   FdElectrostatics(InputParameters inputParameters, cudaStream_t stream);
   void calculatePotential();
   void calculatePotential(cufftComplex *charge_potential);
+  /** @brief Register per-node boundary information for the multigrid
+   *  scheme.
+   *
+   *  @param boundary_index  Device array with one entry per grid node,
+   *                         0 for bulk nodes and the (1-based) boundary
+   *                         index otherwise, e.g. the LB boundary flag
+   *                         field. May be @c nullptr to clear.
+   *  @param boundary_potentials  Optional device array with one fixed
+   *                         potential per boundary index. A NaN entry,
+   *                         or @c nullptr, selects zero-flux (Neumann)
+   *                         conditions for the respective boundary;
+   *                         finite entries select Dirichlet conditions.
+   *  @param n_boundaries    Length of @p boundary_potentials.
+   *
+   *  Only the pointers are stored; the flags are rebuilt from the
+   *  current field contents on every solve, so the caller can keep
+   *  passing the same (mutable) LB field.
+   */
+  void setBoundaries(unsigned int const *boundary_index,
+                     float const *boundary_potentials, int n_boundaries);
   Grid getGrid();
 
 private:
@@ -63,6 +113,22 @@ private:
   cufftHandle plan_fft;
   cufftHandle plan_ifft;
   bool initialized;
+
+  /* multigrid state */
+  std::vector<MultigridLevel> mg_levels;
+  unsigned int const *mg_boundary_index = nullptr;
+  float const *mg_boundary_potentials = nullptr;
+  int mg_n_boundaries = 0;
+  bool mg_has_dirichlet = false;
+
+  void buildMultigridHierarchy();
+  void freeMultigridHierarchy();
+  void updateBoundaryFlags();
+  void solveMultigrid(cufftComplex *charge_potential);
+  void vCycle(std::size_t level);
+  void smooth(MultigridLevel const &level, int sweeps);
+  void calculateResidual(MultigridLevel const &level);
+  float norm(float const *field, std::size_t size);
 };
 
 #endif
@@ -28,6 +28,15 @@
 #include <cuda.h>
 #include <cufft.h>
 
+#include <thrust/count.h>
+#include <thrust/device_ptr.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <stdexcept>
 #include <string>
@@ -38,6 +47,25 @@
 
 static constexpr unsigned int threads_per_block = 64;
 
+/** Node flags of the multigrid scheme. */
+static constexpr int MG_FLUID = 0;
+static constexpr int MG_DIRICHLET = 1;
+static constexpr int MG_NEUMANN = 2;
+
+/** Pre- and post-smoothing sweeps per V-cycle. */
+static constexpr int mg_pre_sweeps = 2;
+static constexpr int mg_post_sweeps = 2;
+/** Smoothing sweeps used to solve on the coarsest level. */
+static constexpr int mg_coarse_sweeps = 50;
+/** Maximal number of V-cycles per solve. */
+static constexpr int mg_max_cycles = 20;
+/** Relative residual reduction per solve. The potential only has to be
+ *  converged to well below the thermal noise of the LB fluid, and the
+ *  previous-step potential is reused as initial guess, so a few cycles
+ *  usually suffice.
+ */
+static constexpr float mg_tolerance = 1e-4f;
+
 __device__ cufftReal fde_getNode(int x, int y, int z);
 __device__ cufftReal fde_getNode(int i);
 __device__ void fde_setNode(int x, int y, int z, cufftReal value);
@@ -86,10 +114,14 @@ __device__ void fde_setNode(int i, cufftReal value) {
 }
 
 FdElectrostatics::~FdElectrostatics() {
-  cufftDestroy(plan_ifft);
-  cufftDestroy(plan_fft);
+  if (parameters.scheme == SCHEME_MULTIGRID) {
+    freeMultigridHierarchy();
+  } else {
+    cufftDestroy(plan_ifft);
+    cufftDestroy(plan_fft);
 
-  cuda_safe_mem(cudaFree(parameters.greensfcn));
+    cuda_safe_mem(cudaFree(parameters.greensfcn));
+  }
   cuda_safe_mem(cudaFree(parameters.charge_potential));
 }
 
@@ -100,6 +132,16 @@ FdElectrostatics::FdElectrostatics(InputParameters inputParameters,
                            sizeof(cufftComplex) * parameters.dim_z *
                                parameters.dim_y * (parameters.dim_x / 2 + 1)));
 
+  if (parameters.scheme == SCHEME_MULTIGRID) {
+    buildMultigridHierarchy();
+
+    cuda_safe_mem(cudaMemcpyToSymbol(fde_parameters_gpu, &parameters,
+                                     sizeof(Parameters)));
+
+    initialized = true;
+    return;
+  }
+
   cuda_safe_mem(cudaMalloc((void **)&parameters.greensfcn,
                            sizeof(cufftReal) * parameters.dim_z *
                                parameters.dim_y * (parameters.dim_x / 2 + 1)));
@@ -194,6 +236,11 @@ void FdElectrostatics::calculatePotential() {
 
 void FdElectrostatics::calculatePotential(cufftComplex *charge_potential) {
 
+  if (parameters.scheme == SCHEME_MULTIGRID) {
+    solveMultigrid(charge_potential);
+    return;
+  }
+
   if (cufftExecR2C(plan_fft, (cufftReal *)charge_potential, charge_potential) !=
       CUFFT_SUCCESS) {
 
@@ -219,3 +266,414 @@ FdElectrostatics::Grid FdElectrostatics::getGrid() {
             parameters.dim_y, parameters.dim_z, parameters.agrid};
   return g;
 }
+
+/*
+ * Geometric multigrid scheme. All arrays of @ref MultigridLevel are
+ * unpadded and x-major; only the transfer kernels to and from the padded
+ * cuFFT layout of @c charge_potential know about the padding. The 7-point
+ * Laplacian is the real-space counterpart of the spectral Green's
+ * function above, so both schemes solve the identical discrete problem
+ * on a pure-periodic box.
+ */
+
+__device__ __forceinline__ int mg_wrap(int c, int dim) {
+  if (c < 0)
+    return c + dim;
+  if (c >= dim)
+    return c - dim;
+  return c;
+}
+
+__device__ __forceinline__ unsigned int mg_index(int x, int y, int z,
+                                                 int dim_x, int dim_y) {
+  return static_cast<unsigned int>(x + dim_x * (y + dim_y * z));
+}
+
+/** Gather the 6-neighbor stencil sum around a fluid node. Neumann
+ *  neighbors are mirrored (zero normal flux across the shared face),
+ *  Dirichlet neighbors contribute their fixed value.
+ */
+__device__ float mg_neighbor_sum(FdElectrostatics::MultigridLevel lv, int x,
+                                 int y, int z, float center) {
+  float sum = 0.0f;
+  int const nb[6][3] = {{x - 1, y, z}, {x + 1, y, z}, {x, y - 1, z},
+                        {x, y + 1, z}, {x, y, z - 1}, {x, y, z + 1}};
+  for (int i = 0; i < 6; i++) {
+    auto const index =
+        mg_index(mg_wrap(nb[i][0], lv.dim_x), mg_wrap(nb[i][1], lv.dim_y),
+                 mg_wrap(nb[i][2], lv.dim_z), lv.dim_x, lv.dim_y);
+    sum += (lv.flags[index] == MG_NEUMANN) ? center : lv.phi[index];
+  }
+  return sum;
+}
+
+__global__ void mg_charge_to_rhs(float const *charge_potential,
+                                 FdElectrostatics::MultigridLevel lv,
+                                 int dim_x_padded, float scale) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < lv.dim_x * lv.dim_y * lv.dim_z) {
+    int const x = static_cast<int>(index) % lv.dim_x;
+    int const y = (static_cast<int>(index) / lv.dim_x) % lv.dim_y;
+    int const z = static_cast<int>(index) / (lv.dim_x * lv.dim_y);
+    lv.rhs[index] =
+        scale * charge_potential[mg_index(x, y, z, dim_x_padded, lv.dim_y)];
+  }
+}
+
+__global__ void mg_phi_to_padded(float *charge_potential,
+                                 FdElectrostatics::MultigridLevel lv,
+                                 int dim_x_padded) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < lv.dim_x * lv.dim_y * lv.dim_z) {
+    int const x = static_cast<int>(index) % lv.dim_x;
+    int const y = (static_cast<int>(index) / lv.dim_x) % lv.dim_y;
+    int const z = static_cast<int>(index) / (lv.dim_x * lv.dim_y);
+    charge_potential[mg_index(x, y, z, dim_x_padded, lv.dim_y)] =
+        lv.phi[index];
+  }
+}
+
+__global__ void mg_build_flags(FdElectrostatics::MultigridLevel lv,
+                               unsigned int const *boundary_index,
+                               float const *boundary_potentials,
+                               int n_boundaries) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < lv.dim_x * lv.dim_y * lv.dim_z) {
+    auto const boundary = boundary_index[index];
+    if (boundary == 0u) {
+      lv.flags[index] = MG_FLUID;
+    } else {
+      float potential = nanf("");
+      if (boundary_potentials != nullptr &&
+          static_cast<int>(boundary) <= n_boundaries) {
+        potential = boundary_potentials[boundary - 1u];
+      }
+      if (isfinite(potential)) {
+        lv.flags[index] = MG_DIRICHLET;
+        lv.phi[index] = potential;
+      } else {
+        lv.flags[index] = MG_NEUMANN;
+      }
+    }
+  }
+}
+
+/** Coarsen boundary flags by injection from the even fine nodes. Coarse
+ *  boundary nodes carry a zero correction, so no potential is copied.
+ */
+__global__ void mg_inject_flags(FdElectrostatics::MultigridLevel coarse,
+                                FdElectrostatics::MultigridLevel fine) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < coarse.dim_x * coarse.dim_y * coarse.dim_z) {
+    int const x = static_cast<int>(index) % coarse.dim_x;
+    int const y = (static_cast<int>(index) / coarse.dim_x) % coarse.dim_y;
+    int const z = static_cast<int>(index) / (coarse.dim_x * coarse.dim_y);
+    coarse.flags[index] =
+        fine.flags[mg_index(2 * x, 2 * y, 2 * z, fine.dim_x, fine.dim_y)];
+  }
+}
+
+/** One red-black Gauss-Seidel half-sweep of
+ *  (sum of neighbors - 6 phi) / h^2 = rhs on the fluid nodes. */
+__global__ void mg_smooth_sweep(FdElectrostatics::MultigridLevel lv, float h2,
+                                int color) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < lv.dim_x * lv.dim_y * lv.dim_z &&
+      lv.flags[index] == MG_FLUID) {
+    int const x = static_cast<int>(index) % lv.dim_x;
+    int const y = (static_cast<int>(index) / lv.dim_x) % lv.dim_y;
+    int const z = static_cast<int>(index) / (lv.dim_x * lv.dim_y);
+    if (((x + y + z) & 1) == color) {
+      auto const center = lv.phi[index];
+      lv.phi[index] =
+          (mg_neighbor_sum(lv, x, y, z, center) - h2 * lv.rhs[index]) / 6.0f;
+    }
+  }
+}
+
+__global__ void mg_residual_kernel(FdElectrostatics::MultigridLevel lv,
+                                   float inv_h2) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < lv.dim_x * lv.dim_y * lv.dim_z) {
+    if (lv.flags[index] == MG_FLUID) {
+      int const x = static_cast<int>(index) % lv.dim_x;
+      int const y = (static_cast<int>(index) / lv.dim_x) % lv.dim_y;
+      int const z = static_cast<int>(index) / (lv.dim_x * lv.dim_y);
+      auto const center = lv.phi[index];
+      lv.res[index] =
+          lv.rhs[index] -
+          (mg_neighbor_sum(lv, x, y, z, center) - 6.0f * center) * inv_h2;
+    } else {
+      lv.res[index] = 0.0f;
+    }
+  }
+}
+
+/** Half-weighting restriction of the fine residual to the coarse rhs. */
+__global__ void mg_restrict_kernel(FdElectrostatics::MultigridLevel coarse,
+                                   FdElectrostatics::MultigridLevel fine) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < coarse.dim_x * coarse.dim_y * coarse.dim_z) {
+    if (coarse.flags[index] != MG_FLUID) {
+      coarse.rhs[index] = 0.0f;
+      return;
+    }
+    int const x = 2 * (static_cast<int>(index) % coarse.dim_x);
+    int const y = 2 * ((static_cast<int>(index) / coarse.dim_x) % coarse.dim_y);
+    int const z =
+        2 * (static_cast<int>(index) / (coarse.dim_x * coarse.dim_y));
+    int const nb[6][3] = {{x - 1, y, z}, {x + 1, y, z}, {x, y - 1, z},
+                          {x, y + 1, z}, {x, y, z - 1}, {x, y, z + 1}};
+    auto faces = 0.0f;
+    for (int i = 0; i < 6; i++) {
+      faces += fine.res[mg_index(
+          mg_wrap(nb[i][0], fine.dim_x), mg_wrap(nb[i][1], fine.dim_y),
+          mg_wrap(nb[i][2], fine.dim_z), fine.dim_x, fine.dim_y)];
+    }
+    coarse.rhs[index] =
+        0.5f * fine.res[mg_index(x, y, z, fine.dim_x, fine.dim_y)] +
+        faces / 12.0f;
+  }
+}
+
+/** Trilinear prolongation of the coarse correction, added to the fine
+ *  solution. Boundary nodes keep their prescribed values. */
+__global__ void mg_prolongate_kernel(FdElectrostatics::MultigridLevel fine,
+                                     FdElectrostatics::MultigridLevel coarse) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < fine.dim_x * fine.dim_y * fine.dim_z &&
+      fine.flags[index] == MG_FLUID) {
+    int const x = static_cast<int>(index) % fine.dim_x;
+    int const y = (static_cast<int>(index) / fine.dim_x) % fine.dim_y;
+    int const z = static_cast<int>(index) / (fine.dim_x * fine.dim_y);
+    int const px = x & 1, py = y & 1, pz = z & 1;
+    auto correction = 0.0f;
+    for (int dz = 0; dz <= pz; dz++) {
+      for (int dy = 0; dy <= py; dy++) {
+        for (int dx = 0; dx <= px; dx++) {
+          correction += coarse.phi[mg_index(
+              mg_wrap(x / 2 + dx, coarse.dim_x),
+              mg_wrap(y / 2 + dy, coarse.dim_y),
+              mg_wrap(z / 2 + dz, coarse.dim_z), coarse.dim_x, coarse.dim_y)];
+        }
+      }
+    }
+    fine.phi[index] += correction / static_cast<float>((px + 1) * (py + 1) *
+                                                       (pz + 1));
+  }
+}
+
+__global__ void mg_add_constant(float *field, float value, unsigned int size) {
+  auto const index = fde_getThreadIndex();
+
+  if (index < size) {
+    field[index] += value;
+  }
+}
+
+struct mg_square {
+  __host__ __device__ float operator()(float x) const { return x * x; }
+};
+
+struct mg_is_dirichlet {
+  __host__ __device__ bool operator()(int flag) const {
+    return flag == MG_DIRICHLET;
+  }
+};
+
+static dim3 mg_dim_grid(FdElectrostatics::MultigridLevel const &lv) {
+  return calculate_dim_grid(
+      static_cast<unsigned>(lv.dim_x * lv.dim_y * lv.dim_z), 4,
+      threads_per_block);
+}
+
+void FdElectrostatics::buildMultigridHierarchy() {
+  int dim_x = parameters.dim_x;
+  int dim_y = parameters.dim_y;
+  int dim_z = parameters.dim_z;
+
+  while (true) {
+    MultigridLevel level{};
+    level.dim_x = dim_x;
+    level.dim_y = dim_y;
+    level.dim_z = dim_z;
+    auto const size =
+        static_cast<std::size_t>(dim_x) * dim_y * dim_z * sizeof(float);
+    cuda_safe_mem(cudaMalloc((void **)&level.phi, size));
+    cuda_safe_mem(cudaMalloc((void **)&level.rhs, size));
+    cuda_safe_mem(cudaMalloc((void **)&level.res, size));
+    cuda_safe_mem(cudaMalloc((void **)&level.flags,
+                             static_cast<std::size_t>(dim_x) * dim_y * dim_z *
+                                 sizeof(int)));
+    cuda_safe_mem(cudaMemset(level.phi, 0, size));
+    cuda_safe_mem(cudaMemset(level.flags, 0,
+                             static_cast<std::size_t>(dim_x) * dim_y * dim_z *
+                                 sizeof(int)));
+    mg_levels.push_back(level);
+
+    /* coarsen while all dimensions stay even and reasonably large */
+    if (dim_x % 2 || dim_y % 2 || dim_z % 2 ||
+        std::min(std::min(dim_x, dim_y), dim_z) < 8)
+      break;
+    dim_x /= 2;
+    dim_y /= 2;
+    dim_z /= 2;
+  }
+}
+
+void FdElectrostatics::freeMultigridHierarchy() {
+  for (auto &level : mg_levels) {
+    cuda_safe_mem(cudaFree(level.phi));
+    cuda_safe_mem(cudaFree(level.rhs));
+    cuda_safe_mem(cudaFree(level.res));
+    cuda_safe_mem(cudaFree(level.flags));
+  }
+  mg_levels.clear();
+}
+
+void FdElectrostatics::setBoundaries(unsigned int const *boundary_index,
+                                     float const *boundary_potentials,
+                                     int n_boundaries) {
+  mg_boundary_index = boundary_index;
+  mg_boundary_potentials = boundary_potentials;
+  mg_n_boundaries = n_boundaries;
+}
+
+void FdElectrostatics::updateBoundaryFlags() {
+  auto &fine = mg_levels.front();
+  auto const n = static_cast<std::size_t>(fine.dim_x) * fine.dim_y *
+                 fine.dim_z;
+
+  if (mg_boundary_index != nullptr) {
+    KERNELCALL_stream(mg_build_flags, mg_dim_grid(fine), threads_per_block,
+                      cuda_stream, fine, mg_boundary_index,
+                      mg_boundary_potentials, mg_n_boundaries);
+  } else {
+    cuda_safe_mem(
+        cudaMemsetAsync(fine.flags, 0, n * sizeof(int), cuda_stream));
+  }
+  for (std::size_t level = 1; level < mg_levels.size(); level++) {
+    KERNELCALL_stream(mg_inject_flags, mg_dim_grid(mg_levels[level]),
+                      threads_per_block, cuda_stream, mg_levels[level],
+                      mg_levels[level - 1]);
+  }
+
+  mg_has_dirichlet =
+      mg_boundary_index != nullptr &&
+      thrust::count_if(thrust::device_pointer_cast(fine.flags),
+                       thrust::device_pointer_cast(fine.flags) +
+                           static_cast<std::ptrdiff_t>(n),
+                       mg_is_dirichlet{}) > 0;
+}
+
+float FdElectrostatics::norm(float const *field, std::size_t size) {
+  auto const ptr = thrust::device_pointer_cast(field);
+  return sqrtf(thrust::transform_reduce(
+      ptr, ptr + static_cast<std::ptrdiff_t>(size), mg_square{}, 0.0f,
+      thrust::plus<float>()));
+}
+
+void FdElectrostatics::smooth(MultigridLevel const &level, int sweeps) {
+  auto const level_index = static_cast<std::size_t>(&level -
+                                                    mg_levels.data());
+  auto const h = parameters.agrid * static_cast<float>(1u << level_index);
+  auto const dim_grid = mg_dim_grid(level);
+  for (int sweep = 0; sweep < sweeps; sweep++) {
+    for (int color = 0; color < 2; color++) {
+      KERNELCALL_stream(mg_smooth_sweep, dim_grid, threads_per_block,
+                        cuda_stream, level, h * h, color);
+    }
+  }
+}
+
+void FdElectrostatics::calculateResidual(MultigridLevel const &level) {
+  auto const level_index = static_cast<std::size_t>(&level -
+                                                    mg_levels.data());
+  auto const h = parameters.agrid * static_cast<float>(1u << level_index);
+  KERNELCALL_stream(mg_residual_kernel, mg_dim_grid(level), threads_per_block,
+                    cuda_stream, level, 1.0f / (h * h));
+}
+
+void FdElectrostatics::vCycle(std::size_t level) {
+  auto const &fine = mg_levels[level];
+
+  if (level + 1 == mg_levels.size()) {
+    smooth(fine, mg_coarse_sweeps);
+    return;
+  }
+
+  auto const &coarse = mg_levels[level + 1];
+  smooth(fine, mg_pre_sweeps);
+  calculateResidual(fine);
+  KERNELCALL_stream(mg_restrict_kernel, mg_dim_grid(coarse), threads_per_block,
+                    cuda_stream, coarse, fine);
+  cuda_safe_mem(cudaMemsetAsync(coarse.phi, 0,
+                                static_cast<std::size_t>(coarse.dim_x) *
+                                    coarse.dim_y * coarse.dim_z *
+                                    sizeof(float),
+                                cuda_stream));
+  vCycle(level + 1);
+  KERNELCALL_stream(mg_prolongate_kernel, mg_dim_grid(fine), threads_per_block,
+                    cuda_stream, fine, coarse);
+  smooth(fine, mg_post_sweeps);
+}
+
+void FdElectrostatics::solveMultigrid(cufftComplex *charge_potential) {
+  auto &fine = mg_levels.front();
+  auto const n = static_cast<std::size_t>(fine.dim_x) * fine.dim_y *
+                 fine.dim_z;
+  auto const dim_grid = mg_dim_grid(fine);
+
+  /* the 7-point Laplacian of phi equals -4 pi prefactor rho, matching the
+   * spectral Green's function of the periodic scheme */
+  auto const scale = -4.0f * Utils::pi<float>() * parameters.prefactor;
+  KERNELCALL_stream(mg_charge_to_rhs, dim_grid, threads_per_block, cuda_stream,
+                    reinterpret_cast<float const *>(charge_potential), fine,
+                    parameters.dim_x_padded, scale);
+  updateBoundaryFlags();
+
+  if (!mg_has_dirichlet) {
+    /* pure periodic/Neumann problems are singular; subtract the mean
+     * source, the analogue of zeroing the 0th Fourier mode */
+    auto const ptr = thrust::device_pointer_cast(fine.rhs);
+    auto const mean = thrust::reduce(ptr, ptr + static_cast<std::ptrdiff_t>(n),
+                                     0.0f, thrust::plus<float>()) /
+                      static_cast<float>(n);
+    KERNELCALL_stream(mg_add_constant, dim_grid, threads_per_block,
+                      cuda_stream, fine.rhs, -mean, static_cast<unsigned>(n));
+  }
+
+  /* the previous-step potential in fine.phi serves as initial guess */
+  calculateResidual(fine);
+  auto const initial_residual = norm(fine.res, n);
+  if (initial_residual > 0.0f) {
+    for (int cycle = 0; cycle < mg_max_cycles; cycle++) {
+      vCycle(0);
+      calculateResidual(fine);
+      if (norm(fine.res, n) <= mg_tolerance * initial_residual)
+        break;
+    }
+  }
+
+  if (!mg_has_dirichlet) {
+    /* pin the gauge for the pure-periodic case */
+    auto const ptr = thrust::device_pointer_cast(fine.phi);
+    auto const mean = thrust::reduce(ptr, ptr + static_cast<std::ptrdiff_t>(n),
+                                     0.0f, thrust::plus<float>()) /
+                      static_cast<float>(n);
+    KERNELCALL_stream(mg_add_constant, dim_grid, threads_per_block,
+                      cuda_stream, fine.phi, -mean, static_cast<unsigned>(n));
+  }
+
+  KERNELCALL_stream(mg_phi_to_padded, dim_grid, threads_per_block, cuda_stream,
+                    reinterpret_cast<float *>(charge_potential), fine,
+                    parameters.dim_x_padded);
+}
@@ -210,54 +210,50 @@ void release_halo_communication(HaloCommunicator &hc) {
 
 void halo_communication(const HaloCommunicator &hc, char *const base) {
 
-  std::shared_ptr<FieldType> fieldtype;
-  MPI_Datatype datatype;
   MPI_Request request;
   MPI_Status status;
 
+  /* The six exchanges must stay ordered: the send region of the y
+   * exchange includes the halo layers filled by the preceding x
+   * exchange (and analogously for z), which is how edge and corner
+   * halos propagate without dedicated diagonal messages. Overlapping
+   * the exchange with bulk lattice updates would therefore require
+   * dedicated edge/corner messages first, so that all six plane
+   * exchanges become independent and can be issued together. */
   for (int n = 0; n < hc.num; n++) {
-    int s_node, r_node;
-    int comm_type = hc.halo_info[n].type;
-    char *s_buffer = static_cast<char *>(base) + hc.halo_info[n].s_offset;
-    char *r_buffer = static_cast<char *>(base) + hc.halo_info[n].r_offset;
+    auto const &hinfo = hc.halo_info[n];
+    int const comm_type = hinfo.type;
+    char *s_buffer = static_cast<char *>(base) + hinfo.s_offset;
+    char *r_buffer = static_cast<char *>(base) + hinfo.r_offset;
 
     switch (comm_type) {
 
     case HALO_LOCL:
-      fieldtype = hc.halo_info[n].fieldtype;
-      halo_dtcopy(r_buffer, s_buffer, 1, fieldtype);
+      halo_dtcopy(r_buffer, s_buffer, 1, hinfo.fieldtype);
       break;
 
     case HALO_SENDRECV:
-      datatype = hc.halo_info[n].datatype;
-      s_node = hc.halo_info[n].source_node;
-      r_node = hc.halo_info[n].dest_node;
-      MPI_Sendrecv(s_buffer, 1, datatype, r_node, REQ_HALO_SPREAD, r_buffer, 1,
-                   datatype, s_node, REQ_HALO_SPREAD, comm_cart, &status);
+      MPI_Sendrecv(s_buffer, 1, hinfo.datatype, hinfo.dest_node,
+                   REQ_HALO_SPREAD, r_buffer, 1, hinfo.datatype,
+                   hinfo.source_node, REQ_HALO_SPREAD, comm_cart, &status);
       break;
 
     case HALO_SEND:
-      datatype = hc.halo_info[n].datatype;
-      fieldtype = hc.halo_info[n].fieldtype;
-      r_node = hc.halo_info[n].dest_node;
-      MPI_Isend(s_buffer, 1, datatype, r_node, REQ_HALO_SPREAD, comm_cart,
-                &request);
-      halo_dtset(r_buffer, 0, fieldtype);
+      MPI_Isend(s_buffer, 1, hinfo.datatype, hinfo.dest_node, REQ_HALO_SPREAD,
+                comm_cart, &request);
+      halo_dtset(r_buffer, 0, hinfo.fieldtype);
       MPI_Wait(&request, &status);
       break;
 
     case HALO_RECV:
-      datatype = hc.halo_info[n].datatype;
-      s_node = hc.halo_info[n].source_node;
-      MPI_Irecv(r_buffer, 1, datatype, s_node, REQ_HALO_SPREAD, comm_cart,
-                &request);
+      MPI_Irecv(r_buffer, 1, hinfo.datatype, hinfo.source_node,
+                REQ_HALO_SPREAD, comm_cart, &request);
       MPI_Wait(&request, &status);
       break;
 
     case HALO_OPEN:
-      fieldtype = hc.halo_info[n].fieldtype;
       /** \todo this does not work for the n_i - \<n_i\> */
-      halo_dtset(r_buffer, 0, fieldtype);
+      halo_dtset(r_buffer, 0, hinfo.fieldtype);
       break;
     }
   }
@@ -24,6 +24,15 @@
  * Contains the lattice layout.
  * For parallelization purposes, it is assumed that a halo region
  * surrounds the local lattice sites.
+ *
+ * The lattice is uniform: one spacing @ref Lattice::agrid everywhere.
+ * This assumption is baked into every consumer: the halo exchange
+ * datatypes (one plane per direction), the linear site indexing, the
+ * D3Q19 streaming offsets and the particle coupling interpolation all
+ * rely on a single constant stride per direction. Local grid
+ * refinement would replace this class with a block-structured lattice
+ * plus rescaled populations at level interfaces, and is therefore a
+ * new lattice implementation rather than an extension of this one.
  */
 
 #ifndef CORE_LB_LATTICE_HPP
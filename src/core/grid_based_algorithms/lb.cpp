@@ -37,6 +37,7 @@
 #include "grid_based_algorithms/lb_boundaries.hpp"
 #include "halo.hpp"
 #include "lb-d3q19.hpp"
+#include "memory_stats.hpp"
 #include "random.hpp"
 
 #include <utils/Counter.hpp>
@@ -202,6 +203,8 @@ void lb_initialize_fields(std::vector<LB_FluidNode> &lb_fields,
                           LB_Parameters const &lb_parameters,
                           Lattice const &lb_lattice) {
   lb_fields.resize(lb_lattice.halo_grid_volume);
+  MemoryStats::track("lb.fields",
+                     lb_fields.capacity() * sizeof(LB_FluidNode));
   for (auto &field : lb_fields) {
     field.force_density = lb_parameters.ext_force_density;
 #ifdef LB_BOUNDARIES
@@ -225,6 +228,35 @@ void lb_realloc_fluid(LB_FluidData &lb_fluid_a, LB_FluidData &lb_fluid_b,
     lb_fluid[i] = Span<double>(lb_fluid_a[i].origin(), size[1]);
     lb_fluid_post[i] = Span<double>(lb_fluid_b[i].origin(), size[1]);
   }
+
+  MemoryStats::track("lb.populations",
+                     2u * static_cast<std::size_t>(size[0]) *
+                         static_cast<std::size_t>(size[1]) * sizeof(double));
+}
+
+std::vector<double> lb_save_population_snapshot() {
+  auto const volume = static_cast<std::size_t>(lblattice.halo_grid_volume);
+  std::vector<double> snapshot(static_cast<std::size_t>(D3Q19::n_vel) *
+                               volume);
+  auto out = snapshot.begin();
+  for (auto const &population : lbfluid) {
+    out = std::copy(population.begin(), population.end(), out);
+  }
+  return snapshot;
+}
+
+void lb_load_population_snapshot(std::vector<double> const &snapshot) {
+  auto const volume = static_cast<std::size_t>(lblattice.halo_grid_volume);
+  if (snapshot.size() != static_cast<std::size_t>(D3Q19::n_vel) * volume) {
+    throw std::runtime_error(
+        "LB population snapshot does not match the current lattice");
+  }
+  auto in = snapshot.begin();
+  for (auto &population : lbfluid) {
+    auto const next = in + static_cast<std::ptrdiff_t>(volume);
+    std::copy(in, next, population.begin());
+    in = next;
+  }
 }
 
 void lb_set_equilibrium_populations(const Lattice &lb_lattice,
@@ -910,8 +942,9 @@ void lb_integrate() {
       for (int x = 1; x <= lblattice.grid[0]; x++) {
         // as we only want to apply this to non-boundary nodes we can throw out
         // the if-clause if we have a non-bounded domain
+        auto &field = lbfields[index];
 #ifdef LB_BOUNDARIES
-        if (!lbfields[index].boundary)
+        if (!field.boundary)
 #endif // LB_BOUNDARIES
         {
           /* calculate modes locally */
@@ -919,24 +952,24 @@ void lb_integrate() {
 
           /* deterministic collisions */
           auto const relaxed_modes =
-              lb_relax_modes(modes, lbfields[index].force_density, lbpar);
+              lb_relax_modes(modes, field.force_density, lbpar);
 
           /* fluctuating hydrodynamics */
           auto const thermalized_modes = lb_thermalize_modes(
               index, relaxed_modes, lbpar, rng_counter_fluid);
 
           /* apply forces */
-          auto const modes_with_forces = lb_apply_forces(
-              thermalized_modes, lbpar, lbfields[index].force_density);
+          auto const modes_with_forces =
+              lb_apply_forces(thermalized_modes, lbpar, field.force_density);
 
 #ifdef VIRTUAL_SITES_INERTIALESS_TRACERS
           // Safeguard the node forces so that we can later use them for the IBM
           // particle update
-          lbfields[index].force_density_buf = lbfields[index].force_density;
+          field.force_density_buf = field.force_density;
 #endif
 
           /* reset the force density */
-          lbfields[index].force_density = lbpar.ext_force_density;
+          field.force_density = lbpar.ext_force_density;
 
           /* transform back to populations and streaming */
           auto const populations = lb_calc_n_from_m(modes_with_forces);
@@ -1245,45 +1278,58 @@ Utils::Vector6d lb_calc_pressure_tensor(std::array<double, 19> const &modes,
 }
 
 #ifdef LB_BOUNDARIES
+/** Cached boundary sites, cf. @ref lb_collect_boundary_sites. */
+static std::vector<LB_BoundarySite> lb_boundary_sites;
+
+void lb_collect_boundary_sites(std::vector<LB_FluidNode> const &lb_fields,
+                               Lattice const &lb_lattice) {
+  lb_boundary_sites.clear();
+  for (int z = 0; z < lb_lattice.grid[2] + 2; z++) {
+    for (int y = 0; y < lb_lattice.grid[1] + 2; y++) {
+      for (int x = 0; x < lb_lattice.grid[0] + 2; x++) {
+        auto const k = get_linear_index(x, y, z, lb_lattice.halo_grid);
+        if (lb_fields[k].boundary) {
+          lb_boundary_sites.push_back({{x, y, z}, k});
+        }
+      }
+    }
+  }
+}
+
 void lb_bounce_back(LB_Fluid &lb_fluid, const LB_Parameters &lb_parameters,
                     const std::vector<LB_FluidNode> &lb_fields) {
   auto const next = lb_next_offsets(lblattice, D3Q19::c);
   static constexpr int reverse[] = {0, 2,  1,  4,  3,  6,  5,  8,  7, 10,
                                     9, 12, 11, 14, 13, 16, 15, 18, 17};
 
-  /* bottom-up sweep */
-  for (int z = 0; z < lblattice.grid[2] + 2; z++) {
-    for (int y = 0; y < lblattice.grid[1] + 2; y++) {
-      for (int x = 0; x < lblattice.grid[0] + 2; x++) {
-        auto const k = get_linear_index(x, y, z, lblattice.halo_grid);
-
-        if (lb_fields[k].boundary) {
-          Utils::Vector3d boundary_force = {};
-          for (int i = 0; i < 19; i++) {
-            auto const ci = D3Q19::c[i];
-
-            if (x - ci[0] > 0 && x - ci[0] < lblattice.grid[0] + 1 &&
-                y - ci[1] > 0 && y - ci[1] < lblattice.grid[1] + 1 &&
-                z - ci[2] > 0 && z - ci[2] < lblattice.grid[2] + 1) {
-              if (!lb_fields[k - next[i]].boundary) {
-                auto const population_shift =
-                    -lb_parameters.density * 2 * D3Q19::w[i] *
-                    (ci * lb_fields[k].slip_velocity) /
-                    D3Q19::c_sound_sq<double>;
-
-                boundary_force += (2 * lb_fluid[i][k] + population_shift) * ci;
-                lb_fluid[reverse[i]][k - next[i]] =
-                    lb_fluid[i][k] + population_shift;
-              } else {
-                lb_fluid[reverse[i]][k - next[i]] = lb_fluid[i][k] = 0.0;
-              }
-            }
-          }
-          LBBoundaries::lbboundaries[lb_fields[k].boundary - 1]->force() +=
-              boundary_force;
+  /* bottom-up sweep over the cached boundary sites */
+  for (auto const &site : lb_boundary_sites) {
+    auto const x = site.pos[0];
+    auto const y = site.pos[1];
+    auto const z = site.pos[2];
+    auto const k = site.index;
+
+    Utils::Vector3d boundary_force = {};
+    for (int i = 0; i < 19; i++) {
+      auto const ci = D3Q19::c[i];
+
+      if (x - ci[0] > 0 && x - ci[0] < lblattice.grid[0] + 1 && y - ci[1] > 0 &&
+          y - ci[1] < lblattice.grid[1] + 1 && z - ci[2] > 0 &&
+          z - ci[2] < lblattice.grid[2] + 1) {
+        if (!lb_fields[k - next[i]].boundary) {
+          auto const population_shift =
+              -lb_parameters.density * 2 * D3Q19::w[i] *
+              (ci * lb_fields[k].slip_velocity) / D3Q19::c_sound_sq<double>;
+
+          boundary_force += (2 * lb_fluid[i][k] + population_shift) * ci;
+          lb_fluid[reverse[i]][k - next[i]] = lb_fluid[i][k] + population_shift;
+        } else {
+          lb_fluid[reverse[i]][k - next[i]] = lb_fluid[i][k] = 0.0;
         }
       }
     }
+    LBBoundaries::lbboundaries[lb_fields[k].boundary - 1]->force() +=
+        boundary_force;
   }
 }
 #endif // LB_BOUNDARIES
@@ -147,6 +147,24 @@ void lb_reinit_parameters(LB_Parameters &lb_parameters);
 using LB_Fluid = std::array<Utils::Span<double>, 19>;
 extern LB_Fluid lbfluid;
 
+/**
+ * @brief Copy the local population arrays into a flat buffer.
+ *
+ * The snapshot includes the halo layers, so restoring it does not
+ * require a subsequent halo exchange. It is rank-local: iterative
+ * protocols that roll the fluid back repeatedly can keep it in memory
+ * instead of streaming the populations through a checkpoint file.
+ */
+std::vector<double> lb_save_population_snapshot();
+
+/**
+ * @brief Restore the local population arrays from a snapshot.
+ *
+ * @throws std::runtime_error if the buffer size does not match the
+ *         current lattice.
+ */
+void lb_load_population_snapshot(std::vector<double> const &snapshot);
+
 class LB_Fluid_Ref {
 public:
   LB_Fluid_Ref(std::size_t index, const LB_Fluid &lb_fluid)
@@ -240,6 +258,21 @@ void lb_prepare_communication(HaloCommunicator &halo_comm,
                               const Lattice &lb_lattice);
 
 #ifdef LB_BOUNDARIES
+/** Coordinates and linear index of a boundary lattice site. */
+struct LB_BoundarySite {
+  Utils::Vector3i pos;
+  Lattice::index_t index;
+};
+
+/** Rebuild the cached list of boundary sites.
+ *  Boundary sites are usually a small fraction of the lattice, so
+ *  @ref lb_bounce_back iterates over this list instead of scanning
+ *  every site for the boundary flag. Must be called whenever the
+ *  boundary flags in @p lb_fields have been recalculated.
+ */
+void lb_collect_boundary_sites(std::vector<LB_FluidNode> const &lb_fields,
+                               Lattice const &lb_lattice);
+
 /** Bounce back boundary conditions.
  * The populations that have propagated into a boundary node
  * are bounced back to the node they came from. This results
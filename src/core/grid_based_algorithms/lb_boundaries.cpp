@@ -266,6 +266,7 @@ void lb_init_boundaries() {
         }
       }
     }
+    lb_collect_boundary_sites(lbfields, lblattice);
 #else  // defined(LB_BOUNDARIES)
     if (not lbboundaries.empty()) {
       runtimeErrorMsg()
@@ -28,7 +28,13 @@
 #include <utils/Vector.hpp>
 #include <utils/index.hpp>
 
+#include <boost/mpi/collectives/reduce.hpp>
 #include <boost/optional.hpp>
+#include <boost/serialization/vector.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
 
 using Utils::get_linear_index;
 
@@ -81,6 +87,105 @@ mpi_lb_get_interpolated_velocity(Utils::Vector3d const &pos) {
 
 REGISTER_CALLBACK_ONE_RANK(mpi_lb_get_interpolated_velocity)
 
+/** Interpolate the velocity at the positions owned by this rank.
+ *  Positions owned by other ranks contribute zero entries, so the flat
+ *  buffers can be summed element-wise across ranks.
+ */
+static std::vector<double> lb_calc_local_interpolated_velocities(
+    std::vector<Utils::Vector3d> const &positions) {
+  std::vector<double> local_velocities(3ul * positions.size());
+  for (std::size_t j = 0ul; j < positions.size(); ++j) {
+    if (map_position_node_array(positions[j]) == this_node) {
+      auto const v = lb_lbinterpolation_get_interpolated_velocity(positions[j]);
+      local_velocities[3ul * j + 0ul] = v[0];
+      local_velocities[3ul * j + 1ul] = v[1];
+      local_velocities[3ul * j + 2ul] = v[2];
+    }
+  }
+  return local_velocities;
+}
+
+static void mpi_lb_get_interpolated_velocities_local(
+    std::vector<Utils::Vector3d> const &positions) {
+  boost::mpi::reduce(comm_cart,
+                     lb_calc_local_interpolated_velocities(positions),
+                     std::plus<>{}, 0);
+}
+
+REGISTER_CALLBACK(mpi_lb_get_interpolated_velocities_local)
+
+std::vector<Utils::Vector3d> mpi_lb_get_interpolated_velocities(
+    std::vector<Utils::Vector3d> const &positions) {
+  mpi_call(mpi_lb_get_interpolated_velocities_local, positions);
+  std::vector<double> global_velocities(3ul * positions.size());
+  boost::mpi::reduce(comm_cart, lb_calc_local_interpolated_velocities(positions),
+                     global_velocities, std::plus<>{}, 0);
+  std::vector<Utils::Vector3d> velocities(positions.size());
+  for (std::size_t j = 0ul; j < positions.size(); ++j) {
+    velocities[j] = {global_velocities[3ul * j + 0ul],
+                     global_velocities[3ul * j + 1ul],
+                     global_velocities[3ul * j + 2ul]};
+  }
+  return velocities;
+}
+
+/** Calculate the fluid velocity at the locally owned nodes of an index box.
+ *  Nodes owned by other ranks contribute zero entries, so the flat
+ *  buffers can be summed element-wise across ranks. The box is traversed
+ *  with the x index running fastest.
+ */
+static std::vector<double>
+lb_calc_local_velocities_in_box(Utils::Vector3i const &lower,
+                                Utils::Vector3i const &upper) {
+  auto const dim = upper - lower;
+  std::vector<double> local_velocities(
+      3ul * static_cast<std::size_t>(Utils::product(dim)));
+  std::size_t j = 0ul;
+  Utils::Vector3i ind;
+  for (ind[2] = lower[2]; ind[2] < upper[2]; ind[2]++)
+    for (ind[1] = lower[1]; ind[1] < upper[1]; ind[1]++)
+      for (ind[0] = lower[0]; ind[0] < upper[0]; ind[0]++) {
+        if (lblattice.is_local(ind)) {
+          auto const linear_index = get_linear_index(
+              lblattice.local_index(ind), lblattice.halo_grid);
+          auto const force_density = lbfields[linear_index].force_density;
+          auto const modes = lb_calc_modes(linear_index, lbfluid);
+          auto const v = lb_calc_momentum_density(modes, force_density) /
+                         lb_calc_density(modes, lbpar);
+          local_velocities[3ul * j + 0ul] = v[0];
+          local_velocities[3ul * j + 1ul] = v[1];
+          local_velocities[3ul * j + 2ul] = v[2];
+        }
+        ++j;
+      }
+  return local_velocities;
+}
+
+static void mpi_lb_get_velocities_in_box_local(Utils::Vector3i const &lower,
+                                               Utils::Vector3i const &upper) {
+  boost::mpi::reduce(comm_cart, lb_calc_local_velocities_in_box(lower, upper),
+                     std::plus<>{}, 0);
+}
+
+REGISTER_CALLBACK(mpi_lb_get_velocities_in_box_local)
+
+std::vector<Utils::Vector3d>
+mpi_lb_get_velocities_in_box(Utils::Vector3i const &lower,
+                             Utils::Vector3i const &upper) {
+  mpi_call(mpi_lb_get_velocities_in_box_local, lower, upper);
+  auto const n_nodes = static_cast<std::size_t>(Utils::product(upper - lower));
+  std::vector<double> global_velocities(3ul * n_nodes);
+  boost::mpi::reduce(comm_cart, lb_calc_local_velocities_in_box(lower, upper),
+                     global_velocities, std::plus<>{}, 0);
+  std::vector<Utils::Vector3d> velocities(n_nodes);
+  for (std::size_t j = 0ul; j < n_nodes; ++j) {
+    velocities[j] = {global_velocities[3ul * j + 0ul],
+                     global_velocities[3ul * j + 1ul],
+                     global_velocities[3ul * j + 2ul]};
+  }
+  return velocities;
+}
+
 boost::optional<double>
 mpi_lb_get_interpolated_density(Utils::Vector3d const &pos) {
   return detail::lb_calc_for_pos(pos, [&](auto pos) {
@@ -24,9 +24,16 @@
 #include <boost/optional.hpp>
 #include <utils/Vector.hpp>
 
+#include <vector>
+
 /* collective getter functions */
 boost::optional<Utils::Vector3d>
 mpi_lb_get_interpolated_velocity(Utils::Vector3d const &pos);
+std::vector<Utils::Vector3d> mpi_lb_get_interpolated_velocities(
+    std::vector<Utils::Vector3d> const &positions);
+std::vector<Utils::Vector3d>
+mpi_lb_get_velocities_in_box(Utils::Vector3i const &lower,
+                             Utils::Vector3i const &upper);
 boost::optional<double>
 mpi_lb_get_interpolated_density(Utils::Vector3d const &pos);
 boost::optional<double> mpi_lb_get_density(Utils::Vector3i const &index);
@@ -35,7 +35,9 @@
 
 #include <utils/Vector.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <limits>
 #include <sstream>
@@ -590,7 +592,22 @@ void lb_lbfluid_print_vtk_velocity(const std::string &filename,
     });
 #endif //  CUDA
   } else {
-    vtk_writer("lbfluid_cpu", lb_lbnode_get_velocity);
+    /* Gather one z-plane of the bounding box per collective instead of
+     * issuing two collectives per lattice node; the write loop runs with
+     * the z index outermost, so every plane is fetched exactly once. */
+    std::vector<Utils::Vector3d> plane;
+    auto plane_z = -1;
+    vtk_writer("lbfluid_cpu", [&](Utils::Vector3i const &pos) {
+      if (pos[2] != plane_z) {
+        plane = mpi_lb_get_velocities_in_box(
+            {bb_low[0], bb_low[1], pos[2]},
+            {bb_high[0], bb_high[1], pos[2] + 1});
+        plane_z = pos[2];
+      }
+      auto const stride = bb_high[0] - bb_low[0];
+      return plane[static_cast<std::size_t>(
+          (pos[1] - bb_low[1]) * stride + (pos[0] - bb_low[0]))];
+    });
   }
   cpfile.close();
 }
@@ -675,11 +692,18 @@ void lb_lbfluid_print_velocity(const std::string &filename) {
     auto const grid_size = lb_lbfluid_get_shape();
     auto const lattice_speed = lb_lbfluid_get_lattice_speed();
     Utils::Vector3i pos;
-    for (pos[2] = 0; pos[2] < grid_size[2]; pos[2]++)
+    for (pos[2] = 0; pos[2] < grid_size[2]; pos[2]++) {
+      /* one collective per z-plane instead of two per lattice node */
+      auto const plane = mpi_lb_get_velocities_in_box(
+          {0, 0, pos[2]}, {grid_size[0], grid_size[1], pos[2] + 1});
       for (pos[1] = 0; pos[1] < grid_size[1]; pos[1]++)
-        for (pos[0] = 0; pos[0] < grid_size[0]; pos[0]++)
+        for (pos[0] = 0; pos[0] < grid_size[0]; pos[0]++) {
+          auto const &velocity = plane[static_cast<std::size_t>(
+              pos[1] * grid_size[0] + pos[0])];
           cpfile << vtk_format << (pos + shift) * agrid << " " << vtk_format
-                 << lb_lbnode_get_velocity(pos) * lattice_speed << "\n";
+                 << velocity * lattice_speed << "\n";
+        }
+    }
   }
 
   cpfile.close();
@@ -878,6 +902,47 @@ void lb_lbfluid_load_checkpoint(const std::string &filename, bool binary) {
   }
 }
 
+/** Rank-local buffer filled by @ref lb_lbfluid_store_population_snapshot. */
+static std::vector<double> population_snapshot;
+
+static void mpi_lb_store_population_snapshot_local() {
+  population_snapshot = lb_save_population_snapshot();
+}
+
+REGISTER_CALLBACK(mpi_lb_store_population_snapshot_local)
+
+static void mpi_lb_restore_population_snapshot_local() {
+  try {
+    lb_load_population_snapshot(population_snapshot);
+  } catch (std::runtime_error const &err) {
+    runtimeErrorMsg() << err.what();
+  }
+}
+
+REGISTER_CALLBACK(mpi_lb_restore_population_snapshot_local)
+
+void lb_lbfluid_store_population_snapshot() {
+  if (lattice_switch == ActiveLB::CPU) {
+    mpi_call_all(mpi_lb_store_population_snapshot_local);
+  } else if (lattice_switch == ActiveLB::GPU) {
+    throw std::runtime_error(
+        "Population snapshots are not implemented for the GPU LB.");
+  } else {
+    throw NoLBActive();
+  }
+}
+
+void lb_lbfluid_restore_population_snapshot() {
+  if (lattice_switch == ActiveLB::CPU) {
+    mpi_call_all(mpi_lb_restore_population_snapshot_local);
+  } else if (lattice_switch == ActiveLB::GPU) {
+    throw std::runtime_error(
+        "Population snapshots are not implemented for the GPU LB.");
+  } else {
+    throw NoLBActive();
+  }
+}
+
 Utils::Vector3i lb_lbfluid_get_shape() {
   if (lattice_switch == ActiveLB::GPU) {
 #ifdef CUDA
@@ -1149,6 +1214,42 @@ lb_lbfluid_get_interpolated_velocity(const Utils::Vector3d &pos) {
   throw NoLBActive();
 }
 
+std::vector<Utils::Vector3d> lb_lbfluid_get_interpolated_velocities(
+    std::vector<Utils::Vector3d> const &positions) {
+  std::vector<Utils::Vector3d> folded_positions(positions.size());
+  std::transform(positions.begin(), positions.end(), folded_positions.begin(),
+                 [](auto const &pos) { return folded_position(pos, box_geo); });
+  auto const interpolation_order = lb_lbinterpolation_get_interpolation_order();
+  if (lattice_switch == ActiveLB::GPU) {
+#ifdef CUDA
+    std::vector<Utils::Vector3d> velocities(positions.size());
+    switch (interpolation_order) {
+    case (InterpolationOrder::linear):
+      lb_get_interpolated_velocity_gpu<8>(
+          folded_positions.data()->data(), velocities.data()->data(),
+          static_cast<int>(positions.size()));
+      break;
+    case (InterpolationOrder::quadratic):
+      lb_get_interpolated_velocity_gpu<27>(
+          folded_positions.data()->data(), velocities.data()->data(),
+          static_cast<int>(positions.size()));
+      break;
+    }
+    return velocities;
+#endif
+  }
+  if (lattice_switch == ActiveLB::CPU) {
+    switch (interpolation_order) {
+    case (InterpolationOrder::quadratic):
+      throw std::runtime_error("The non-linear interpolation scheme is not "
+                               "implemented for the CPU LB.");
+    case (InterpolationOrder::linear):
+      return mpi_lb_get_interpolated_velocities(folded_positions);
+    }
+  }
+  throw NoLBActive();
+}
+
 double lb_lbfluid_get_interpolated_density(const Utils::Vector3d &pos) {
   auto const folded_pos = folded_position(pos, box_geo);
   auto const interpolation_order = lb_lbinterpolation_get_interpolation_order();
@@ -238,6 +238,23 @@ void lb_lbfluid_print_velocity(const std::string &filename);
 void lb_lbfluid_save_checkpoint(const std::string &filename, bool binary);
 void lb_lbfluid_load_checkpoint(const std::string &filename, bool binary);
 
+/**
+ * @brief Store the LB fluid populations in a rank-local in-memory snapshot.
+ *
+ * Unlike @ref lb_lbfluid_save_checkpoint, the snapshot stays in memory
+ * and includes the halo layers, so it is suitable for iterative protocols
+ * that roll the fluid back repeatedly.
+ */
+void lb_lbfluid_store_population_snapshot();
+
+/**
+ * @brief Restore the LB fluid populations from the in-memory snapshot.
+ *
+ * The snapshot must have been taken with the current lattice by
+ * @ref lb_lbfluid_store_population_snapshot.
+ */
+void lb_lbfluid_restore_population_snapshot();
+
 /**
  * @brief Checks whether the given node index is within the LB lattice.
  */
@@ -258,6 +275,22 @@ Utils::Vector3d lb_lbfluid_calc_fluid_momentum();
 const Utils::Vector3d
 lb_lbfluid_get_interpolated_velocity(const Utils::Vector3d &pos);
 
+/**
+ * @brief Calculates the interpolated fluid velocity at several positions
+ * on the head node process.
+ *
+ * For the CPU fluid, each rank interpolates the positions it owns and
+ * the results are reduced in a single collective operation, instead of
+ * one round trip per position as in
+ * @ref lb_lbfluid_get_interpolated_velocity. For the GPU fluid, all
+ * positions are handled by a single kernel launch.
+ *
+ * @param positions Positions at which the velocity is to be calculated.
+ * @retval interpolated fluid velocities.
+ */
+std::vector<Utils::Vector3d> lb_lbfluid_get_interpolated_velocities(
+    std::vector<Utils::Vector3d> const &positions);
+
 /**
  * @brief Calculates the interpolated fluid density on the head node process.
  * @param pos Position at which the density is to be calculated.
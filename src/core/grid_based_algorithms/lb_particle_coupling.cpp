@@ -312,19 +312,20 @@ void lb_lbcoupling_calc_particle_lattice_ia(bool couple_virtual,
           if (p.is_virtual() and !couple_virtual)
             return;
 
-          // Calculate coupling force
+          auto const halo_positions = positions_in_halo(p.pos(), box_geo);
+
+          // Calculate coupling force; @ref positions_in_halo only
+          // returns positions inside the local halo, so the first one
+          // (if any) can be used directly
           Utils::Vector3d force = {};
-          for (auto pos : positions_in_halo(p.pos(), box_geo)) {
-            if (in_local_halo(pos)) {
-              force = lb_viscous_coupling(p, pos,
-                                          noise_amplitude * f_random(p.id()));
-              break;
-            }
+          if (not halo_positions.empty()) {
+            force = lb_viscous_coupling(p, halo_positions.front(),
+                                        noise_amplitude * f_random(p.id()));
           }
 
           // couple positions including shifts by one box length to add
           // forces to ghost layers
-          for (auto pos : positions_in_halo(p.pos(), box_geo)) {
+          for (auto const &pos : halo_positions) {
             if (in_local_domain(pos)) {
               /* if the particle is in our LB volume, this node
                * is responsible to adding its force */
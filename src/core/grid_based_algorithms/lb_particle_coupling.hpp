@@ -32,6 +32,18 @@
  *  So far, only viscous coupling with Stokesian friction is implemented.
  *  Include all particle-lattice forces in this function.
  *  The function is called from \ref force_calc.
+ *
+ *  The fluid does not have to be propagated every MD step: with
+ *  <tt>tau = n * time_step</tt> the integrator sub-cycles the LB update
+ *  (see the <tt>lb_steps_per_md_step</tt> logic in integrate.cpp) and
+ *  the coupling samples a fluid velocity that is piecewise constant
+ *  over the n MD steps in between. Interpolating the fluid velocity in
+ *  time as well would require keeping the populations of the previous
+ *  LB step alive, doubling the fluid memory; the friction coupling is
+ *  only first order accurate in tau, so the constant interpolation is
+ *  consistent with the overall order of the scheme. The thermalization
+ *  remains correct because the noise amplitude is derived from the MD
+ *  time step, not from tau.
  */
 void lb_lbcoupling_calc_particle_lattice_ia(bool couple_virtual,
                                             const ParticleRange &particles,
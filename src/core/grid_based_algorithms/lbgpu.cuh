@@ -32,7 +32,21 @@
 
 #include <utils/Array.hpp>
 
-/** Velocity densities for the lattice Boltzmann system. */
+/** Velocity densities for the lattice Boltzmann system.
+ *
+ *  The populations dominate the memory traffic of the fused
+ *  collide-stream kernel (one read and one write of all 19 per node
+ *  and step), so storing them as @c __half with float compute would
+ *  nearly halve the bandwidth cost. Plain rounding of the absolute
+ *  populations is not accurate enough, however: the physics lives in
+ *  the small deviation from the local equilibrium, so an FP16 mode
+ *  has to store that deviation (with the equilibrium reconstructed
+ *  from the conserved moments on load) to keep the quantization below
+ *  the thermalization noise. Every other reader of this array
+ *  (boundaries, particle coupling, the observable getters) would need
+ *  the same conversion, which is why this is a storage-mode switch on
+ *  this struct and not a kernel-local change.
+ */
 struct LB_nodes_gpu {
   /** velocity density of the node */
   Utils::Array<float, 19> *populations = nullptr;
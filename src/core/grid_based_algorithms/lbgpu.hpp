@@ -146,6 +146,7 @@ struct LB_rho_v_gpu {
 void lb_GPU_sanity_checks();
 
 void lb_get_boundary_force_pointer(float **pointer_address);
+void lb_get_boundary_flag_pointer(unsigned int **pointer_address);
 void lb_get_para_pointer(LB_parameters_gpu **pointer_address);
 
 /** Perform a full initialization of the lattice Boltzmann system.
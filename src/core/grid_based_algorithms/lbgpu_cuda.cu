@@ -2039,6 +2039,11 @@ void lb_get_boundary_force_pointer(float **pointer_address) {
 #endif
 }
 
+void lb_get_boundary_flag_pointer(unsigned int **pointer_address) {
+  /* nodes_a and nodes_b share the flag array, cf. lb_init_GPU */
+  *pointer_address = nodes_a.boundary;
+}
+
 /** Initialization for the lb gpu fluid called from host
  *  @param lbpar_gpu   Pointer to parameters to setup the lb field
  */
@@ -2451,9 +2456,11 @@ void lb_integrate_GPU() {
       calculate_dim_grid(lbpar_gpu.number_of_nodes, 4, threads_per_block);
 #ifdef LB_BOUNDARIES_GPU
   if (!LBBoundaries::lbboundaries.empty()) {
+    /* clear on the stream the kernels run on, without a host sync */
     cuda_safe_mem(
-        cudaMemset(lb_boundary_force, 0,
-                   3 * LBBoundaries::lbboundaries.size() * sizeof(float)));
+        cudaMemsetAsync(lb_boundary_force, 0,
+                        3 * LBBoundaries::lbboundaries.size() * sizeof(float),
+                        stream[0]));
   }
 #endif
 
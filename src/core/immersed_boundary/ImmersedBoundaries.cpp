@@ -32,8 +32,15 @@
 #include <utils/Vector.hpp>
 #include <utils/constants.hpp>
 
+#include <boost/mpi/collectives/all_gather.hpp>
 #include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/vector.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -59,9 +66,16 @@ void ImmersedBoundaries::init_volume_conservation(CellStructure &cs) {
   }
 
   if (!VolumeInitDone && BoundariesFound) {
-    // Calculate volumes
+    // Calculate volumes. With an empty triangle tally, calc_volumes falls
+    // back to the dense reduction, so all ranks obtain all volumes and the
+    // reference volumes below are set consistently everywhere.
+    TrianglesTotal.clear();
     calc_volumes(cs);
 
+    // Tally the triangles of each object, so that calc_volumes can
+    // recognize objects local to one rank and skip communicating them
+    count_triangles(cs);
+
     // Loop through all bonded interactions and check if we need to set the
     // reference volume
     for (auto &kv : bonded_ia_params) {
@@ -90,8 +104,46 @@ static const IBMVolCons *vol_cons_parameters(Particle const &p1) {
              : nullptr;
 }
 
+double ImmersedBoundaries::get_current_volume(int softID) const {
+  assert(softID >= 0);
+  assert(static_cast<std::size_t>(softID) < VolumesCurrent.size());
+  // ranks with a stale entry contribute zero; volumes are positive, so the
+  // maximum picks the up-to-date value of the rank(s) holding the object
+  auto const local = VolumesValid[softID] ? VolumesCurrent[softID] : 0.;
+  return boost::mpi::all_reduce(comm_cart, local,
+                                boost::mpi::maximum<double>());
+}
+
+/** Count the triangles of each object over all ranks. */
+void ImmersedBoundaries::count_triangles(CellStructure &cs) {
+  std::vector<int> count(VolumesCurrent.size());
+
+  cs.bond_loop(
+      [&count](Particle &p1, int bond_id, Utils::Span<Particle *>) {
+        auto vol_cons_params = vol_cons_parameters(p1);
+
+        if (vol_cons_params &&
+            boost::get<IBMTriel>(bonded_ia_params.at(bond_id).get()) !=
+                nullptr) {
+          count[vol_cons_params->softID]++;
+        }
+        return false;
+      });
+
+  TrianglesTotal.resize(count.size());
+  boost::mpi::all_reduce(comm_cart, count.data(),
+                         static_cast<int>(count.size()), TrianglesTotal.data(),
+                         std::plus<int>());
+}
+
 /** Calculate partial volumes on all compute nodes and call MPI to sum up.
  *  See @cite zhang01b, @cite dupin08a, @cite kruger12a.
+ *
+ *  Most objects are spatially compact, so usually all triangles of an
+ *  object reside on one rank and its volume is complete without any
+ *  communication. Only the partial volumes of objects whose triangles
+ *  cross a rank boundary are exchanged, instead of a dense reduction
+ *  over all objects.
  */
 void ImmersedBoundaries::calc_volumes(CellStructure &cs) {
 
@@ -100,10 +152,12 @@ void ImmersedBoundaries::calc_volumes(CellStructure &cs) {
 
   // Partial volumes for each soft particle, to be summed up
   std::vector<double> tempVol(VolumesCurrent.size());
+  // Number of triangles of each soft particle on this rank
+  std::vector<int> count(VolumesCurrent.size());
 
   // Loop over all particles on local node
-  cs.bond_loop([&tempVol](Particle &p1, int bond_id,
-                          Utils::Span<Particle *> partners) {
+  cs.bond_loop([&tempVol, &count](Particle &p1, int bond_id,
+                                  Utils::Span<Particle *> partners) {
     auto vol_cons_params = vol_cons_parameters(p1);
 
     if (vol_cons_params &&
@@ -140,14 +194,51 @@ void ImmersedBoundaries::calc_volumes(CellStructure &cs) {
 
       tempVol[vol_cons_params->softID] +=
           1.0 / 6.0 * (-v321 + v231 + v312 - v132 - v213 + v123);
+      count[vol_cons_params->softID]++;
     }
     return false;
   });
 
-  // Sum up and communicate
-  boost::mpi::all_reduce(comm_cart, tempVol.data(),
-                         static_cast<int>(tempVol.size()),
-                         VolumesCurrent.data(), std::plus<double>());
+  if (TrianglesTotal.size() != tempVol.size()) {
+    // The triangle tally is not available: sum up and communicate the
+    // volumes of all objects
+    boost::mpi::all_reduce(comm_cart, tempVol.data(),
+                           static_cast<int>(tempVol.size()),
+                           VolumesCurrent.data(), std::plus<double>());
+    std::fill(VolumesValid.begin(), VolumesValid.end(), 1);
+    return;
+  }
+
+  // Volumes of objects local to this rank are complete without
+  // communication; only partial volumes of rank-crossing objects are
+  // exchanged
+  std::vector<std::pair<int, double>> partial;
+  for (std::size_t softID = 0; softID < tempVol.size(); ++softID) {
+    if (count[softID] == 0) {
+      VolumesValid[softID] = 0;
+    } else if (count[softID] == TrianglesTotal[softID]) {
+      VolumesCurrent[softID] = tempVol[softID];
+      VolumesValid[softID] = 1;
+    } else {
+      partial.emplace_back(static_cast<int>(softID), tempVol[softID]);
+      VolumesValid[softID] = 0;
+    }
+  }
+
+  std::vector<std::vector<std::pair<int, double>>> gathered;
+  boost::mpi::all_gather(comm_cart, partial, gathered);
+
+  // Summing in rank order makes the result identical on all ranks
+  for (auto const &contributions : gathered) {
+    for (auto const &contribution : contributions) {
+      auto const softID = contribution.first;
+      if (!VolumesValid[softID]) {
+        VolumesCurrent[softID] = 0.;
+        VolumesValid[softID] = 1;
+      }
+      VolumesCurrent[softID] += contribution.second;
+    }
+  }
 }
 
 /** Calculate and add the volume force to each node */
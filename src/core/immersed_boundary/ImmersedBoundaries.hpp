@@ -31,6 +31,7 @@ class ImmersedBoundaries {
 public:
   ImmersedBoundaries() : VolumeInitDone(false), BoundariesFound(false) {
     VolumesCurrent.resize(10);
+    VolumesValid.resize(10);
   }
   void init_volume_conservation(CellStructure &cs);
   void volume_conservation(CellStructure &cs);
@@ -39,19 +40,30 @@ public:
     auto const new_size = static_cast<std::size_t>(softID) + 1;
     if (new_size > VolumesCurrent.size()) {
       VolumesCurrent.resize(new_size);
+      VolumesValid.resize(new_size);
     }
   }
-  double get_current_volume(int softID) const {
-    assert(softID >= 0);
-    assert(softID < VolumesCurrent.size());
-    return VolumesCurrent[softID];
-  }
+  /** Get the volume of an object. The volume of an object whose triangles
+   *  all reside on one rank is only known on that rank, so this is a
+   *  collective call.
+   */
+  double get_current_volume(int softID) const;
 
 private:
   void calc_volumes(CellStructure &cs);
   void calc_volume_force(CellStructure &cs);
+  void count_triangles(CellStructure &cs);
 
   std::vector<double> VolumesCurrent;
+  /** Whether the corresponding entry of @ref VolumesCurrent is up-to-date
+   *  on this rank. Volumes of objects whose triangles all reside on one
+   *  rank are not communicated and go stale on the other ranks.
+   */
+  std::vector<char> VolumesValid;
+  /** Total number of triangles of each object, used to recognize objects
+   *  whose triangles all reside on this rank.
+   */
+  std::vector<int> TrianglesTotal;
   bool VolumeInitDone;
   bool BoundariesFound;
 };
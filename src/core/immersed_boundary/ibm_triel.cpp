@@ -42,7 +42,8 @@ namespace {
  */
 std::tuple<Utils::Vector3d, Utils::Vector3d, Utils::Vector3d>
 RotateForces(Utils::Vector2d const &f1_rot, Utils::Vector2d const &f2_rot,
-             Utils::Vector3d const &v12, Utils::Vector3d const &v13) {
+             Utils::Vector3d const &v12, Utils::Vector3d const &v13,
+             double l12) {
   // fRot is in the rotated system, i.e. in a system where the side lPrime of
   // the triangle (i.e. v12) is parallel to the x-axis, and the y-axis is
   // perpendicular to the x-axis (cf. Krueger, Fig. 7.1c).
@@ -53,8 +54,8 @@ RotateForces(Utils::Vector2d const &f1_rot, Utils::Vector2d const &f2_rot,
   // is therefore: fRot[XX]*xu
 
   // xu is simple: The x-axis in the rotated system is parallel to v12 --> xu =
-  // v12 (+ normalization)
-  auto const xu = Utils::Vector3d(v12).normalize();
+  // v12 (+ normalization; the norm of v12 is already known to the caller)
+  auto const xu = v12 / l12;
 
   // yu needs to be orthogonal to xu, and point in the direction of node 3 in
   // Krueger, Fig. 7.1b. Therefore: First get the projection of v13 onto v12:
@@ -125,35 +126,28 @@ IBMTriel::calc_forces(Particle const &p1, Particle const &p2,
     dEdI2 = -k1 / 6.0 + k2 * i2 / 6.0;
   }
 
-  // Derivatives of Is: eq. (C.15)
-  const double dI1dGxx = 1;
-  const double dI1dGxy = 0;
-  const double dI1dGyx = 0;
-  const double dI1dGyy = 1;
-
-  const double dI2dGxx = Gyy;
-  const double dI2dGxy = -Gyx; // Note: Krueger has a factor 2 here, because he
-                               // uses the symmetry of the G-matrix.
-  const double dI2dGyx = -Gxy; // But we don't use it. So, Krueger is missing
-                               // the yx term, whereas we have it.
-  const double dI2dGyy = Gxx;
-
-  // Derivatives of G: eq. (C.16)
+  // Derivatives of Is: eq. (C.15). dI1/dG is the unit matrix and dI2/dG is
+  // the adjugate of G, so the chain rule below collapses to one coefficient
+  // per component of G:
+  // dE/dGab = dEdI1 * dI1/dGab + dEdI2 * dI2/dGab
+  // Note: Krueger has a factor 2 for the xy-element, because he uses the
+  // symmetry of the G-matrix. We don't use it above, but since Dyx = 0
+  // implies Gyx = Gxy and dGyx/dV = dGxy/dV (eq. (C.16)), the xy- and
+  // yx-contributions to the chain rule are identical and are folded into a
+  // single coefficient with the factor 2 here.
+  const double dEdGxx = dEdI1 + dEdI2 * Gyy;
+  const double dEdGxy = -2 * dEdI2 * Gxy;
+  const double dEdGyy = dEdI1 + dEdI2 * Gxx;
+
+  // Derivatives of G: eq. (C.16); dGxxdV1y and dGxxdV2y vanish
   const double dGxxdV1x = 2 * a1 * Dxx;
-  const double dGxxdV1y = 0;
   const double dGxxdV2x = 2 * a2 * Dxx;
-  const double dGxxdV2y = 0;
 
   const double dGxydV1x = a1 * Dxy + b1 * Dxx;
   const double dGxydV1y = a1 * Dyy;
   const double dGxydV2x = a2 * Dxy + b2 * Dxx;
   const double dGxydV2y = a2 * Dyy;
 
-  const double dGyxdV1x = a1 * Dxy + b1 * Dxx;
-  const double dGyxdV1y = a1 * Dyy;
-  const double dGyxdV2x = a2 * Dxy + b2 * Dxx;
-  const double dGyxdV2y = a2 * Dyy;
-
   const double dGyydV1x = 2 * b1 * Dxy;
   const double dGyydV1y = 2 * b1 * Dyy;
   const double dGyydV2x = 2 * b2 * Dxy;
@@ -162,35 +156,21 @@ IBMTriel::calc_forces(Particle const &p1, Particle const &p2,
   // Calculate forces per area in rotated system: chain rule as in appendix C of
   // Krüger (chain rule applied in eq. (C.13), but for the energy density). Only
   // two nodes are needed, third one is calculated from momentum conservation
-  // Note: If you calculate the derivatives in a straightforward manner, you get
-  // 8 terms (done here). Krueger exploits the symmetry of the G-matrix, which
-  // results in 6 elements, but with an additional factor 2 for the xy-elements
-  // (see also above at the definition of dI2dGxy).
   Utils::Vector2d f1_rot{};
   Utils::Vector2d f2_rot{};
-  f1_rot[0] = -(dEdI1 * dI1dGxx * dGxxdV1x) - (dEdI1 * dI1dGxy * dGxydV1x) -
-              (dEdI1 * dI1dGyx * dGyxdV1x) - (dEdI1 * dI1dGyy * dGyydV1x) -
-              (dEdI2 * dI2dGxx * dGxxdV1x) - (dEdI2 * dI2dGxy * dGxydV1x) -
-              (dEdI2 * dI2dGyx * dGyxdV1x) - (dEdI2 * dI2dGyy * dGyydV1x);
-  f1_rot[1] = -(dEdI1 * dI1dGxx * dGxxdV1y) - (dEdI1 * dI1dGxy * dGxydV1y) -
-              (dEdI1 * dI1dGyx * dGyxdV1y) - (dEdI1 * dI1dGyy * dGyydV1y) -
-              (dEdI2 * dI2dGxx * dGxxdV1y) - (dEdI2 * dI2dGxy * dGxydV1y) -
-              (dEdI2 * dI2dGyx * dGyxdV1y) - (dEdI2 * dI2dGyy * dGyydV1y);
-  f2_rot[0] = -(dEdI1 * dI1dGxx * dGxxdV2x) - (dEdI1 * dI1dGxy * dGxydV2x) -
-              (dEdI1 * dI1dGyx * dGyxdV2x) - (dEdI1 * dI1dGyy * dGyydV2x) -
-              (dEdI2 * dI2dGxx * dGxxdV2x) - (dEdI2 * dI2dGxy * dGxydV2x) -
-              (dEdI2 * dI2dGyx * dGyxdV2x) - (dEdI2 * dI2dGyy * dGyydV2x);
-  f2_rot[1] = -(dEdI1 * dI1dGxx * dGxxdV2y) - (dEdI1 * dI1dGxy * dGxydV2y) -
-              (dEdI1 * dI1dGyx * dGyxdV2y) - (dEdI1 * dI1dGyy * dGyydV2y) -
-              (dEdI2 * dI2dGxx * dGxxdV2y) - (dEdI2 * dI2dGxy * dGxydV2y) -
-              (dEdI2 * dI2dGyx * dGyxdV2y) - (dEdI2 * dI2dGyy * dGyydV2y);
+  f1_rot[0] =
+      -(dEdGxx * dGxxdV1x) - (dEdGxy * dGxydV1x) - (dEdGyy * dGyydV1x);
+  f1_rot[1] = -(dEdGxy * dGxydV1y) - (dEdGyy * dGyydV1y);
+  f2_rot[0] =
+      -(dEdGxx * dGxxdV2x) - (dEdGxy * dGxydV2x) - (dEdGyy * dGyydV2x);
+  f2_rot[1] = -(dEdGxy * dGxydV2y) - (dEdGyy * dGyydV2y);
 
   // Multiply by undeformed area
   f1_rot *= area0;
   f2_rot *= area0;
 
   // Rotate forces back into original position of triangle
-  auto forces = RotateForces(f1_rot, f2_rot, vec1, vec2);
+  auto forces = RotateForces(f1_rot, f2_rot, vec1, vec2, lp);
 
   return {forces};
 }
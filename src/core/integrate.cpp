@@ -58,6 +58,9 @@
 
 #include <profiler/profiler.hpp>
 
+#include <utils/math/sqr.hpp>
+
+#include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/range/algorithm/min_element.hpp>
 
@@ -91,8 +94,40 @@ bool recalc_forces = true;
 /** Average number of integration steps the Verlet list has been re-using. */
 static double verlet_reuse = 0.0;
 
+/** Moving average of the maximal particle displacement per integration
+ *  step, measured between Verlet list rebuilds. */
+static double max_displacement_rate = 0.0;
+
+/** Integration steps since the last Verlet list rebuild. */
+static int steps_since_verlet_update = 0;
+
 static int fluid_step = 0;
 
+bool monitor_verlet_drift = false;
+double verlet_drift_kinetic = 0.;
+double verlet_drift_work = 0.;
+double verlet_drift_tolerance = 0.;
+
+double get_verlet_drift() {
+  auto const drift_local = verlet_drift_kinetic - verlet_drift_work;
+  double drift = 0.;
+  boost::mpi::all_reduce(comm_cart, drift_local, drift, std::plus<double>{});
+  return drift;
+}
+
+void reset_verlet_drift() {
+  verlet_drift_kinetic = 0.;
+  verlet_drift_work = 0.;
+}
+
+void set_verlet_drift_tolerance(double value) {
+  if (value < 0.)
+    throw std::domain_error("verlet_drift_tolerance must be >= 0.");
+  ::verlet_drift_tolerance = value;
+  ::monitor_verlet_drift = value > 0.;
+  reset_verlet_drift();
+}
+
 bool set_py_interrupt = false;
 namespace {
 volatile std::sig_atomic_t ctrl_C = 0;
@@ -185,8 +220,24 @@ void integrator_sanity_checks() {
 static void resort_particles_if_needed(ParticleRange const &particles) {
   auto const offset = LeesEdwards::verlet_list_offset(
       box_geo, cell_structure.get_le_pos_offset_at_last_resort());
-  if (cell_structure.check_resort_required(particles, skin, offset)) {
+
+  ++steps_since_verlet_update;
+  auto max_disp2 = 0.;
+  for (auto const &p : particles) {
+    max_disp2 = std::max(
+        max_disp2, (p.pos() - p.pos_at_last_verlet_update()).norm2());
+  }
+
+  auto const lim = Utils::sqr(skin / 2.) - offset.norm2();
+  if (max_disp2 > lim) {
     cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+    /* Update the drift estimate used for skin prediction. */
+    auto const rate = std::sqrt(max_disp2) /
+                      static_cast<double>(steps_since_verlet_update);
+    max_displacement_rate =
+        (max_displacement_rate == 0.) ? rate
+                                      : 0.5 * (max_displacement_rate + rate);
+    steps_since_verlet_update = 0;
   }
 }
 
@@ -251,6 +302,17 @@ static void integrator_step_2(ParticleRange const &particles, double kT) {
   }
 }
 
+/* Early exit from the integration loop exists in three forms: the
+ * steepest-descent convergence check (via integrator_step_1), runtime
+ * errors, and SIGINT. A registry of user-defined stop criteria (force
+ * norm threshold, plane crossing, energy plateau) could hook into the
+ * same spot after force_calc, where positions and forces are fresh,
+ * with one all_reduce over the rank-local verdicts per step. Force- and
+ * position-based criteria are cheap there; energy-based ones are not,
+ * since energies are never computed during plain integration and would
+ * add a full sweep per step. Such criteria would be script-interface
+ * objects, evaluated rank-locally like constraints are.
+ */
 int integrate(int n_steps, int reuse_forces) {
   ESPRESSO_PROFILER_CXX_MARK_FUNCTION;
 
@@ -277,7 +339,7 @@ int integrate(int n_steps, int reuse_forces) {
 
     if (integ_switch != INTEG_METHOD_STEEPEST_DESCENT) {
 #ifdef ROTATION
-      convert_initial_torques(cell_structure.local_particles());
+      convert_initial_torques(cell_structure.local_particles(), time_step);
 #endif
     }
 
@@ -295,6 +357,18 @@ int integrate(int n_steps, int reuse_forces) {
 #ifdef VALGRIND_MARKERS
   CALLGRIND_START_INSTRUMENTATION;
 #endif
+  /* The step below is a fixed call sequence, and that is not an
+   * accident of history: almost every phase reads and writes the same
+   * per-particle records, so the ordering expresses real data
+   * dependencies, not scheduling convenience. The phases that look
+   * independent (e.g. volume conservation vs. electrostatics) meet in
+   * the force accumulators, and the MPI collectives inside the phases
+   * require all ranks to traverse them in the same order anyway, so a
+   * task graph over this loop would rediscover a chain. The genuine
+   * overlap opportunities are asymmetric-resource ones: GPU actors
+   * launching before the CPU pair loop and long-range communication
+   * overlapping local work, both tracked where they apply (see
+   * force_calc and calc_long_range_forces in forces.cpp). */
   // Integration loop
   ESPRESSO_PROFILER_CXX_MARK_LOOP_BEGIN(integration_loop, "Integration loop");
   int integrated_steps = 0;
@@ -384,6 +458,18 @@ int integrate(int n_steps, int reuse_forces) {
 
     integrated_steps++;
 
+    if (monitor_verlet_drift) {
+      /* conservation watchdog: one scalar reduction per step instead of
+       * the extra force sweep a periodic energy calculation would cost */
+      auto const drift = get_verlet_drift();
+      if (std::abs(drift) > verlet_drift_tolerance) {
+        runtimeErrorMsg() << "velocity Verlet energy drift estimate " << drift
+                          << " exceeds the tolerance "
+                          << verlet_drift_tolerance
+                          << "; verify with a full energy calculation";
+      }
+    }
+
     if (check_runtime_errors(comm_cart))
       break;
 
@@ -509,6 +595,13 @@ double interaction_range() {
 
 double get_verlet_reuse() { return verlet_reuse; }
 
+double predict_skin_for_reuse(double target_reuse) {
+  /* A rebuild is triggered when the maximal displacement exceeds half
+   * the skin, so a reuse of n steps needs a skin of twice the drift
+   * accumulated over n steps. */
+  return 2. * max_displacement_rate * target_reuse;
+}
+
 double get_time_step() { return time_step; }
 
 double get_sim_time() { return sim_time; }
@@ -35,6 +35,15 @@
 #define INTEG_METHOD_BD 3
 #define INTEG_METHOD_SD 7
 /**@}*/
+/* A multiple time-step (r-RESPA) method evaluating the Coulomb far field
+ * only every n-th step would slot in here, but it is not a matter of adding
+ * a switch: all force contributions are accumulated into the single
+ * per-particle force buffer by @ref force_calc, so the long-range part
+ * cannot be reused for the inner steps without a second force buffer
+ * threaded through the propagation kernels, and the thermostat forces
+ * (which must act on the innermost time scale) are applied inside the same
+ * force loop. Both would have to be untangled first.
+ */
 
 /** Switch determining which integrator to use. */
 extern int integ_switch;
@@ -48,6 +57,44 @@ extern bool recalc_forces;
 /** Communicate signal handling to the Python interpreter */
 extern bool set_py_interrupt;
 
+/** @name Conservation watchdog.
+ *
+ *  When @ref monitor_verlet_drift is set, the Velocity Verlet kernels
+ *  accumulate the kinetic energy change and the work done by the forces
+ *  along the propagated displacements. Their running difference is a
+ *  first-order estimate of the total energy drift that costs a few
+ *  flops per particle and step, instead of the extra force sweep a
+ *  periodic energy calculation performs. For a conservative NVE run the
+ *  estimate stays bounded; a growing value indicates drift and is the
+ *  trigger to verify with a full energy calculation. The estimate is
+ *  meaningless when a thermostat adds non-conservative forces.
+ *
+ *  The watchdog is armed by setting a positive
+ *  @ref verlet_drift_tolerance; once the accumulated estimate exceeds
+ *  the tolerance, the integration loop reports a runtime error.
+ */
+/**@{*/
+/** @brief Whether the Velocity Verlet kernels accumulate the drift
+ *  estimate. */
+extern bool monitor_verlet_drift;
+/** @brief Accumulated kinetic energy change (local to this rank). */
+extern double verlet_drift_kinetic;
+/** @brief Accumulated force work (local to this rank). */
+extern double verlet_drift_work;
+/** @brief Drift magnitude that triggers the alarm (0 = watchdog off). */
+extern double verlet_drift_tolerance;
+/** @brief Accumulated drift estimate, reduced over all ranks.
+ *  Must be called on all ranks. */
+double get_verlet_drift();
+/** @brief Restart drift accumulation from zero. */
+void reset_verlet_drift();
+/** @brief Set @ref verlet_drift_tolerance and restart the accumulation.
+ *  A positive value arms the watchdog, zero disarms it.
+ *  @throws std::domain_error if the tolerance is negative.
+ */
+void set_verlet_drift_tolerance(double value);
+/**@}*/
+
 double interaction_range();
 
 /** Check integrator parameters and incompatibilities between the integrator
@@ -125,6 +172,13 @@ int mpi_steepest_descent(int steps);
 /** Get @c verlet_reuse */
 double get_verlet_reuse();
 
+/** Predict the skin that would yield approximately @p target_reuse
+ *  integration steps between Verlet list rebuilds, extrapolated from
+ *  the maximal particle displacement rate observed so far. Returns 0
+ *  if no rebuild has been observed yet.
+ */
+double predict_skin_for_reuse(double target_reuse);
+
 /** Get time step */
 double get_time_step();
 
@@ -32,6 +32,18 @@
 
 #include <utils/math/sqr.hpp>
 
+/** Brownian dynamics propagator.
+ *
+ *  The propagation is deliberately per particle rather than a fused
+ *  sweep over SoA buffers: particles live in the cell structure's AoS
+ *  layout, the fixed-coordinate and external-force flags are checked
+ *  inside the bd_* kernels where they interact with the per-coordinate
+ *  logic, and the noise is keyed on the particle id so that results do
+ *  not depend on traversal order. A SoA fast path would mean gathering
+ *  and scattering all positions, velocities and forces every step,
+ *  which for the diffusive BD workload costs about as much memory
+ *  traffic as the propagation itself.
+ */
 inline void brownian_dynamics_propagator(BrownianThermostat const &brownian,
                                          const ParticleRange &particles,
                                          double time_step, double kT) {
@@ -27,6 +27,8 @@
 #include "integrate.hpp"
 #include "rotation.hpp"
 
+#include <utils/math/sqr.hpp>
+
 /** Propagate the velocities and positions. Integration steps before force
  *  calculation of the Velocity Verlet integrator: <br> \f[ v(t+0.5 \Delta t) =
  *  v(t) + 0.5 \Delta t f(t)/m \f] <br> \f[ p(t+\Delta t) = p(t) + \Delta t
@@ -45,12 +47,22 @@ inline void velocity_verlet_propagate_vel_pos(const ParticleRange &particles,
       continue;
     for (int j = 0; j < 3; j++) {
       if (!p.is_fixed_along(j)) {
+        auto const v_old = p.v()[j];
+
         /* Propagate velocities: v(t+0.5*dt) = v(t) + 0.5 * dt * a(t) */
         p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
 
         /* Propagate positions (only NVT): p(t + dt)   = p(t) + dt *
          * v(t+0.5*dt) */
         p.pos()[j] += time_step * p.v()[j];
+
+        if (monitor_verlet_drift) {
+          /* half-kick kinetic energy change and the old force's half
+           * of the trapezoidal work along the displacement dt*v */
+          verlet_drift_kinetic +=
+              0.5 * p.mass() * (Utils::sqr(p.v()[j]) - Utils::sqr(v_old));
+          verlet_drift_work += 0.5 * p.force()[j] * time_step * p.v()[j];
+        }
       }
     }
   }
@@ -69,8 +81,20 @@ inline void velocity_verlet_propagate_vel_final(const ParticleRange &particles,
 
     for (int j = 0; j < 3; j++) {
       if (!p.is_fixed_along(j)) {
+        auto const v_half = p.v()[j];
+
         /* Propagate velocity: v(t+dt) = v(t+0.5*dt) + 0.5*dt * a(t+dt) */
         p.v()[j] += 0.5 * time_step * p.force()[j] / p.mass();
+
+        if (monitor_verlet_drift) {
+          /* second half-kick and the new force's half of the work;
+           * the displacement of step 1 was dt*v(t+0.5*dt), which is
+           * still in v_half since the velocity is untouched between
+           * the two half-kicks */
+          verlet_drift_kinetic +=
+              0.5 * p.mass() * (Utils::sqr(p.v()[j]) - Utils::sqr(v_half));
+          verlet_drift_work += 0.5 * p.force()[j] * time_step * v_half;
+        }
       }
     }
   }
@@ -79,6 +79,27 @@ void velocity_verlet_npt_finalize_p_inst(double time_step) {
     }
   }
 
+  if (nptiso.directional) {
+    /* each fluctuating direction drives its own piston, so the diagonal
+     * pressure components have to be reduced individually */
+    Utils::Vector3d p_sum_dir{};
+    boost::mpi::reduce(comm_cart, nptiso.p_vir + nptiso.p_vel, p_sum_dir,
+                       std::plus<Utils::Vector3d>(), 0);
+    if (this_node == 0) {
+      nptiso.p_inst = 0.0;
+      for (int i = 0; i < 3; i++) {
+        if (nptiso.geometry & ::nptgeom_dir[i]) {
+          auto const p_inst_dir = p_sum_dir[i] / nptiso.volume_dir[i];
+          nptiso.p_inst += p_inst_dir / nptiso.dimension;
+          nptiso.p_diff_dir[i] +=
+              (p_inst_dir - nptiso.p_ext) * 0.5 * time_step +
+              friction_thermV_nptiso(npt_iso, nptiso.p_diff_dir[i], i);
+        }
+      }
+    }
+    return;
+  }
+
   double p_sum = 0.0;
   boost::mpi::reduce(comm_cart, nptiso.p_inst, p_sum, std::plus<double>(), 0);
   if (this_node == 0) {
@@ -88,6 +109,73 @@ void velocity_verlet_npt_finalize_p_inst(double time_step) {
   }
 }
 
+/** Anisotropic box update for \ref NptIsoParameters::directional box
+ *  motion. Every fluctuating direction carries its own piston momentum
+ *  and box length, so the box relaxes like in simultaneous 1d NpT
+ *  integrations which share the external pressure and piston mass.
+ */
+static void
+velocity_verlet_npt_propagate_pos_directional(ParticleRange const &particles,
+                                              double time_step) {
+  Utils::Vector3d scal_pos{}, scal_pos_vel{}, scal_vel{};
+  Utils::Vector3d new_box{};
+
+  if (this_node == 0) {
+    new_box = box_geo.length();
+    for (int i = 0; i < 3; i++) {
+      if (!(nptiso.geometry & ::nptgeom_dir[i]))
+        continue;
+      nptiso.volume_dir[i] +=
+          nptiso.inv_piston * nptiso.p_diff_dir[i] * 0.5 * time_step;
+      scal_pos_vel[i] = Utils::sqr(box_geo.length()[i] / nptiso.volume_dir[i]);
+      nptiso.volume_dir[i] +=
+          nptiso.inv_piston * nptiso.p_diff_dir[i] * 0.5 * time_step;
+      if (nptiso.volume_dir[i] < 0.0) {
+        runtimeErrorMsg() << "your choice of piston= " << nptiso.piston
+                          << ", dt= " << time_step
+                          << ", p_diff= " << nptiso.p_diff_dir[i]
+                          << " just caused the box length in direction " << i
+                          << " to become negative, decrease dt";
+        nptiso.volume_dir[i] = box_geo.length()[i];
+        scal_pos_vel[i] = 1;
+      }
+      new_box[i] = nptiso.volume_dir[i];
+      scal_pos[i] = new_box[i] * box_geo.length_inv()[i];
+      scal_vel[i] = 1. / scal_pos[i];
+    }
+  }
+  boost::mpi::broadcast(comm_cart, scal_pos, 0);
+  boost::mpi::broadcast(comm_cart, scal_pos_vel, 0);
+  boost::mpi::broadcast(comm_cart, scal_vel, 0);
+
+  /* propagate positions while rescaling positions and velocities */
+  for (auto &p : particles) {
+    if (p.is_virtual())
+      continue;
+    for (int j = 0; j < 3; j++) {
+      if (!p.is_fixed_along(j)) {
+        if (nptiso.geometry & ::nptgeom_dir[j]) {
+          p.pos()[j] = scal_pos[j] *
+                       (p.pos()[j] + scal_pos_vel[j] * p.v()[j] * time_step);
+          p.pos_at_last_verlet_update()[j] *= scal_pos[j];
+          p.v()[j] *= scal_vel[j];
+        } else {
+          p.pos()[j] += p.v()[j] * time_step;
+        }
+      }
+    }
+  }
+
+  cell_structure.set_resort_particles(Cells::RESORT_LOCAL);
+
+  /* Apply the new box lengths, communicate them, and account for
+   * necessary adjustments to the cell geometry */
+  boost::mpi::broadcast(comm_cart, new_box, 0);
+  box_geo.set_length(new_box);
+  // fast box length update
+  on_boxl_change(true);
+}
+
 void velocity_verlet_npt_propagate_pos(const ParticleRange &particles,
                                        double time_step) {
   Utils::Vector3d scal{};
@@ -96,6 +184,11 @@ void velocity_verlet_npt_propagate_pos(const ParticleRange &particles,
   /* finalize derivation of p_inst */
   velocity_verlet_npt_finalize_p_inst(time_step);
 
+  if (nptiso.directional) {
+    velocity_verlet_npt_propagate_pos_directional(particles, time_step);
+    return;
+  }
+
   /* adjust \ref NptIsoParameters::nptiso.volume; prepare pos- and
    * vel-rescaling
    */
@@ -20,6 +20,7 @@
  */
 
 #include "bonded_interactions/bonded_interaction_data.hpp"
+#include "cells.hpp"
 #include "collision.hpp"
 #include "communication.hpp"
 #include "electrostatics/coulomb.hpp"
@@ -52,9 +53,11 @@ double maximal_cutoff(bool single_node) {
   auto const max_cut_nonbonded = maximal_cutoff_nonbonded();
 
   max_cut = std::max(max_cut, max_cut_long_range);
-  if (not single_node) {
+  if (not single_node and not ::cell_structure.fetch_bond_partners) {
     // If there is just one node, the bonded cutoff can be omitted
-    // because bond partners are always on the local node.
+    // because bond partners are always on the local node. With the
+    // direct bond partner fetch, remote partners are retrieved by id,
+    // so they do not constrain the ghost layer either.
     max_cut = std::max(max_cut, max_cut_bonded);
   }
   max_cut = std::max(max_cut, max_cut_nonbonded);
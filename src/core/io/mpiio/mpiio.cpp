@@ -211,6 +211,15 @@ static void dump_info(const std::string &fn, unsigned fields) {
   static_cast<void>(success or fatal_error("Could not write file", fn));
 }
 
+/* One file per field keeps the format trivially self-describing: each
+ * file is a flat array of one POD type, offsets follow from the prefix
+ * sums in the .pref file, and fields can be added without versioning.
+ * The price is several small collective writes per dump, which is
+ * hostile to striped filesystems. Folding everything into one sectioned
+ * file with stripe-aligned section offsets is a format break: readers
+ * and the existing .head/.pref/.id bootstrap logic all change together,
+ * so it should be introduced as a v2 side by side with this format, not
+ * by mutating it. */
 void mpi_mpiio_common_write(const std::string &prefix, unsigned fields,
                             const ParticleRange &particles) {
   auto const nlocalpart = static_cast<unsigned long>(particles.size());
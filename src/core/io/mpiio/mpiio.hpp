@@ -23,6 +23,17 @@
 
 /** @file
  *  Implements binary output using MPI-IO.
+ *
+ *  Every dump is a full snapshot. Incremental checkpoints (deltas of
+ *  the rarely-changing fields against a base snapshot) would need the
+ *  core to track which particles changed since the last dump, and the
+ *  cell structure has no such dirty flags: positions change for all
+ *  particles every step anyway, and property or bond changes arrive
+ *  through callbacks that do not record their target. The position and
+ *  velocity blocks, which dominate the volume, would be written in
+ *  full either way, so the realistic saving is limited to the type and
+ *  bond files and does not justify a delta format with a base-file
+ *  dependency chain in restore.
  */
 
 #include "ParticleRange.hpp"
@@ -178,6 +178,16 @@ static std::vector<hsize_t> create_chunk_dims(hsize_t rank, hsize_t data_dim) {
   }
 }
 
+/* The datasets are chunked (a prerequisite for filters) but written
+ * uncompressed in native double precision. Adding a deflate filter
+ * here is a two-line h5xx storage-policy change, but it only takes
+ * effect for parallel writes when the HDF5 library supports collective
+ * filtered I/O (1.10.2+), and compressed chunks serialize the chunk
+ * ownership between ranks, so it must remain opt-in. Reduced-precision
+ * float32 positions change the declared dataset types in the H5MD
+ * specification table above and are a file-format decision for
+ * downstream tooling, not something to toggle silently. Both need a
+ * user-facing switch on the checkpoint object before they land here. */
 void File::create_datasets() {
   namespace hps = h5xx::policy::storage;
   for (const auto &d : m_h5md_specification.get_datasets()) {
@@ -351,6 +361,17 @@ static void write_le_normal(LeesEdwardsBC const &lebc, h5xx::dataset &dataset) {
                       h5xx::slice(Vector2hs{extents[0], 0}, Vector2hs{1, 1}));
 }
 
+/* The write is synchronous and collective: every dataset extension is
+ * a collective HDF5 metadata operation, so all ranks stall for the
+ * duration of the dump. Overlapping it with integration would require
+ * staging the particle data into a snapshot buffer and handing it to a
+ * writer thread, but collective HDF5 calls may not be issued from a
+ * thread concurrently with MPI traffic of the integration loop unless
+ * the MPI library runs in MPI_THREAD_MULTIPLE mode, which ESPResSo
+ * does not request. Until the init path negotiates that (at a known
+ * performance cost on some fabrics), the dump stays on the critical
+ * path and its cost is controlled by writing fewer fields or less
+ * often. */
 void File::write(const ParticleRange &particles, double time, int step,
                  BoxGeometry const &geometry) {
   if (m_fields & H5MD_OUT_BOX_L) {
@@ -86,6 +86,19 @@ inline Utils::Vector3d shear_direction(BoxGeometry const &box) {
   return Utils::unit_vector<double>(box.lees_edwards_bc().shear_direction);
 }
 
+/** @brief Skin budget consumed by the shear flow since the last resort.
+ *
+ *  Pair distances are always evaluated with the current position
+ *  offset through the minimum image convention, so an evolving offset
+ *  does not stale the distances stored in the Verlet list; what it
+ *  does is shift which image pairs across the shear boundary fall
+ *  within cutoff + skin, i.e. it erodes the coverage of the list.
+ *  Tagging pairs with their image flag cannot recover pairs the list
+ *  never contained, hence the accumulated offset is subtracted from
+ *  the skin budget of the rebuild criterion instead. The criterion is
+ *  conservative in that it charges all particles for an offset that
+ *  only affects pairs spanning the boundary.
+ */
 inline Utils::Vector3d verlet_list_offset(BoxGeometry const &box,
                                           double pos_offset_at_last_resort) {
   if (box.type() == BoxType::LEES_EDWARDS) {
@@ -138,6 +138,26 @@ template <typename F> void for_each_image(Utils::Vector3i const &ncut, F f) {
       boost::counting_range(-ncut[2], ncut[2] + 1));
 }
 
+/**
+ * @brief Collect the image box shift vectors for an image cut-off.
+ *
+ * The image loop is hot: it runs once per particle pair. Precomputing
+ * the shift vectors replaces the per-pair index arithmetic and sphere
+ * test by a linear sweep over this table. The shift of the primary box
+ * is stored first, so that pair sums which exclude the primary image
+ * can simply skip the first entry.
+ */
+auto image_shifts(Utils::Vector3i const &ncut, Utils::Vector3d const &box_l) {
+  std::vector<Utils::Vector3d> shifts = {Utils::Vector3d{}};
+  for_each_image(ncut, [&](int nx, int ny, int nz) {
+    if (nx != 0 or ny != 0 or nz != 0) {
+      shifts.emplace_back(
+          Utils::Vector3d{nx * box_l[0], ny * box_l[1], nz * box_l[2]});
+    }
+  });
+  return shifts;
+}
+
 /**
  * @brief Position and dipole moment of one particle.
  */
@@ -165,8 +185,7 @@ struct PosMom {
  * @param with_replicas If periodic replicas are to be considered
  *        at all. If false, distances are calulated as Euclidean
  *        distances, and not using minimum image convention.
- * @param ncut Number of replicas in each direction.
- * @param box_l Box dimensions.
+ * @param shifts Image box shifts from @ref image_shifts.
  * @param init Initial value of the sum.
  * @param f Binary operation mapping distance and moment of the
  *          interaction partner to the value to be summed up for this pair.
@@ -175,8 +194,8 @@ struct PosMom {
  */
 template <class InputIterator, class T, class F>
 T image_sum(InputIterator begin, InputIterator end, InputIterator it,
-            bool with_replicas, Utils::Vector3i const &ncut,
-            Utils::Vector3d const &box_l, T init, F f) {
+            bool with_replicas, std::vector<Utils::Vector3d> const &shifts,
+            T init, F f) {
 
   for (auto jt = begin; jt != end; ++jt) {
     auto const exclude_primary = (it == jt);
@@ -184,14 +203,11 @@ T image_sum(InputIterator begin, InputIterator end, InputIterator it,
         (with_replicas) ? (it->pos - jt->pos)
                         : ::box_geo.get_mi_vector(it->pos, jt->pos);
 
-    for_each_image(ncut, [&](int nx, int ny, int nz) {
-      if (!(exclude_primary && nx == 0 && ny == 0 && nz == 0)) {
-        auto const rn =
-            primary_distance +
-            Utils::Vector3d{nx * box_l[0], ny * box_l[1], nz * box_l[2]};
-        init += f(rn, jt->m);
-      }
-    });
+    /* the primary box shift is the first entry of the table */
+    auto const first_image = shifts.begin() + (exclude_primary ? 1 : 0);
+    for (auto shift = first_image; shift != shifts.end(); ++shift) {
+      init += f(primary_distance + *shift, jt->m);
+    }
   }
 
   return init;
@@ -275,6 +291,7 @@ void DipolarDirectSum::add_long_range_forces(
   /* Number of image boxes considered */
   auto const ncut = get_n_cut(n_replicas);
   auto const with_replicas = (ncut.norm2() > 0);
+  auto const shifts = image_shifts(ncut, box_l);
 
   /* Range of particles we calculate the ia for on this node */
   auto const local_posmom_begin = all_posmom.begin() + offset;
@@ -288,7 +305,7 @@ void DipolarDirectSum::add_long_range_forces(
   for (auto it = local_posmom_begin; it != local_posmom_end; ++it, ++p) {
     /* IA with own images */
     auto fi = image_sum(
-        it, std::next(it), it, with_replicas, ncut, box_l, ParticleForce{},
+        it, std::next(it), it, with_replicas, shifts, ParticleForce{},
         [it](Utils::Vector3d const &rn, Utils::Vector3d const &mj) {
           return pair_force(rn, it->m, mj);
         });
@@ -302,16 +319,15 @@ void DipolarDirectSum::add_long_range_forces(
 
       ParticleForce fij{};
       ParticleForce fji{};
-      for_each_image(ncut, [&](int nx, int ny, int nz) {
-        auto const rn =
-            d + Utils::Vector3d{nx * box_l[0], ny * box_l[1], nz * box_l[2]};
+      for (auto const &shift : shifts) {
+        auto const rn = d + shift;
         auto const pf = pair_force(rn, it->m, jt->m);
         fij += pf;
         fji.f -= pf.f;
         /* Conservation of angular momentum mandates that
          * 0 = t_i + r_ij x F_ij + t_j */
         fji.torque += vector_product(pf.f, rn) - pf.torque;
-      });
+      }
 
       fi += fij;
       (*q)->f.f += prefactor * fji.f;
@@ -333,14 +349,14 @@ void DipolarDirectSum::add_long_range_forces(
     // red particles
     auto fi =
         image_sum(all_posmom.begin(), local_posmom_begin, it, with_replicas,
-                  ncut, box_l, ParticleForce{},
+                  shifts, ParticleForce{},
                   [it](Utils::Vector3d const &rn, Utils::Vector3d const &mj) {
                     return pair_force(rn, it->m, mj);
                   });
 
     // black particles
-    fi += image_sum(local_posmom_end, all_posmom.end(), it, with_replicas, ncut,
-                    box_l, ParticleForce{},
+    fi += image_sum(local_posmom_end, all_posmom.end(), it, with_replicas,
+                    shifts, ParticleForce{},
                     [it](Utils::Vector3d const &rn, Utils::Vector3d const &mj) {
                       return pair_force(rn, it->m, mj);
                     });
@@ -364,6 +380,7 @@ DipolarDirectSum::long_range_energy(ParticleRange const &particles) const {
   /* Number of image boxes considered */
   auto const ncut = get_n_cut(n_replicas);
   auto const with_replicas = (ncut.norm2() > 0);
+  auto const shifts = image_shifts(ncut, box_l);
 
   /* Wait for the rest of the data to arrive */
   boost::mpi::wait_all(reqs.begin(), reqs.end());
@@ -375,7 +392,7 @@ DipolarDirectSum::long_range_energy(ParticleRange const &particles) const {
 
   auto u = 0.;
   for (auto it = local_posmom_begin; it != local_posmom_end; ++it) {
-    u = image_sum(it, all_posmom.end(), it, with_replicas, ncut, box_l, u,
+    u = image_sum(it, all_posmom.end(), it, with_replicas, shifts, u,
                   [it](Utils::Vector3d const &rn, Utils::Vector3d const &mj) {
                     return pair_potential(rn, it->m, mj);
                   });
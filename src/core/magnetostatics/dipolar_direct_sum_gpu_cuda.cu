@@ -34,6 +34,12 @@
 #error CU-file includes mpi.h! This should not happen!
 #endif
 
+/** @brief Box geometry data, passed to the kernels by value. */
+struct BoxDataGpu {
+  float box_l[3];
+  int periodic[3];
+};
+
 __device__ inline float scalar_product(float const *a, float const *b) {
   return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
 }
@@ -134,8 +140,7 @@ __device__ float dipole_ia_energy(float pf, float const *r1, float const *r2,
 
 __global__ void DipolarDirectSum_kernel_force(float pf, unsigned int n,
                                               float *pos, float *dip, float *f,
-                                              float *torque, float box_l[3],
-                                              int periodic[3]) {
+                                              float *torque, BoxDataGpu box) {
 
   auto const i = blockIdx.x * blockDim.x + threadIdx.x;
 
@@ -166,7 +171,7 @@ __global__ void DipolarDirectSum_kernel_force(float pf, unsigned int n,
 
   for (unsigned int j = i + 1; j < n; j++) {
     dipole_ia_force(pf, pos + 3 * i, pos + 3 * j, dip + 3 * i, dip + 3 * j, fi,
-                    ti, tj, box_l, periodic);
+                    ti, tj, box.box_l, box.periodic);
     for (unsigned int k = 0; k < 3; k++) {
       // Add rhs to global memory
       atomicAdd(f + 3 * j + k, -fi[k]);
@@ -200,7 +205,7 @@ __device__ void dds_sumReduction(float *input, float *sum) {
 
 __global__ void DipolarDirectSum_kernel_energy(float pf, unsigned int n,
                                                float *pos, float *dip,
-                                               float box_l[3], int periodic[3],
+                                               BoxDataGpu box,
                                                float *energySum) {
 
   auto const i = blockIdx.x * blockDim.x + threadIdx.x;
@@ -216,7 +221,7 @@ __global__ void DipolarDirectSum_kernel_energy(float pf, unsigned int n,
     // Summation for particle i
     for (unsigned int j = i + 1; j < n; j++) {
       sum += dipole_ia_energy(pf, pos + 3 * i, pos + 3 * j, dip + 3 * i,
-                              dip + 3 * j, box_l, periodic);
+                              dip + 3 * j, box.box_l, box.periodic);
     }
 
     // Save per thread result into block shared mem
@@ -229,15 +234,10 @@ __global__ void DipolarDirectSum_kernel_energy(float pf, unsigned int n,
   dds_sumReduction(res, &(energySum[blockIdx.x]));
 }
 
-inline void copy_box_data(float **box_l_gpu, int **periodic_gpu,
-                          float const *box_l, int const *periodic) {
-  auto const s_box = 3u * sizeof(float);
-  auto const s_per = 3u * sizeof(int);
-  cuda_safe_mem(cudaMalloc(reinterpret_cast<void **>(box_l_gpu), s_box));
-  cuda_safe_mem(cudaMalloc(reinterpret_cast<void **>(periodic_gpu), s_per));
-  cuda_safe_mem(cudaMemcpy(*box_l_gpu, box_l, s_box, cudaMemcpyHostToDevice));
-  cuda_safe_mem(
-      cudaMemcpy(*periodic_gpu, periodic, s_per, cudaMemcpyHostToDevice));
+/** @brief Pack the box geometry into a kernel argument. */
+inline BoxDataGpu copy_box_data(float const *box_l, int const *periodic) {
+  return BoxDataGpu{{box_l[0], box_l[1], box_l[2]},
+                    {periodic[0], periodic[1], periodic[2]}};
 }
 
 void DipolarDirectSum_kernel_wrapper_force(float k, unsigned int n, float *pos,
@@ -259,14 +259,10 @@ void DipolarDirectSum_kernel_wrapper_force(float k, unsigned int n, float *pos,
     block.x = bs;
   }
 
-  float *box_l_gpu;
-  int *periodic_gpu;
-  copy_box_data(&box_l_gpu, &periodic_gpu, box_l, periodic);
+  auto const box = copy_box_data(box_l, periodic);
 
   KERNELCALL(DipolarDirectSum_kernel_force, grid, block, k, n, pos, dip, f,
-             torque, box_l_gpu, periodic_gpu);
-  cudaFree(box_l_gpu);
-  cudaFree(periodic_gpu);
+             torque, box);
 }
 
 void DipolarDirectSum_kernel_wrapper_energy(float k, unsigned int n, float *pos,
@@ -288,17 +284,14 @@ void DipolarDirectSum_kernel_wrapper_energy(float k, unsigned int n, float *pos,
     block.x = bs;
   }
 
-  float *box_l_gpu;
-  int *periodic_gpu;
-  copy_box_data(&box_l_gpu, &periodic_gpu, box_l, periodic);
+  auto const box = copy_box_data(box_l, periodic);
 
   float *energySum;
   cuda_safe_mem(cudaMalloc(&energySum, sizeof(float) * grid.x));
 
   // This will sum the energies up to the block level
   KERNELCALL_shared(DipolarDirectSum_kernel_energy, grid, block,
-                    bs * sizeof(float), k, n, pos, dip, box_l_gpu, periodic_gpu,
-                    energySum);
+                    bs * sizeof(float), k, n, pos, dip, box, energySum);
 
   // Sum the results of all blocks
   // One thread per block in the prev kernel
@@ -308,8 +301,6 @@ void DipolarDirectSum_kernel_wrapper_energy(float k, unsigned int n, float *pos,
   cuda_safe_mem(cudaMemcpy(E, &x, sizeof(float), cudaMemcpyHostToDevice));
 
   cuda_safe_mem(cudaFree(energySum));
-  cuda_safe_mem(cudaFree(box_l_gpu));
-  cuda_safe_mem(cudaFree(periodic_gpu));
 }
 
 #endif
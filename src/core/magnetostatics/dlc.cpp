@@ -48,6 +48,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <functional>
 #include <numeric>
@@ -102,6 +103,51 @@ static Utils::Vector3d calc_slab_dipole(ParticleRange const &particles) {
   return boost::mpi::all_reduce(comm_cart, local_dip, std::plus<>());
 }
 
+/** @brief Sine and cosine of one trigonometric basis frequency. */
+struct SCCache {
+  double s, c;
+};
+
+/**
+ * @brief Build the per-particle trigonometric basis along one direction.
+ *
+ * Stores the sine and cosine of <tt>k * u * pos[dir]</tt> for the
+ * frequencies <tt>k = 1</tt> to @p kcut, laid out frequency-major.
+ * Only the base frequency requires trigonometric function calls; the
+ * higher harmonics follow from the angle addition theorem.
+ */
+static std::vector<SCCache> calc_trig_cache(ParticleRange const &particles,
+                                            int kcut, double u, int dir) {
+  auto const n_part = particles.size();
+  std::vector<SCCache> ret(static_cast<std::size_t>(kcut) * n_part);
+  std::size_t o = 0;
+  for (auto const &p : particles) {
+    auto const arg = u * p.pos()[dir];
+    ret[o++] = {sin(arg), cos(arg)};
+  }
+  for (int k = 2; k <= kcut; k++) {
+    auto const prev = static_cast<std::size_t>(k - 2) * n_part;
+    for (std::size_t i = 0; i < n_part; i++) {
+      auto const &base = ret[i];
+      auto const &last = ret[prev + i];
+      ret[o++] = {last.s * base.c + last.c * base.s,
+                  last.c * base.c - last.s * base.s};
+    }
+  }
+  return ret;
+}
+
+/** @brief Fetch the sine and cosine of one signed mode from the basis. */
+static SCCache fetch_mode(std::vector<SCCache> const &cache, int k,
+                          std::size_t n_part, std::size_t ip) {
+  if (k == 0) {
+    return {0., 1.};
+  }
+  auto const &sc =
+      cache[static_cast<std::size_t>(std::abs(k) - 1) * n_part + ip];
+  return (k > 0) ? sc : SCCache{-sc.s, sc.c};
+}
+
 /**
  * @brief Compute the dipolar force and torque corrections.
  * %Algorithm implemented accordingly to @cite brodka04a.
@@ -123,6 +169,10 @@ static void dipolar_force_corrections(int kcut,
   std::vector<double> ReGrad_Mum(n_local_particles);
   std::vector<double> ImGrad_Mum(n_local_particles);
 
+  /* per-particle trigonometric basis of the in-plane modes */
+  auto const scx = calc_trig_cache(particles, kcut, facux, 0);
+  auto const scy = calc_trig_cache(particles, kcut, facuy, 1);
+
   for (int ix = -kcut; ix <= +kcut; ix++) {
     for (int iy = -kcut; iy <= +kcut; iy++) {
       if (ix == 0 and iy == 0) {
@@ -147,11 +197,12 @@ static void dipolar_force_corrections(int kcut,
 
           auto const a = gx * dip[0] + gy * dip[1];
           auto const b = gr * dip[2];
-          auto const er = gx * pos[0] + gy * pos[1];
-          auto const ez = gr * pos[2];
-          auto const c = cos(er);
-          auto const d = sin(er);
-          auto const f = exp(ez);
+          auto const sx = fetch_mode(scx, ix, n_local_particles, ip);
+          auto const sy = fetch_mode(scy, iy, n_local_particles, ip);
+          /* cos and sin of gx * x + gy * y from the cached basis */
+          auto const c = sx.c * sy.c - sx.s * sy.s;
+          auto const d = sx.s * sy.c + sx.c * sy.s;
+          auto const f = exp(gr * pos[2]);
 
           ReSjp[ip] = (b * c - a * d) * f;
           ImSjp[ip] = (c * a + b * d) * f;
@@ -246,6 +297,12 @@ static double dipolar_energy_correction(int kcut,
   auto const facux = 2. * Utils::pi() * box_geo.length_inv()[0];
   auto const facuy = 2. * Utils::pi() * box_geo.length_inv()[1];
 
+  auto const n_local_particles = particles.size();
+
+  /* per-particle trigonometric basis of the in-plane modes */
+  auto const scx = calc_trig_cache(particles, kcut, facux, 0);
+  auto const scy = calc_trig_cache(particles, kcut, facuy, 1);
+
   double energy = 0.;
   double sum_S[4] = {0., 0., 0., 0.};
   for (int ix = -kcut; ix <= +kcut; ix++) {
@@ -264,6 +321,7 @@ static double dipolar_energy_correction(int kcut,
 
       double S[4] = {0., 0., 0., 0.}; // S of Brodka method, or is S[4] =
                                       // {Re(S+), Im(S+), Re(S-), Im(S-)}
+      std::size_t ip = 0;
       for (auto const &p : particles) {
         if (p.dipm() != 0.) {
           auto const &pos = p.pos();
@@ -271,17 +329,19 @@ static double dipolar_energy_correction(int kcut,
 
           auto const a = gx * dip[0] + gy * dip[1];
           auto const b = gr * dip[2];
-          auto const er = gx * pos[0] + gy * pos[1];
-          auto const ez = gr * pos[2];
-          auto const c = cos(er);
-          auto const d = sin(er);
-          auto const f = exp(ez);
+          auto const sx = fetch_mode(scx, ix, n_local_particles, ip);
+          auto const sy = fetch_mode(scy, iy, n_local_particles, ip);
+          /* cos and sin of gx * x + gy * y from the cached basis */
+          auto const c = sx.c * sy.c - sx.s * sy.s;
+          auto const d = sx.s * sy.c + sx.c * sy.s;
+          auto const f = exp(gr * pos[2]);
 
           S[0] += (b * c - a * d) * f;
           S[1] += (c * a + b * d) * f;
           S[2] += (-b * c - a * d) / f;
           S[3] += (c * a - b * d) / f;
         }
+        ++ip;
       }
       boost::mpi::reduce(comm_cart, S, 4, sum_S, std::plus<>(), 0);
 
@@ -207,13 +207,11 @@ template <std::size_t cao> struct AssignTorques {
 
     for (auto &p : particles) {
       if (p.dipm() != 0.) {
-        auto const w = dp3m.inter_weights.load<cao>(p_index);
-
         Utils::Vector3d E{};
-        p3m_interpolate(dp3m.local_mesh, w,
-                        [&E, &dp3m, d_rs](int ind, double w) {
-                          E[d_rs] += w * dp3m.rs_mesh[ind];
-                        });
+        p3m_interpolate<cao>(dp3m.local_mesh, dp3m.inter_weights, p_index,
+                             [&E, &dp3m, d_rs](int ind, double w) {
+                               E[d_rs] += w * dp3m.rs_mesh[ind];
+                             });
 
         p.torque() -= vector_product(p.calc_dip(), prefac * E);
         ++p_index;
@@ -231,14 +229,13 @@ template <std::size_t cao> struct AssignForces {
 
     for (auto &p : particles) {
       if (p.dipm() != 0.) {
-        auto const w = dp3m.inter_weights.load<cao>(p_index);
-
         Utils::Vector3d E{};
-        p3m_interpolate(dp3m.local_mesh, w, [&E, &dp3m](int ind, double w) {
-          E[0] += w * dp3m.rs_mesh_dip[0][ind];
-          E[1] += w * dp3m.rs_mesh_dip[1][ind];
-          E[2] += w * dp3m.rs_mesh_dip[2][ind];
-        });
+        p3m_interpolate<cao>(dp3m.local_mesh, dp3m.inter_weights, p_index,
+                             [&E, &dp3m](int ind, double w) {
+                               E[0] += w * dp3m.rs_mesh_dip[0][ind];
+                               E[1] += w * dp3m.rs_mesh_dip[1][ind];
+                               E[2] += w * dp3m.rs_mesh_dip[2][ind];
+                             });
 
         p.force()[d_rs] += p.calc_dip() * prefac * E;
         ++p_index;
@@ -286,24 +283,20 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
       i = 0;
       double node_k_space_energy_dip = 0.0;
       for (j[0] = 0; j[0] < dp3m.fft.plan[3].new_mesh[0]; j[0]++) {
+        auto const d_op_0 = dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]];
         for (j[1] = 0; j[1] < dp3m.fft.plan[3].new_mesh[1]; j[1]++) {
+          auto const d_op_1 = dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
           for (j[2] = 0; j[2] < dp3m.fft.plan[3].new_mesh[2]; j[2]++) {
+            auto const d_op_2 =
+                dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]];
             node_k_space_energy_dip +=
                 dp3m.g_energy[i] *
-                (Utils::sqr(
-                     dp3m.rs_mesh_dip[0][ind] *
-                         dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] +
-                     dp3m.rs_mesh_dip[1][ind] *
-                         dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] +
-                     dp3m.rs_mesh_dip[2][ind] *
-                         dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]]) +
-                 Utils::sqr(
-                     dp3m.rs_mesh_dip[0][ind + 1] *
-                         dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] +
-                     dp3m.rs_mesh_dip[1][ind + 1] *
-                         dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] +
-                     dp3m.rs_mesh_dip[2][ind + 1] *
-                         dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]]));
+                (Utils::sqr(dp3m.rs_mesh_dip[0][ind] * d_op_2 +
+                            dp3m.rs_mesh_dip[1][ind] * d_op_0 +
+                            dp3m.rs_mesh_dip[2][ind] * d_op_1) +
+                 Utils::sqr(dp3m.rs_mesh_dip[0][ind + 1] * d_op_2 +
+                            dp3m.rs_mesh_dip[1][ind + 1] * d_op_0 +
+                            dp3m.rs_mesh_dip[2][ind + 1] * d_op_1));
             ind += 2;
             i++;
           }
@@ -342,25 +335,23 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
       i = 0;
 
       for (j[0] = 0; j[0] < dp3m.fft.plan[3].new_mesh[0]; j[0]++) { // j[0]=n_y
+        auto const d_op_0 = dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]];
         for (j[1] = 0; j[1] < dp3m.fft.plan[3].new_mesh[1];
              j[1]++) { // j[1]=n_z
+          auto const d_op_1 = dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
           for (j[2] = 0; j[2] < dp3m.fft.plan[3].new_mesh[2];
                j[2]++) { // j[2]=n_x
+            auto const d_op_2 =
+                dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]];
             // tmp0 = Re(mu)*k,   tmp1 = Im(mu)*k
 
-            tmp0 = dp3m.rs_mesh_dip[0][ind] *
-                       dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] +
-                   dp3m.rs_mesh_dip[1][ind] *
-                       dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] +
-                   dp3m.rs_mesh_dip[2][ind] *
-                       dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
+            tmp0 = dp3m.rs_mesh_dip[0][ind] * d_op_2 +
+                   dp3m.rs_mesh_dip[1][ind] * d_op_0 +
+                   dp3m.rs_mesh_dip[2][ind] * d_op_1;
 
-            tmp1 = dp3m.rs_mesh_dip[0][ind + 1] *
-                       dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] +
-                   dp3m.rs_mesh_dip[1][ind + 1] *
-                       dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] +
-                   dp3m.rs_mesh_dip[2][ind + 1] *
-                       dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
+            tmp1 = dp3m.rs_mesh_dip[0][ind + 1] * d_op_2 +
+                   dp3m.rs_mesh_dip[1][ind + 1] * d_op_0 +
+                   dp3m.rs_mesh_dip[2][ind + 1] * d_op_1;
 
             /* the optimal influence function is the same for torques
                and energy */
@@ -379,13 +370,11 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
         for (j[0] = 0; j[0] < dp3m.fft.plan[3].new_mesh[0]; j[0]++) {
           for (j[1] = 0; j[1] < dp3m.fft.plan[3].new_mesh[1]; j[1]++) {
             for (j[2] = 0; j[2] < dp3m.fft.plan[3].new_mesh[2]; j[2]++) {
-              dp3m.rs_mesh[ind] =
-                  dp3m.d_op[0][j[d] + dp3m.fft.plan[3].start[d]] *
-                  dp3m.ks_mesh[ind];
+              auto const d_op_d =
+                  dp3m.d_op[0][j[d] + dp3m.fft.plan[3].start[d]];
+              dp3m.rs_mesh[ind] = d_op_d * dp3m.ks_mesh[ind];
               ind++;
-              dp3m.rs_mesh[ind] =
-                  dp3m.d_op[0][j[d] + dp3m.fft.plan[3].start[d]] *
-                  dp3m.ks_mesh[ind];
+              dp3m.rs_mesh[ind] = d_op_d * dp3m.ks_mesh[ind];
               ind++;
             }
           }
@@ -413,23 +402,21 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
       ind = 0;
       i = 0;
       for (j[0] = 0; j[0] < dp3m.fft.plan[3].new_mesh[0]; j[0]++) { // j[0]=n_y
+        auto const d_op_0 = dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]];
         for (j[1] = 0; j[1] < dp3m.fft.plan[3].new_mesh[1];
              j[1]++) { // j[1]=n_z
+          auto const d_op_1 = dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
           for (j[2] = 0; j[2] < dp3m.fft.plan[3].new_mesh[2];
                j[2]++) { // j[2]=n_x
+            auto const d_op_2 =
+                dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]];
             // tmp0 = Im(mu)*k,   tmp1 = -Re(mu)*k
-            tmp0 = dp3m.rs_mesh_dip[0][ind + 1] *
-                       dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] +
-                   dp3m.rs_mesh_dip[1][ind + 1] *
-                       dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] +
-                   dp3m.rs_mesh_dip[2][ind + 1] *
-                       dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
-            tmp1 = dp3m.rs_mesh_dip[0][ind] *
-                       dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] +
-                   dp3m.rs_mesh_dip[1][ind] *
-                       dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] +
-                   dp3m.rs_mesh_dip[2][ind] *
-                       dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
+            tmp0 = dp3m.rs_mesh_dip[0][ind + 1] * d_op_2 +
+                   dp3m.rs_mesh_dip[1][ind + 1] * d_op_0 +
+                   dp3m.rs_mesh_dip[2][ind + 1] * d_op_1;
+            tmp1 = dp3m.rs_mesh_dip[0][ind] * d_op_2 +
+                   dp3m.rs_mesh_dip[1][ind] * d_op_0 +
+                   dp3m.rs_mesh_dip[2][ind] * d_op_1;
             dp3m.ks_mesh[ind] = tmp0 * dp3m.g_force[i];
             dp3m.ks_mesh[ind + 1] = -tmp1 * dp3m.g_force[i];
             ind += 2;
@@ -444,27 +431,25 @@ double DipolarP3M::kernel(bool force_flag, bool energy_flag,
         ind = 0;
         for (j[0] = 0; j[0] < dp3m.fft.plan[3].new_mesh[0];
              j[0]++) { // j[0]=n_y
+          auto const d_op_0 = dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]];
           for (j[1] = 0; j[1] < dp3m.fft.plan[3].new_mesh[1];
                j[1]++) { // j[1]=n_z
+            auto const d_op_1 = dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]];
             for (j[2] = 0; j[2] < dp3m.fft.plan[3].new_mesh[2];
                  j[2]++) { // j[2]=n_x
-              tmp0 = dp3m.d_op[0][j[d] + dp3m.fft.plan[3].start[d]] *
-                     dp3m.ks_mesh[ind];
-              dp3m.rs_mesh_dip[0][ind] =
-                  dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] * tmp0;
-              dp3m.rs_mesh_dip[1][ind] =
-                  dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] * tmp0;
-              dp3m.rs_mesh_dip[2][ind] =
-                  dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]] * tmp0;
+              auto const d_op_2 =
+                  dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]];
+              auto const d_op_d =
+                  dp3m.d_op[0][j[d] + dp3m.fft.plan[3].start[d]];
+              tmp0 = d_op_d * dp3m.ks_mesh[ind];
+              dp3m.rs_mesh_dip[0][ind] = d_op_2 * tmp0;
+              dp3m.rs_mesh_dip[1][ind] = d_op_0 * tmp0;
+              dp3m.rs_mesh_dip[2][ind] = d_op_1 * tmp0;
               ind++;
-              tmp0 = dp3m.d_op[0][j[d] + dp3m.fft.plan[3].start[d]] *
-                     dp3m.ks_mesh[ind];
-              dp3m.rs_mesh_dip[0][ind] =
-                  dp3m.d_op[0][j[2] + dp3m.fft.plan[3].start[2]] * tmp0;
-              dp3m.rs_mesh_dip[1][ind] =
-                  dp3m.d_op[0][j[0] + dp3m.fft.plan[3].start[0]] * tmp0;
-              dp3m.rs_mesh_dip[2][ind] =
-                  dp3m.d_op[0][j[1] + dp3m.fft.plan[3].start[1]] * tmp0;
+              tmp0 = d_op_d * dp3m.ks_mesh[ind];
+              dp3m.rs_mesh_dip[0][ind] = d_op_2 * tmp0;
+              dp3m.rs_mesh_dip[1][ind] = d_op_0 * tmp0;
+              dp3m.rs_mesh_dip[2][ind] = d_op_1 * tmp0;
               ind++;
             }
           }
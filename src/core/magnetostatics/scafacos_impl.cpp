@@ -35,6 +35,7 @@
 #include <utils/matrix.hpp>
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -45,18 +46,24 @@ make_dipolar_scafacos(std::string const &method,
 }
 
 void DipolarScafacosImpl::update_particle_data() {
-  positions.clear();
-  dipoles.clear();
+  auto const particles = cell_structure.local_particles();
 
-  for (auto const &p : cell_structure.local_particles()) {
+  /* buffers are persistent members: the capacity acquired here is
+   * kept and reused across integration steps */
+  positions.resize(3ul * particles.size());
+  dipoles.resize(3ul * particles.size());
+
+  std::size_t j = 0ul;
+  for (auto const &p : particles) {
     auto const pos = folded_position(p.pos(), box_geo);
-    positions.push_back(pos[0]);
-    positions.push_back(pos[1]);
-    positions.push_back(pos[2]);
+    positions[3ul * j + 0ul] = pos[0];
+    positions[3ul * j + 1ul] = pos[1];
+    positions[3ul * j + 2ul] = pos[2];
     auto const dip = p.calc_dip();
-    dipoles.push_back(dip[0]);
-    dipoles.push_back(dip[1]);
-    dipoles.push_back(dip[2]);
+    dipoles[3ul * j + 0ul] = dip[0];
+    dipoles[3ul * j + 1ul] = dip[1];
+    dipoles[3ul * j + 2ul] = dip[2];
+    ++j;
   }
 }
 
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2010-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memory_stats.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace MemoryStats {
+
+static std::map<std::string, Usage> subsystems;
+static std::size_t total_peak = 0u;
+
+void track(std::string const &subsystem, std::size_t bytes) {
+  auto &entry = subsystems[subsystem];
+  entry.current = bytes;
+  entry.peak = std::max(entry.peak, bytes);
+
+  std::size_t total = 0u;
+  for (auto const &kv : subsystems) {
+    total += kv.second.current;
+  }
+  total_peak = std::max(total_peak, total);
+}
+
+std::map<std::string, Usage> const &usage() { return subsystems; }
+
+std::size_t peak_total() { return total_peak; }
+
+} // namespace MemoryStats
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2010-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef ESPRESSO_SRC_CORE_MEMORY_STATS_HPP
+#define ESPRESSO_SRC_CORE_MEMORY_STATS_HPP
+
+/** @file
+ *  Rank-local accounting of the large simulation buffers.
+ *
+ *  The dominant consumers of memory (cell system buffers, ghost
+ *  communication buffers, P3M meshes, the LB lattice, GPU particle
+ *  buffers) all live in standard containers with the default allocator,
+ *  so instead of threading a counting allocator through every container
+ *  type, each subsystem samples the capacity of its buffers right after
+ *  it (re)allocates them. Since (re)allocation is the only place where
+ *  the held memory changes, the sampled peaks are exact for the tracked
+ *  buffers. The numbers are rank-local; resize events are collective,
+ *  so the per-rank peaks are comparable across ranks.
+ *
+ *  Implementation in memory_stats.cpp.
+ */
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace MemoryStats {
+
+/** @brief Currently held and peak bytes of one subsystem buffer. */
+struct Usage {
+  std::size_t current = 0u;
+  std::size_t peak = 0u;
+};
+
+/** @brief Record the bytes currently held by a subsystem.
+ *
+ *  Called by the subsystem after it (re)allocated its buffers, with
+ *  the total capacity of those buffers. Updates the subsystem peak
+ *  and the peak of the sum over all tracked subsystems.
+ *
+ *  @param subsystem Identifier, e.g. <tt>"cells.verlet_list"</tt>.
+ *  @param bytes     Bytes currently held by the subsystem.
+ */
+void track(std::string const &subsystem, std::size_t bytes);
+
+/** @brief Current and peak usage of all tracked subsystems. */
+std::map<std::string, Usage> const &usage();
+
+/** @brief Peak of the summed usage of all tracked subsystems. */
+std::size_t peak_total();
+
+} // namespace MemoryStats
+
+#endif
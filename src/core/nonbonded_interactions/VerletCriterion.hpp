@@ -23,14 +23,21 @@
 
 #include "Particle.hpp"
 #include "config/config.hpp"
+#include "exclusions.hpp"
 #include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+#include "thermostat.hpp"
 
 #include <utils/index.hpp>
 #include <utils/math/sqr.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
 struct GetNonbondedCutoff {
   auto operator()(int type_i, int type_j) const {
-    return get_ia_param(type_i, type_j).max_cut;
+    return get_ia_cutoff(type_i, type_j);
   }
 };
 
@@ -43,6 +50,18 @@ template <typename CutoffGetter = GetNonbondedCutoff> class VerletCriterion {
   const double m_eff_coulomb_cut2 = 0.;
   const double m_eff_dipolar_cut2 = 0.;
   const double m_collision_cut2 = 0.;
+#ifdef EXCLUSIONS
+  /** Whether exclusions may prune pairs from the list. Exclusions only
+   *  void the short-range potential; with the DPD thermostat, excluded
+   *  pairs still receive thermostat forces and have to stay in the list.
+   */
+  const bool m_filter_exclusions = (thermo_switch & THERMO_DPD) == 0;
+#endif
+  /** Effective squared cutoff (cutoff plus skin) per type pair, indexed
+   *  like @ref nonbonded_ia_cutoffs. Only built for the default cutoff
+   *  getter; non-interacting pairs keep the @ref INACTIVE_CUTOFF marker.
+   */
+  std::vector<double> m_eff_pair_cut2;
   double eff_cutoff_sqr(double x) const {
     if (x == INACTIVE_CUTOFF)
       return INACTIVE_CUTOFF;
@@ -57,7 +76,15 @@ public:
       : m_skin(skin), m_eff_max_cut2(eff_cutoff_sqr(max_cut)),
         m_eff_coulomb_cut2(eff_cutoff_sqr(coulomb_cut)),
         m_eff_dipolar_cut2(eff_cutoff_sqr(dipolar_cut)),
-        m_collision_cut2(eff_cutoff_sqr(collision_detection_cutoff)) {}
+        m_collision_cut2(eff_cutoff_sqr(collision_detection_cutoff)) {
+    if (std::is_same<CutoffGetter, GetNonbondedCutoff>::value) {
+      m_eff_pair_cut2.reserve(::nonbonded_ia_cutoffs.size());
+      std::transform(::nonbonded_ia_cutoffs.begin(),
+                     ::nonbonded_ia_cutoffs.end(),
+                     std::back_inserter(m_eff_pair_cut2),
+                     [this](double cut) { return eff_cutoff_sqr(cut); });
+    }
+  }
 
   template <typename Distance>
   bool operator()(const Particle &p1, const Particle &p2,
@@ -85,9 +112,24 @@ public:
 #endif
 
     // Within short-range distance (including dpd and the like)
-    auto const ia_cut = get_nonbonded_cutoff(p1.type(), p2.type());
-    return (ia_cut != INACTIVE_CUTOFF) &&
-           (dist2 <= Utils::sqr(ia_cut + m_skin));
+    if (not m_eff_pair_cut2.empty()) {
+      auto const cut2 = m_eff_pair_cut2[get_ia_param_key(p1.type(), p2.type())];
+      if ((cut2 == INACTIVE_CUTOFF) or (dist2 > cut2))
+        return false;
+    } else {
+      auto const ia_cut = get_nonbonded_cutoff(p1.type(), p2.type());
+      if ((ia_cut == INACTIVE_CUTOFF) or (dist2 > Utils::sqr(ia_cut + m_skin)))
+        return false;
+    }
+
+#ifdef EXCLUSIONS
+    // The short-range potential is the only remaining reason to keep the
+    // pair, so excluded pairs can be dropped from the list right away.
+    if (m_filter_exclusions and not do_nonbonded(p1, p2))
+      return false;
+#endif
+
+    return true;
   }
 };
 #endif
@@ -45,7 +45,11 @@
 
 #include <cmath>
 
-/** Calculate Gay-Berne force and torques */
+/** Calculate Gay-Berne force and torques.
+ *  The unit interparticle vector is obtained from the known @p dist
+ *  instead of a renormalization, and the four orientation-dependent
+ *  denominators are inverted once and reused.
+ */
 inline ParticleForce gb_pair_force(Utils::Quaternion<double> const &qi,
                                    Utils::Quaternion<double> const &qj,
                                    IA_parameters const &ia_params,
@@ -65,24 +69,28 @@ inline ParticleForce gb_pair_force(Utils::Quaternion<double> const &qi,
   auto const chi2 = ia_params.gay_berne.chi2;
   auto const mu = ia_params.gay_berne.mu;
   auto const nu = ia_params.gay_berne.nu;
-  auto const r = Utils::Vector3d(d).normalize();
+  auto const dist_inv = 1. / dist;
   auto const dui = d * ui;
   auto const duj = d * uj;
-  auto const rui = r * ui;
-  auto const ruj = r * uj;
+  auto const rui = dui * dist_inv;
+  auto const ruj = duj * dist_inv;
   auto const uij = ui * uj;
-  auto const oo1 = (dui + duj) / (1 + chi1 * uij);
-  auto const oo2 = (dui - duj) / (1 - chi1 * uij);
-  auto const tt1 = (dui + duj) / (1 + chi2 * uij);
-  auto const tt2 = (dui - duj) / (1 - chi2 * uij);
-  auto const o1 = sqr(rui + ruj) / (1 + chi1 * uij);
-  auto const o2 = sqr(rui - ruj) / (1 - chi1 * uij);
-  auto const t1 = sqr(rui + ruj) / (1 + chi2 * uij);
-  auto const t2 = sqr(rui - ruj) / (1 - chi2 * uij);
+  auto const chi1_inv_p = 1. / (1. + chi1 * uij);
+  auto const chi1_inv_m = 1. / (1. - chi1 * uij);
+  auto const chi2_inv_p = 1. / (1. + chi2 * uij);
+  auto const chi2_inv_m = 1. / (1. - chi2 * uij);
+  auto const oo1 = (dui + duj) * chi1_inv_p;
+  auto const oo2 = (dui - duj) * chi1_inv_m;
+  auto const tt1 = (dui + duj) * chi2_inv_p;
+  auto const tt2 = (dui - duj) * chi2_inv_m;
+  auto const o1 = sqr(rui + ruj) * chi1_inv_p;
+  auto const o2 = sqr(rui - ruj) * chi1_inv_m;
+  auto const t1 = sqr(rui + ruj) * chi2_inv_p;
+  auto const t2 = sqr(rui - ruj) * chi2_inv_m;
   auto const Brhi1 = chi1 * (o1 + o2);
   auto const Brhi2 = chi2 * (t1 + t2);
 
-  auto const e1 = 1. / (1. - sqr(chi1 * uij));
+  auto const e1 = chi1_inv_p * chi1_inv_m;
   auto const e2 = 1. - 0.5 * Brhi2;
   auto const e = 4 * e0 * pow(e1, 0.5 * nu) * pow(e2, mu);
 
@@ -106,11 +114,11 @@ inline ParticleForce gb_pair_force(Utils::Quaternion<double> const &qi,
 
   auto const dU_dr = e *
                      (Koef1 * Brhi2 * (Brack - BrackCut) -
-                      Koef2 * Brhi1 * (Bra12 - Bra12Cut) - Bra12 * dist / s0) /
-                     sqr(dist);
+                      Koef2 * Brhi1 * (Bra12 - Bra12Cut) - Bra12 * dist / s0) *
+                     sqr(dist_inv);
 
-  Koef1 *= chi2 / sqr(dist);
-  Koef2 *= chi1 / sqr(dist);
+  Koef1 *= chi2 * sqr(dist_inv);
+  Koef2 *= chi1 * sqr(dist_inv);
 
   auto const dU_da = e * (Koef1 * (tt1 + tt2) * (BrackCut - Brack) +
                           Koef2 * (oo1 + oo2) * (Bra12 - Bra12Cut));
@@ -150,16 +158,20 @@ inline double gb_pair_energy(Utils::Quaternion<double> const &qi,
   auto const chi2 = ia_params.gay_berne.chi2;
   auto const mu = ia_params.gay_berne.mu;
   auto const nu = ia_params.gay_berne.nu;
-  auto const r = Utils::Vector3d(d).normalize();
+  auto const dist_inv = 1. / dist;
 
   auto const uij = ui * uj;
-  auto const rui = r * ui;
-  auto const ruj = r * uj;
-
-  auto const o1 = sqr(rui + ruj) / (1 + chi1 * uij);
-  auto const o2 = sqr(rui - ruj) / (1 - chi1 * uij);
-  auto const t1 = sqr(rui + ruj) / (1 + chi2 * uij);
-  auto const t2 = sqr(rui - ruj) / (1 - chi2 * uij);
+  auto const rui = (d * ui) * dist_inv;
+  auto const ruj = (d * uj) * dist_inv;
+
+  auto const chi1_inv_p = 1. / (1. + chi1 * uij);
+  auto const chi1_inv_m = 1. / (1. - chi1 * uij);
+  auto const chi2_inv_p = 1. / (1. + chi2 * uij);
+  auto const chi2_inv_m = 1. / (1. - chi2 * uij);
+  auto const o1 = sqr(rui + ruj) * chi1_inv_p;
+  auto const o2 = sqr(rui - ruj) * chi1_inv_m;
+  auto const t1 = sqr(rui + ruj) * chi2_inv_p;
+  auto const t2 = sqr(rui - ruj) * chi2_inv_m;
 
   auto const e1 = std::pow(1. - sqr(chi1 * uij), -0.5 * nu);
   auto const e2 = std::pow(1. - 0.5 * chi2 * (t1 + t2), mu);
@@ -37,13 +37,20 @@
 #include <utils/math/int_pow.hpp>
 #include <utils/math/sqr.hpp>
 
-/** Calculate Lennard-Jones force factor */
+/** Calculate Lennard-Jones force factor.
+ *  The arithmetic runs in @ref nb_real precision; the cutoff checks
+ *  stay in double so the interaction range is identical in both modes.
+ */
 inline double lj_pair_force_factor(IA_parameters const &ia_params,
                                    double dist) {
   if (dist < ia_params.lj.max_cutoff() and dist > ia_params.lj.min_cutoff()) {
-    auto const r_off = dist - ia_params.lj.offset;
-    auto const frac6 = Utils::int_pow<6>(ia_params.lj.sig / r_off);
-    return 48.0 * ia_params.lj.eps * frac6 * (frac6 - 0.5) / (r_off * dist);
+    auto const r_off =
+        static_cast<nb_real>(dist) - static_cast<nb_real>(ia_params.lj.offset);
+    auto const frac6 =
+        Utils::int_pow<6>(static_cast<nb_real>(ia_params.lj.sig) / r_off);
+    return static_cast<nb_real>(48.) * static_cast<nb_real>(ia_params.lj.eps) *
+           frac6 * (frac6 - static_cast<nb_real>(0.5)) /
+           (r_off * static_cast<nb_real>(dist));
   }
   return 0.0;
 }
@@ -29,6 +29,7 @@
 #include <utils/index.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -38,6 +39,7 @@
  *****************************************/
 int max_seen_particle_type = 0;
 std::vector<std::shared_ptr<IA_parameters>> nonbonded_ia_params;
+std::vector<double> nonbonded_ia_cutoffs;
 
 /** Minimal global interaction cutoff. Particles with a distance
  *  smaller than this are guaranteed to be available on the same node
@@ -56,6 +58,7 @@ static void realloc_ia_params(int new_size) {
 
   auto const n_pairs = new_size * (new_size + 1) / 2;
   auto new_params = std::vector<std::shared_ptr<IA_parameters>>(n_pairs);
+  auto new_cutoffs = std::vector<double>(n_pairs, INACTIVE_CUTOFF);
 
   /* if there is an old field, move entries */
   for (int i = 0; i < old_size; i++) {
@@ -63,6 +66,7 @@ static void realloc_ia_params(int new_size) {
       auto const new_key = Utils::upper_triangular(i, j, new_size);
       auto const old_key = Utils::upper_triangular(i, j, old_size);
       new_params[new_key] = std::move(nonbonded_ia_params[old_key]);
+      new_cutoffs[new_key] = nonbonded_ia_cutoffs[old_key];
     }
   }
   for (auto &ia_params : new_params) {
@@ -73,6 +77,7 @@ static void realloc_ia_params(int new_size) {
 
   ::max_seen_particle_type = new_size;
   ::nonbonded_ia_params = std::move(new_params);
+  ::nonbonded_ia_cutoffs = std::move(new_cutoffs);
 }
 
 static double recalc_maximal_cutoff(const IA_parameters &data) {
@@ -154,14 +159,31 @@ static double recalc_maximal_cutoff(const IA_parameters &data) {
 double maximal_cutoff_nonbonded() {
   auto max_cut_nonbonded = INACTIVE_CUTOFF;
 
-  for (auto &data : nonbonded_ia_params) {
-    data->max_cut = recalc_maximal_cutoff(*data);
-    max_cut_nonbonded = std::max(max_cut_nonbonded, data->max_cut);
+  for (std::size_t key = 0; key < nonbonded_ia_params.size(); key++) {
+    auto &data = *nonbonded_ia_params[key];
+    data.max_cut = recalc_maximal_cutoff(data);
+    nonbonded_ia_cutoffs[key] = data.max_cut;
+    max_cut_nonbonded = std::max(max_cut_nonbonded, data.max_cut);
   }
 
   return max_cut_nonbonded;
 }
 
+std::vector<int> long_range_particle_types(double cutoff_regular) {
+  std::vector<int> types;
+  for (int i = 0; i < max_seen_particle_type; i++) {
+    for (int j = 0; j < max_seen_particle_type; j++) {
+      auto const &ia_params = get_ia_param(i, j);
+      if (ia_params.max_cut != INACTIVE_CUTOFF and
+          ia_params.max_cut > cutoff_regular) {
+        types.push_back(i);
+        break;
+      }
+    }
+  }
+  return types;
+}
+
 void make_particle_type_exist(int type) { realloc_ia_params(type + 1); }
 
 void set_min_global_cut(double min_global_cut) {
@@ -36,6 +36,20 @@
 #include <memory>
 #include <vector>
 
+/** Floating-point type for the arithmetic inside short-range pair kernels.
+ *  With @c NONBONDED_SINGLE_PRECISION the kernels evaluate in single
+ *  precision, which doubles the SIMD lane count; the resulting force
+ *  factors are still accumulated into the particle forces in double.
+ *  The rounding error is far below the thermostat noise in typical
+ *  soft-matter setups, but systems relying on exact energy conservation
+ *  should keep the default double precision.
+ */
+#ifdef NONBONDED_SINGLE_PRECISION
+using nb_real = float;
+#else
+using nb_real = double;
+#endif
+
 /** Cutoff for deactivated interactions. Must be negative, so that even
  *  particles on top of each other don't interact by chance.
  */
@@ -357,6 +371,15 @@ struct IA_parameters {
 
 extern std::vector<std::shared_ptr<IA_parameters>> nonbonded_ia_params;
 
+/** Flat table of the per-type-pair maximal cutoffs, indexed like
+ *  @ref nonbonded_ia_params. The pair list criterion only needs the
+ *  cutoff of a candidate pair, so keeping this one field in a dense
+ *  value-type array avoids dereferencing the @c shared_ptr and pulling
+ *  a whole @ref IA_parameters struct into cache per candidate.
+ *  Kept in sync by @ref maximal_cutoff_nonbonded().
+ */
+extern std::vector<double> nonbonded_ia_cutoffs;
+
 /** Maximal particle type seen so far. */
 extern int max_seen_particle_type;
 
@@ -365,6 +388,13 @@ extern int max_seen_particle_type;
  */
 double maximal_cutoff_nonbonded();
 
+/** Particle types with at least one pair interaction whose cutoff
+ *  exceeds @p cutoff_regular. These are the candidates for the N-square
+ *  decomposition when setting up a @ref HybridDecomposition, so the
+ *  regular cell grid can stay sized by the short cutoff.
+ */
+std::vector<int> long_range_particle_types(double cutoff_regular);
+
 inline int get_ia_param_key(int i, int j) {
   assert(i >= 0 && i < ::max_seen_particle_type);
   assert(j >= 0 && j < ::max_seen_particle_type);
@@ -387,6 +417,16 @@ inline IA_parameters &get_ia_param(int i, int j) {
   return *::nonbonded_ia_params[get_ia_param_key(i, j)];
 }
 
+/**
+ * @brief Get the maximal cutoff between particle types i and j.
+ *
+ * Equivalent to <tt>get_ia_param(i, j).max_cut</tt>, but reads from the
+ * flat @ref nonbonded_ia_cutoffs table without indirection.
+ */
+inline double get_ia_cutoff(int i, int j) {
+  return ::nonbonded_ia_cutoffs[get_ia_param_key(i, j)];
+}
+
 /** Make sure that ia_params is large enough to cover interactions
  *  for this particle type. The interactions are initialized with values
  *  such that no physical interaction occurs.
@@ -35,12 +35,18 @@
 #include <utils/math/int_pow.hpp>
 #include <utils/math/sqr.hpp>
 
-/** Calculate WCA force factor */
+/** Calculate WCA force factor.
+ *  The arithmetic runs in @ref nb_real precision; the cutoff check
+ *  stays in double so the interaction range is identical in both modes.
+ */
 inline double wca_pair_force_factor(IA_parameters const &ia_params,
                                     double dist) {
   if (dist < ia_params.wca.cut) {
-    auto const frac6 = Utils::int_pow<6>(ia_params.wca.sig / dist);
-    return 48.0 * ia_params.wca.eps * frac6 * (frac6 - 0.5) / (dist * dist);
+    auto const r = static_cast<nb_real>(dist);
+    auto const frac6 =
+        Utils::int_pow<6>(static_cast<nb_real>(ia_params.wca.sig) / r);
+    return static_cast<nb_real>(48.) * static_cast<nb_real>(ia_params.wca.eps) *
+           frac6 * (frac6 - static_cast<nb_real>(0.5)) / (r * r);
   }
   return 0.0;
 }
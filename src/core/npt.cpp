@@ -44,18 +44,20 @@ void synchronize_npt_state() {
   boost::mpi::broadcast(comm_cart, nptiso.p_inst, 0);
   boost::mpi::broadcast(comm_cart, nptiso.p_diff, 0);
   boost::mpi::broadcast(comm_cart, nptiso.volume, 0);
+  boost::mpi::broadcast(comm_cart, nptiso.p_diff_dir, 0);
+  boost::mpi::broadcast(comm_cart, nptiso.volume_dir, 0);
 }
 
 void NptIsoParameters::coulomb_dipole_sanity_checks() const {
 #ifdef ELECTROSTATICS
-  if (dimension < 3 && !cubic_box && electrostatics_actor) {
+  if ((dimension < 3 or directional) && !cubic_box && electrostatics_actor) {
     throw std::runtime_error("If electrostatics is being used you must "
                              "use the cubic box NpT.");
   }
 #endif
 
 #ifdef DIPOLES
-  if (dimension < 3 && !cubic_box && magnetostatics_actor) {
+  if ((dimension < 3 or directional) && !cubic_box && magnetostatics_actor) {
     throw std::runtime_error("If magnetostatics is being used you must "
                              "use the cubic box NpT.");
   }
@@ -64,8 +66,9 @@ void NptIsoParameters::coulomb_dipole_sanity_checks() const {
 
 NptIsoParameters::NptIsoParameters(double ext_pressure, double piston,
                                    Utils::Vector<bool, 3> const &rescale,
-                                   bool cubic_box)
-    : piston{piston}, p_ext{ext_pressure}, cubic_box{cubic_box} {
+                                   bool cubic_box, bool directional)
+    : piston{piston}, p_ext{ext_pressure}, cubic_box{cubic_box},
+      directional{directional} {
 
   if (ext_pressure < 0.0) {
     throw std::runtime_error("The external pressure must be positive");
@@ -73,6 +76,10 @@ NptIsoParameters::NptIsoParameters(double ext_pressure, double piston,
   if (piston <= 0.0) {
     throw std::runtime_error("The piston mass must be positive");
   }
+  if (directional and cubic_box) {
+    throw std::runtime_error(
+        "Directional box motion is incompatible with the cubic box NpT");
+  }
 
   inv_piston = ::nptiso.inv_piston;
   volume = ::nptiso.volume;
@@ -80,6 +87,8 @@ NptIsoParameters::NptIsoParameters(double ext_pressure, double piston,
   p_diff = ::nptiso.p_diff;
   p_vir = ::nptiso.p_vir;
   p_vel = ::nptiso.p_vel;
+  volume_dir = ::nptiso.volume_dir;
+  p_diff_dir = ::nptiso.p_diff_dir;
 
   /* set the NpT geometry */
   for (auto const i : {0, 1, 2}) {
@@ -110,6 +119,11 @@ void npt_ensemble_init(const BoxGeometry &box) {
     /* prepare NpT-integration */
     nptiso.inv_piston = 1. / nptiso.piston;
     nptiso.volume = pow(box.length()[nptiso.non_const_dim], nptiso.dimension);
+    for (auto const i : {0, 1, 2}) {
+      if (nptiso.geometry & ::nptgeom_dir[i]) {
+        nptiso.volume_dir[i] = box.length()[i];
+      }
+    }
     if (recalc_forces) {
       nptiso.p_inst = 0.0;
       nptiso.p_vir = Utils::Vector3d{};
@@ -139,11 +153,4 @@ void npt_add_virial_contribution(double energy) {
     nptiso.p_vir[0] += energy;
   }
 }
-
-void npt_add_virial_contribution(const Utils::Vector3d &force,
-                                 const Utils::Vector3d &d) {
-  if (integ_switch == INTEG_METHOD_NPT_ISO) {
-    nptiso.p_vir += hadamard_product(force, d);
-  }
-}
 #endif // NPT
@@ -36,7 +36,8 @@
 struct NptIsoParameters {
   NptIsoParameters() = default;
   NptIsoParameters(double ext_pressure, double piston,
-                   Utils::Vector<bool, 3> const &rescale, bool cubic_box);
+                   Utils::Vector<bool, 3> const &rescale, bool cubic_box,
+                   bool directional = false);
   /** mass of a virtual piston representing the shaken box */
   double piston = 0.;
   /** inverse of \ref piston */
@@ -51,6 +52,14 @@ struct NptIsoParameters {
   double p_inst = 0.;
   /** difference between \ref p_ext and \ref p_inst */
   double p_diff = 0.;
+  /** box lengths of the fluctuating directions for \ref directional box
+   *  motion. Each entry is the 1d analogue of \ref volume
+   */
+  Utils::Vector3d volume_dir = {0., 0., 0.};
+  /** piston momenta of the fluctuating directions for \ref directional
+   *  box motion. Each entry is the 1d analogue of \ref p_diff
+   */
+  Utils::Vector3d p_diff_dir = {0., 0., 0.};
   /** virial (short-range) components of \ref p_inst */
   Utils::Vector3d p_vir = {0., 0., 0.};
   /** ideal gas components of \ref p_inst, derived from the velocities */
@@ -71,6 +80,13 @@ struct NptIsoParameters {
    *  be decoupled from the particle motion
    */
   bool cubic_box = false;
+  /** Set this flag to give every fluctuating direction its own piston
+   *  degree of freedom. The box then relaxes anisotropically, i.e. each
+   *  enabled box length fluctuates independently under the same external
+   *  pressure, which corresponds to the diagonal (orthorhombic) limit of
+   *  a fully flexible cell. Incompatible with \ref cubic_box
+   */
+  bool directional = false;
   /** An index to one of the non-constant dimensions. Handy if you just want
    *  the variable box_l
    */
@@ -87,9 +103,22 @@ void synchronize_npt_state();
 void npt_ensemble_init(const BoxGeometry &box);
 void integrator_npt_sanity_checks();
 void npt_reset_instantaneous_virials();
+
+/** @brief Add an energy contribution to the virial part of the
+ *  instantaneous pressure. No-op unless the NpT integrator is active.
+ */
 void npt_add_virial_contribution(double energy);
-void npt_add_virial_contribution(const Utils::Vector3d &force,
-                                 const Utils::Vector3d &d);
+
+/** @brief Add the virial of a short-range force to the instantaneous
+ *  pressure. Unlike the energy overload, the active integrator is not
+ *  checked here: the short-range sweep is dispatched on the integrator
+ *  at compile time (see @ref force_calc), so this is only ever called
+ *  in NpT runs.
+ */
+inline void npt_add_virial_contribution(Utils::Vector3d const &force,
+                                        Utils::Vector3d const &d) {
+  nptiso.p_vir += hadamard_product(force, d);
+}
 
 #endif // NPT
 #endif
@@ -31,18 +31,19 @@
 #include <utils/constants.hpp>
 #include <utils/math/triangle_functions.hpp>
 
+#include <vector>
+
 int max_oif_objects = 0;
 
-Utils::Vector2d calc_oif_global(int molType, CellStructure &cs) {
+std::vector<double> calc_oif_global(int max_oif_objects, CellStructure &cs) {
   // first-fold-then-the-same approach
-  double partArea = 0.0;
-  // z volume
-  double VOL_partVol = 0.;
-
-  cs.bond_loop([&partArea, &VOL_partVol,
-                molType](Particle &p1, int bond_id,
-                         Utils::Span<Particle *> partners) {
-    if (p1.mol_id() != molType)
+  // areas and volumes of all objects, interleaved as {A_0, V_0, A_1, V_1, ...}
+  std::vector<double> area_volume(2u * max_oif_objects);
+
+  cs.bond_loop([&area_volume, max_oif_objects](
+                   Particle &p1, int bond_id, Utils::Span<Particle *> partners) {
+    auto const molType = p1.mol_id();
+    if (molType < 0 or molType >= max_oif_objects)
       return false;
 
     if (boost::get<OifGlobalForcesBond>(bonded_ia_params.at(bond_id).get()) !=
@@ -55,33 +56,35 @@ Utils::Vector2d calc_oif_global(int molType, CellStructure &cs) {
 
       // unfolded positions correct
       auto const VOL_A = Utils::area_triangle(p11, p22, p33);
-      partArea += VOL_A;
+      area_volume[2 * molType] += VOL_A;
 
       auto const VOL_norm = Utils::get_n_triangle(p11, p22, p33);
       auto const VOL_dn = VOL_norm.norm();
       auto const VOL_hz = 1.0 / 3.0 * (p11[2] + p22[2] + p33[2]);
-      VOL_partVol -= VOL_A * VOL_norm[2] / VOL_dn * VOL_hz;
+      area_volume[2 * molType + 1] -= VOL_A * VOL_norm[2] / VOL_dn * VOL_hz;
     }
 
     return false;
   });
 
-  return {{partArea, VOL_partVol}};
+  return area_volume;
 }
 
-void add_oif_global_forces(Utils::Vector2d const &area_volume, int molType,
+void add_oif_global_forces(std::vector<double> const &area_volume,
                            CellStructure &cs) {
   // first-fold-then-the-same approach
-  double area = area_volume[0];
-  double VOL_volume = area_volume[1];
+  auto const max_oif_objects = static_cast<int>(area_volume.size() / 2u);
 
-  cs.bond_loop([area, VOL_volume, molType](Particle &p1, int bond_id,
-                                           Utils::Span<Particle *> partners) {
-    if (p1.mol_id() != molType)
+  cs.bond_loop([&area_volume, max_oif_objects](
+                   Particle &p1, int bond_id, Utils::Span<Particle *> partners) {
+    auto const molType = p1.mol_id();
+    if (molType < 0 or molType >= max_oif_objects)
       return false;
 
     if (auto const *iaparams = boost::get<OifGlobalForcesBond>(
             bonded_ia_params.at(bond_id).get())) {
+      auto const area = area_volume[2 * molType];
+      auto const VOL_volume = area_volume[2 * molType + 1];
       auto const p11 =
           unfolded_position(p1.pos(), p1.image_box(), box_geo.length());
       auto const p22 = p11 + box_geo.get_mi_vector(partners[0]->pos(), p11);
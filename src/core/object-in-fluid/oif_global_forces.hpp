@@ -26,19 +26,23 @@
 #include "cell_system/CellStructure.hpp"
 #include "oif_global_forces_params.hpp"
 
-#include <utils/Vector.hpp>
+#include <vector>
 
-/** Calculate the OIF global force.
+/** Calculate the OIF global quantities.
  *  Called in force_calc() from within forces.cpp
- *  - calculates the global area and global volume for a cell before the forces
- *    are handled
- *  - MPI synchronization with all reduce
+ *  - accumulates the global area and global volume of every object in a
+ *    single sweep over the bonds, interleaved as {A_0, V_0, A_1, V_1, ...}
+ *  - the caller is responsible for the MPI reduction of the returned
+ *    partial sums (one element-wise all reduce for all objects)
  *  - !!! loop over particles from regular_decomposition !!!
  */
-Utils::Vector2d calc_oif_global(int molType, CellStructure &cs);
+std::vector<double> calc_oif_global(int max_oif_objects, CellStructure &cs);
 
-/** Distribute the OIF global forces to all particles in the mesh. */
-void add_oif_global_forces(Utils::Vector2d const &area_volume, int molType,
+/** Distribute the OIF global forces to all particles in all meshes.
+ *  @param area_volume  Globally reduced areas and volumes of all objects,
+ *                      interleaved as returned by @ref calc_oif_global.
+ */
+void add_oif_global_forces(std::vector<double> const &area_volume,
                            CellStructure &cs);
 
 extern int max_oif_objects;
@@ -25,6 +25,7 @@
 #include <utils/math/coordinate_transformation.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <vector>
 
@@ -32,9 +33,12 @@ namespace Observables {
 
 std::vector<double> CylindricalLBVelocityProfile::operator()() const {
   Utils::CylindricalHistogram<double, 3> histogram(n_bins(), limits());
-  for (auto const &p : sampling_positions) {
-    auto const velocity = lb_lbfluid_get_interpolated_velocity(p) *
-                          lb_lbfluid_get_lattice_speed();
+  auto const velocities =
+      lb_lbfluid_get_interpolated_velocities(sampling_positions);
+  auto const conversion_factor = lb_lbfluid_get_lattice_speed();
+  for (std::size_t j = 0; j < sampling_positions.size(); ++j) {
+    auto const &p = sampling_positions[j];
+    auto const velocity = velocities[j] * conversion_factor;
     auto const pos_shifted = p - transform_params->center();
     auto const pos_cyl = Utils::transform_coordinate_cartesian_to_cylinder(
         pos_shifted, transform_params->axis(), transform_params->orientation());
@@ -28,6 +28,21 @@
 
 namespace Observables {
 
+/** Base class for histogram observables in cylindrical coordinates.
+ *
+ *  Each concrete profile walks the selected particles on its own and
+ *  applies the Cartesian-to-cylinder transform per particle. When many
+ *  profiles share the same particle set, the expensive part of the
+ *  repetition, the remote fetch, is already absorbed by the fetch cache
+ *  in particle_node.cpp as long as the set fits into it; only the local
+ *  walk and the transform are repeated. Fusing several profiles into a
+ *  single pass would need a composite observable returning the
+ *  concatenated histograms, which breaks the one-quantity contract that
+ *  accumulators and the script interface rely on (@ref
+ *  Observable::shape is a single tensor). If per-sample transform cost
+ *  ever matters, that composite type is the place to build, not the
+ *  individual profiles.
+ */
 class CylindricalPidProfileObservable : public PidObservable,
                                         public CylindricalProfileObservable {
 public:
@@ -31,10 +31,11 @@ namespace Observables {
 
 std::vector<double> LBVelocityProfile::operator()() const {
   Utils::Histogram<double, 3> histogram(n_bins(), limits());
-  for (auto const &p : sampling_positions) {
-    const auto v = lb_lbfluid_get_interpolated_velocity(p) *
-                   lb_lbfluid_get_lattice_speed();
-    histogram.update(p, v);
+  auto const velocities =
+      lb_lbfluid_get_interpolated_velocities(sampling_positions);
+  auto const conversion_factor = lb_lbfluid_get_lattice_speed();
+  for (std::size_t j = 0; j < sampling_positions.size(); ++j) {
+    histogram.update(sampling_positions[j], velocities[j] * conversion_factor);
   }
   auto hist_tmp = histogram.get_histogram();
   auto const tot_count = histogram.get_tot_count();
@@ -48,6 +48,21 @@ using ParticleReferenceRange =
  *
  *  Base class for observables extracting raw data from particle subsets and
  *  returning either the data or a statistic derived from it.
+ *
+ *  Evaluation gathers all selected particles to the calling node
+ *  (@ref fetch_particles), which dominates the cost for large particle
+ *  sets. Moving evaluation rank-local is not a change to this class
+ *  alone: @ref evaluate hands derived observables an id-ordered range,
+ *  and the derived kernels fall into three groups with different
+ *  parallelization needs. Per-particle maps (positions, velocities)
+ *  could fill their id-slots locally and be summed element-wise across
+ *  ranks; averaging algorithms (e.g. weighted averages) need their own
+ *  cross-rank reduction of numerator and denominator; and kernels over
+ *  consecutive ids (bond angles, dihedrals, particle distances) read
+ *  particles that can live on different ranks and would need ghost-like
+ *  access to their neighbors. Distributing evaluation therefore means
+ *  teaching each algorithm in the particle_observables library its
+ *  reduction, not short-cutting the gather here.
  */
 class PidObservable : virtual public Observable {
   /** Identifiers of particles measured by this observable */
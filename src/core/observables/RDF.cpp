@@ -30,12 +30,27 @@
 
 #include <boost/range/algorithm/transform.hpp>
 
+#include <algorithm>
 #include <cmath>
-#include <functional>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
 namespace Observables {
+
+/** Count the particles that appear in both sets. */
+static long int count_common(Utils::Span<const Particle *const> particles1,
+                             Utils::Span<const Particle *const> particles2) {
+  std::vector<int> ids2(particles2.size());
+  boost::transform(particles2, ids2.begin(),
+                   [](auto const p) { return p->id(); });
+  std::sort(ids2.begin(), ids2.end());
+  return std::count_if(
+      particles1.begin(), particles1.end(), [&ids2](auto const p) {
+        return std::binary_search(ids2.begin(), ids2.end(), p->id());
+      });
+}
+
 std::vector<double> RDF::operator()() const {
   std::vector<Particle> particles1 = fetch_particles(ids1());
   std::vector<const Particle *> particles_ptrs1(particles1.size());
@@ -70,10 +85,101 @@ RDF::evaluate(Utils::Span<const Particle *const> particles1,
     }
     cnt++;
   };
-  if (particles2.empty()) {
+
+  /* Bin particles into a uniform grid with cells at least @c max_r wide,
+   * so that all pairs closer than @c max_r lie in adjacent cells and the
+   * pair search becomes linear in the number of particles instead of
+   * quadratic. Only pairs beyond @c max_r are skipped, so the histogram
+   * is identical to the all-pairs sweep; the skipped pairs only enter
+   * the normalization, which is restored analytically. Requires a fully
+   * periodic box with at least 3 cells per direction, otherwise
+   * wrapped cell neighborhoods are ambiguous and we fall back to the
+   * all-pairs loops. */
+  auto use_cells = box_geo.periodic(0) and box_geo.periodic(1) and
+                   box_geo.periodic(2) and max_r > 0.;
+  Utils::Vector3i n_cells{};
+  if (use_cells) {
+    for (int i = 0; i < 3; ++i) {
+      n_cells[i] = static_cast<int>(std::floor(box_geo.length()[i] / max_r));
+      use_cells &= n_cells[i] >= 3;
+    }
+  }
+  if (use_cells) {
+    auto const cell_of = [&](const Particle *const p) {
+      auto const pos = folded_position(p->pos(), box_geo);
+      Utils::Vector3i cell;
+      for (int i = 0; i < 3; ++i) {
+        cell[i] = std::clamp(
+            static_cast<int>(
+                std::floor(pos[i] * box_geo.length_inv()[i] *
+                           static_cast<double>(n_cells[i]))),
+            0, n_cells[i] - 1);
+      }
+      return cell;
+    };
+    auto const linear = [&](Utils::Vector3i cell) {
+      for (int i = 0; i < 3; ++i) {
+        cell[i] = (cell[i] + n_cells[i]) % n_cells[i];
+      }
+      return static_cast<std::size_t>(
+          (cell[0] * n_cells[1] + cell[1]) * n_cells[2] + cell[2]);
+    };
+    std::vector<std::vector<const Particle *>> cells(
+        static_cast<std::size_t>(Utils::product(n_cells)));
+    if (particles2.empty()) {
+      for (auto const p : particles1) {
+        cells[linear(cell_of(p))].push_back(p);
+      }
+      Utils::Vector3i cell;
+      for (cell[0] = 0; cell[0] < n_cells[0]; ++cell[0])
+        for (cell[1] = 0; cell[1] < n_cells[1]; ++cell[1])
+          for (cell[2] = 0; cell[2] < n_cells[2]; ++cell[2]) {
+            auto const &here = cells[linear(cell)];
+            Utils::for_each_pair(here, op);
+            /* visit each pair of adjacent cells exactly once via the
+             * half-space of neighbor offsets */
+            Utils::Vector3i off;
+            for (off[0] = -1; off[0] <= 1; ++off[0])
+              for (off[1] = -1; off[1] <= 1; ++off[1])
+                for (off[2] = -1; off[2] <= 1; ++off[2]) {
+                  if (off[0] > 0 or (off[0] == 0 and off[1] > 0) or
+                      (off[0] == 0 and off[1] == 0 and off[2] > 0)) {
+                    for (auto const p1 : here)
+                      for (auto const p2 : cells[linear(cell + off)])
+                        op(p1, p2);
+                  }
+                }
+          }
+      auto const n = static_cast<long int>(particles1.size());
+      cnt = n * (n - 1) / 2;
+    } else {
+      for (auto const p : particles2) {
+        cells[linear(cell_of(p))].push_back(p);
+      }
+      for (auto const p1 : particles1) {
+        auto const cell = cell_of(p1);
+        Utils::Vector3i off;
+        for (off[0] = -1; off[0] <= 1; ++off[0])
+          for (off[1] = -1; off[1] <= 1; ++off[1])
+            for (off[2] = -1; off[2] <= 1; ++off[2])
+              for (auto const p2 : cells[linear(cell + off)])
+                if (p1->id() != p2->id())
+                  op(p1, p2);
+      }
+      /* self-pairs of particles present in both sets are skipped, so
+       * they must not enter the normalization either */
+      cnt = static_cast<long int>(particles1.size()) *
+                static_cast<long int>(particles2.size()) -
+            count_common(particles1, particles2);
+    }
+  } else if (particles2.empty()) {
     Utils::for_each_pair(particles1, op);
   } else {
-    auto cmp = std::not_equal_to<const Particle *const>();
+    /* skip self-pairs of particles present in both sets; they do not
+     * invoke the kernel, so they are absent from the count as well */
+    auto cmp = [](const Particle *const p1, const Particle *const p2) {
+      return p1->id() != p2->id();
+    };
     Utils::for_each_cartesian_pair_if(particles1, particles2, op, cmp);
   }
   if (cnt == 0)
@@ -32,14 +32,20 @@
 #include "grid.hpp"
 #include "integrate.hpp"
 
+#include <utils/Vector.hpp>
+#include <utils/math/int_pow.hpp>
+
 #include <boost/range/algorithm/min_element.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 /** @name Error codes for tuning. */
 /**@{*/
@@ -54,6 +60,92 @@ static auto constexpr P3M_TUNE_ACCURACY_TOO_LARGE = 3.;
 /** @brief Precision threshold for a non-zero real-space cutoff. */
 static auto constexpr P3M_RCUT_PREC = 1e-3;
 
+/** @brief Candidate list of the most recent tuning run. */
+static std::vector<TuningAlgorithm::Parameters> tuning_candidates;
+
+std::vector<TuningAlgorithm::Parameters> const &last_tuning_candidates() {
+  return ::tuning_candidates;
+}
+
+void set_last_tuning_candidates(
+    std::vector<TuningAlgorithm::Parameters> candidates) {
+  ::tuning_candidates = std::move(candidates);
+}
+
+void TuningAlgorithm::publish_candidates() {
+  set_last_tuning_candidates(std::move(m_candidates));
+}
+
+/** @brief Number of timings needed to calibrate the tuning cost model. */
+static auto constexpr P3M_COST_MODEL_MIN_SAMPLES = std::size_t{6u};
+
+/**
+ * @brief Cost model features of a parameter set.
+ *
+ * The near-field work scales with the cutoff volume, the charge
+ * assignment with the number of interpolation points and the FFT
+ * with the mesh size (see @ref TuningAlgorithm::estimate_mc_time).
+ */
+static std::array<double, 3> cost_model_features(Utils::Vector3i const &mesh,
+                                                 int cao, double r_cut_iL) {
+  auto const mesh_size = static_cast<double>(Utils::product(mesh));
+  return {Utils::int_pow<3>(r_cut_iL),
+          Utils::int_pow<3>(static_cast<double>(cao)),
+          mesh_size * std::log(mesh_size)};
+}
+
+double TuningAlgorithm::estimate_mc_time(Utils::Vector3i const &mesh, int cao,
+                                         double r_cut_iL) const {
+  if (m_cost_samples.size() < P3M_COST_MODEL_MIN_SAMPLES) {
+    return -1.;
+  }
+
+  /* fit the four coefficients by solving the normal equations */
+  double a[4][5] = {};
+  for (auto const &sample : m_cost_samples) {
+    auto const row = std::array<double, 4>{1., sample[0], sample[1], sample[2]};
+    for (std::size_t i = 0u; i < 4u; ++i) {
+      for (std::size_t j = 0u; j < 4u; ++j) {
+        a[i][j] += row[i] * row[j];
+      }
+      a[i][4] += row[i] * sample[3];
+    }
+  }
+
+  /* Gaussian elimination with partial pivoting */
+  for (std::size_t i = 0u; i < 4u; ++i) {
+    auto pivot = i;
+    for (std::size_t k = i + 1u; k < 4u; ++k) {
+      if (std::fabs(a[k][i]) > std::fabs(a[pivot][i])) {
+        pivot = k;
+      }
+    }
+    if (std::fabs(a[pivot][i]) < 1e-12) {
+      return -1.;
+    }
+    std::swap_ranges(a[i], a[i] + 5, a[pivot]);
+    for (std::size_t k = i + 1u; k < 4u; ++k) {
+      auto const factor = a[k][i] / a[i][i];
+      for (std::size_t j = i; j < 5u; ++j) {
+        a[k][j] -= factor * a[i][j];
+      }
+    }
+  }
+  double coeffs[4];
+  for (int i = 3; i >= 0; --i) {
+    auto rhs = a[i][4];
+    for (int j = i + 1; j < 4; ++j) {
+      rhs -= a[i][j] * coeffs[j];
+    }
+    coeffs[i] = rhs / a[i][i];
+  }
+
+  auto const features = cost_model_features(mesh, cao, r_cut_iL);
+  auto const estimate = coeffs[0] + coeffs[1] * features[0] +
+                        coeffs[2] * features[1] + coeffs[3] * features[2];
+  return (estimate > 0.) ? estimate : -1.;
+}
+
 void TuningAlgorithm::determine_r_cut_limits() {
   auto const r_cut_iL = get_params().r_cut_iL;
   if (r_cut_iL == 0.) {
@@ -173,13 +265,34 @@ double TuningAlgorithm::get_mc_time(Utils::Vector3i const &mesh, int cao,
     return -P3M_TUNE_ELC_GAP_SIZE;
   }
 
+  /* once the cost model is calibrated, skip the benchmark of candidates
+   * predicted to be clearly slower than the current optimum; reporting
+   * the estimate lets the caller-side search heuristics terminate as
+   * they would with a measurement */
+  if (m_time_best < time_sentinel) {
+    auto const estimate = estimate_mc_time(mesh, cao, r_cut_iL);
+    if (estimate > 2. * m_time_best + time_granularity) {
+      m_logger->log_skip("cost model veto", mesh[0], cao, r_cut_iL,
+                         tuned_alpha_L, tuned_accuracy, rs_err, ks_err);
+      increment_n_trials();
+      return estimate;
+    }
+  }
+
   commit(mesh, cao, r_cut_iL, tuned_alpha_L);
   on_solver_change();
   auto const int_time = benchmark_integration_step(m_timings);
 
+  auto const features = cost_model_features(mesh, cao, r_cut_iL);
+  m_cost_samples.push_back({features[0], features[1], features[2], int_time});
+  m_time_best = std::min(m_time_best, int_time);
+
   std::tie(tuned_accuracy, rs_err, ks_err, tuned_alpha_L) =
       calculate_accuracy(mesh, cao, r_cut_iL);
 
+  m_candidates.push_back(
+      {mesh, cao, tuned_alpha_L, r_cut_iL, tuned_accuracy, int_time});
+
   m_logger->log_success(int_time, mesh[0], cao, r_cut_iL, tuned_alpha_L,
                         tuned_accuracy, rs_err, ks_err);
   increment_n_trials();
@@ -33,11 +33,14 @@
 
 #include <boost/optional.hpp>
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 /**
  * @brief Tuning algorithm for P3M.
@@ -149,6 +152,10 @@ public:
 
     auto const tuned_params = get_time();
 
+    /* publish the benchmarked candidates, even if tuning failed:
+     * the explored (accuracy, time) surface is still informative */
+    publish_candidates();
+
     // deactivate tuning mode
     get_params().tuning = false;
 
@@ -170,6 +177,37 @@ protected:
   auto get_n_trials() { return m_n_trials; }
   void increment_n_trials() { ++m_n_trials; }
   void reset_n_trials() { m_n_trials = 0ul; }
+
+  /**
+   * @brief Estimate the integration time of a candidate from a cost model.
+   *
+   * The model decomposes the runtime into near-field, charge assignment
+   * and FFT contributions plus a constant overhead, with coefficients
+   * fitted to the timings already measured during this tuning run
+   * (@ref m_cost_samples). Number of particles and box geometry are
+   * constant during tuning and therefore absorbed in the coefficients.
+   *
+   * @returns Estimated time in milliseconds, or -1 if fewer samples than
+   *          needed for a fit have been collected or the fit is singular.
+   */
+  double estimate_mc_time(Utils::Vector3i const &mesh, int cao,
+                          double r_cut_iL) const;
+
+private:
+  /** @brief Cost model features and measured time of timed candidates. */
+  std::vector<std::array<double, 4>> m_cost_samples;
+  /** @brief Best integration time measured so far (milliseconds). */
+  double m_time_best = std::numeric_limits<double>::max();
+
+protected:
+  /** @brief Parameter sets whose integration time was measured during
+   *  this tuning run, published via @ref last_tuning_candidates. */
+  std::vector<Parameters> m_candidates;
+
+  /** @brief Hand @ref m_candidates over to @ref last_tuning_candidates. */
+  void publish_candidates();
+
+protected:
   double get_m_time(Utils::Vector3i const &mesh, int &tuned_cao,
                     double &tuned_r_cut_iL, double &tuned_alpha_L,
                     double &tuned_accuracy);
@@ -178,6 +216,20 @@ protected:
                      double &tuned_accuracy);
 };
 
+/** @brief Parameter sets benchmarked during the most recent tuning run.
+ *
+ *  Every candidate whose integration time was actually measured is
+ *  retained, with its reached accuracy and time. The (accuracy, time)
+ *  Pareto frontier of this set allows picking cheaper parameter sets
+ *  for lower accuracy requirements without re-tuning. The list is
+ *  overwritten by the next tuning run of any P3M-family solver.
+ */
+std::vector<TuningAlgorithm::Parameters> const &last_tuning_candidates();
+
+/** @brief Publish the candidate list of a finished tuning run. */
+void set_last_tuning_candidates(
+    std::vector<TuningAlgorithm::Parameters> candidates);
+
 #endif // P3M or DP3M
 
 #endif
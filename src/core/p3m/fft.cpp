@@ -31,6 +31,8 @@
 
 #include "p3m/fft.hpp"
 
+#include "memory_stats.hpp"
+
 #include <utils/Span.hpp>
 #include <utils/Vector.hpp>
 #include <utils/index.hpp>
@@ -639,6 +641,10 @@ int fft_init(Utils::Vector3i const &ca_mesh_dim, int const *ca_mesh_margin,
   fft.send_buf.resize(fft.max_comm_size);
   fft.recv_buf.resize(fft.max_comm_size);
   fft.data_buf.resize(fft.max_mesh_size);
+  MemoryStats::track("p3m.fft_buffers",
+                     (fft.send_buf.capacity() + fft.recv_buf.capacity() +
+                      fft.data_buf.capacity()) *
+                         sizeof(double));
   auto *c_data = (fftw_complex *)(fft.data_buf.data());
 
   /* === FFT Routines (Using FFTW / RFFTW package)=== */
@@ -31,6 +31,14 @@
  *  1D-FFT. After performing the FFT on that direction the data is
  *  redistributed.
  *
+ *  The mesh is not distributed in slabs: before the first transform it
+ *  is remapped from the 3D domain-decomposition node grid onto a 2D
+ *  node grid (see @c calc_2d_grid() in \ref fft.cpp), i.e. each rank
+ *  holds a pencil of complete rows along the transform direction, and
+ *  the pencil axes rotate between the three 1D transforms. The rank
+ *  count is therefore limited by the product of the two distributed
+ *  mesh dimensions, not by a single one.
+ *
  *  For simplicity at the moment I have implemented a full complex to
  *  complex FFT (even though a real to complex FFT would be
  *  sufficient)
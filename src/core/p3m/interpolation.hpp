@@ -117,6 +117,30 @@ public:
     return ret;
   }
 
+  /**
+   * @brief Linear mesh index of a cached entry.
+   * @param i Index of the entry.
+   */
+  auto index(std::size_t i) const {
+    assert(i < size());
+    return ca_fmp[i];
+  }
+
+  /**
+   * @brief Weights of a cached entry, as stored.
+   *
+   * The weights for the three directions are contiguous, @ref cao
+   * values each. This grants direct access to the cache storage, for
+   * interpolation without copying the entry into an
+   * @ref InterpolationWeights first.
+   *
+   * @param i Index of the entry.
+   */
+  auto weights(std::size_t i) const {
+    assert(i < size());
+    return Utils::make_const_span(ca_frac.data() + 3 * i * m_cao, 3 * m_cao);
+  }
+
   /**
    * @brief Reset the cache.
    *
@@ -141,7 +165,7 @@ p3m_calculate_interpolation_weights(const Utils::Vector3d &position,
                                     const Utils::Vector3d &ai,
                                     P3MLocalMesh const &local_mesh) {
   /** position shift for calc. of first assignment mesh point. */
-  static auto const pos_shift = std::floor((cao - 1) / 2.0) - (cao % 2) / 2.0;
+  constexpr auto pos_shift = ((cao - 1) / 2) - (cao % 2) / 2.0;
 
   /* distance to nearest mesh point */
   Utils::Vector3d dist;
@@ -207,4 +231,43 @@ void p3m_interpolate(P3MLocalMesh const &local_mesh,
   }
 }
 
+/**
+ * @brief P3M grid interpolation from cached weights.
+ *
+ * Overload of @ref p3m_interpolate that reads the weights of a cached
+ * point directly from the cache storage, instead of copying the entry
+ * into an @ref InterpolationWeights first.
+ *
+ * @param local_mesh Mesh info.
+ * @param weights Cache holding the weights.
+ * @param i Index of the cached point.
+ * @param kernel The kernel to run.
+ */
+template <int cao, class Kernel>
+void p3m_interpolate(P3MLocalMesh const &local_mesh,
+                     p3m_interpolation_cache const &weights, std::size_t i,
+                     Kernel kernel) {
+  assert(cao == weights.cao());
+
+  auto const w = weights.weights(i);
+  auto const *w_x = w.data();
+  auto const *w_y = w_x + cao;
+  auto const *w_z = w_y + cao;
+
+  auto q_ind = weights.index(i);
+  for (int i0 = 0; i0 < cao; i0++) {
+    auto const tmp0 = w_x[i0];
+    for (int i1 = 0; i1 < cao; i1++) {
+      auto const tmp1 = tmp0 * w_y[i1];
+      for (int i2 = 0; i2 < cao; i2++) {
+        kernel(q_ind, tmp1 * w_z[i2]);
+
+        q_ind++;
+      }
+      q_ind += local_mesh.q_2_off;
+    }
+    q_ind += local_mesh.q_21_off;
+  }
+}
+
 #endif
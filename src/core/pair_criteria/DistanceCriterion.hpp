@@ -35,6 +35,7 @@ public:
   }
   double get_cut_off() { return m_cut_off; }
   void set_cut_off(double c) { m_cut_off = c; }
+  double max_range() const override { return m_cut_off; }
 
 private:
   double m_cut_off;
@@ -41,6 +41,13 @@ public:
     const bool res = decide(p1, p2);
     return res;
   }
+  /**
+   * @brief Maximal distance at which the criterion can be fulfilled,
+   * or a negative value if the criterion is not distance-bounded.
+   * Distance-bounded criteria allow pair searches to be accelerated
+   * with spatial binning instead of an all-pairs sweep.
+   */
+  virtual double max_range() const { return -1.; }
   virtual ~PairCriterion() = default;
 };
 } // namespace PairCriteria
@@ -44,13 +44,14 @@
 #include <boost/range/numeric.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -59,8 +60,49 @@ constexpr auto some_tag = 42;
 /** @brief Enable particle type tracking in @ref particle_type_map. */
 static bool type_list_enable;
 
+/** @brief Index of the particle ids of one particle type.
+ *
+ *  The ids are kept in a contiguous array for O(1) access by index,
+ *  with a position map for O(1) insertion and removal (removal swaps
+ *  the last id into the hole). Drawing a random particle of a type
+ *  therefore doesn't have to walk the container, which dominated the
+ *  move selection cost of the reaction methods for large type lists.
+ */
+class TypeList {
+  std::vector<int> m_ids;
+  std::unordered_map<int, std::size_t> m_pos;
+
+public:
+  void insert(int p_id) {
+    if (m_pos.count(p_id) == 0) {
+      m_pos[p_id] = m_ids.size();
+      m_ids.push_back(p_id);
+    }
+  }
+  /** @brief Remove a particle id. @return true if the id was tracked. */
+  bool erase(int p_id) {
+    auto it = m_pos.find(p_id);
+    if (it == m_pos.end()) {
+      return false;
+    }
+    auto const hole = it->second;
+    auto const last = m_ids.back();
+    m_ids[hole] = last;
+    m_pos[last] = hole;
+    m_ids.pop_back();
+    m_pos.erase(p_id);
+    return true;
+  }
+  void clear() {
+    m_ids.clear();
+    m_pos.clear();
+  }
+  auto size() const { return m_ids.size(); }
+  int operator[](std::size_t index) const { return m_ids[index]; }
+};
+
 /** @brief Mapping particle types to lists of particle ids. */
-static std::unordered_map<int, std::unordered_set<int>> particle_type_map;
+static std::unordered_map<int, TypeList> particle_type_map;
 
 /** @brief Mapping particle ids to MPI ranks. */
 static std::unordered_map<int, int> particle_node;
@@ -126,9 +168,7 @@ void on_particle_type_change(int p_id, int old_type, int new_type) {
   if (::type_list_enable) {
     if (old_type == type_tracking::any_type) {
       for (auto &kv : ::particle_type_map) {
-        auto it = kv.second.find(p_id);
-        if (it != kv.second.end()) {
-          kv.second.erase(it);
+        if (kv.second.erase(p_id)) {
 #ifndef NDEBUG
           if (auto p = ::cell_structure.get_local_particle(p_id)) {
             assert(p->type() == kv.first);
@@ -533,6 +573,86 @@ void make_new_particle(int p_id, Utils::Vector3d const &pos) {
   mpi_synchronize_max_seen_pid_local();
 }
 
+void make_new_particles(std::vector<int> const &p_ids,
+                        std::vector<Utils::Vector3d> const &positions) {
+  assert(p_ids.size() == positions.size());
+  if (rebuild_needed()) {
+    build_particle_node_parallel();
+  }
+  std::vector<int> nodes_local(p_ids.size());
+  for (std::size_t i = 0ul; i < p_ids.size(); ++i) {
+    auto const has_created = maybe_insert_particle(p_ids[i], positions[i]);
+    nodes_local[i] = (has_created) ? ::comm_cart.rank() : 0;
+  }
+  on_particle_change();
+
+  std::vector<int> nodes(p_ids.size());
+  boost::mpi::reduce(::comm_cart, nodes_local, nodes, std::plus<int>{}, 0);
+  if (::this_node == 0) {
+    for (std::size_t i = 0ul; i < p_ids.size(); ++i) {
+      particle_node[p_ids[i]] = nodes[i];
+      max_seen_pid = std::max(max_seen_pid, p_ids[i]);
+    }
+  }
+  mpi_synchronize_max_seen_pid_local();
+}
+
+/**
+ * @brief Assign a property value to many particles in one sweep.
+ *
+ * Each rank walks the batch and applies the values of the particles it
+ * owns; existence of the whole batch is verified with a single
+ * reduction instead of one collective per particle.
+ */
+template <class T>
+static void set_particles_property(std::vector<int> const &p_ids,
+                                   std::vector<T> const &values,
+                                   T &(Particle::*setter)()) {
+  assert(p_ids.size() == values.size());
+  auto n_found_local = 0;
+  for (std::size_t i = 0ul; i < p_ids.size(); ++i) {
+    auto p = ::cell_structure.get_local_particle(p_ids[i]);
+    if (p != nullptr and not p->is_ghost()) {
+      (p->*setter)() = values[i];
+      ++n_found_local;
+    }
+  }
+  on_particle_force_change();
+
+  auto n_found = 0;
+  boost::mpi::reduce(::comm_cart, n_found_local, n_found, std::plus<int>{}, 0);
+  if (::this_node == 0 and n_found != static_cast<int>(p_ids.size())) {
+    throw std::runtime_error("Some particle ids were not found");
+  }
+}
+
+static void set_particles_v_local(std::vector<int> const &p_ids,
+                                  std::vector<Utils::Vector3d> const &vs) {
+  set_particles_property(p_ids, vs, &Particle::v);
+}
+
+REGISTER_CALLBACK(set_particles_v_local)
+
+void set_particles_v(std::vector<int> const &p_ids,
+                     std::vector<Utils::Vector3d> const &vs) {
+  mpi_call_all(set_particles_v_local, p_ids, vs);
+}
+
+#ifdef EXTERNAL_FORCES
+static void
+set_particles_ext_force_local(std::vector<int> const &p_ids,
+                              std::vector<Utils::Vector3d> const &forces) {
+  set_particles_property(p_ids, forces, &Particle::ext_force);
+}
+
+REGISTER_CALLBACK(set_particles_ext_force_local)
+
+void set_particles_ext_force(std::vector<int> const &p_ids,
+                             std::vector<Utils::Vector3d> const &forces) {
+  mpi_call_all(set_particles_ext_force_local, p_ids, forces);
+}
+#endif // EXTERNAL_FORCES
+
 void set_particle_pos(int p_id, Utils::Vector3d const &pos) {
   auto const has_moved = maybe_move_particle(p_id, pos);
   ::cell_structure.set_resort_particles(Cells::RESORT_GLOBAL);
@@ -554,11 +674,11 @@ int get_random_p_id(int type, int random_index_in_type_map) {
                              " is currently not tracked by the system.");
   }
 
-  if (random_index_in_type_map + 1 > it->second.size())
+  if (static_cast<std::size_t>(random_index_in_type_map) >= it->second.size())
     throw std::runtime_error("The provided index exceeds the number of "
                              "particle types listed in the particle_type_map");
   // there is no guarantee of order across MPI ranks
-  auto p_id = *std::next(it->second.begin(), random_index_in_type_map);
+  auto p_id = it->second[static_cast<std::size_t>(random_index_in_type_map)];
   boost::mpi::broadcast(::comm_cart, p_id, 0);
   return p_id;
 }
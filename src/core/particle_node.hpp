@@ -82,6 +82,21 @@ void clear_particle_node();
  * @param pos   The particle position.
  */
 void make_new_particle(int p_id, Utils::Vector3d const &pos);
+
+/**
+ * @brief Create several new particles and attach them to cells.
+ *
+ * Unlike calling @ref make_new_particle in a loop, the particle change
+ * event and the id bookkeeping collectives run once for the whole
+ * batch instead of once per particle, which is what dominates the cost
+ * of loading large start configurations. Must be called on all ranks
+ * with identical arguments.
+ *
+ * @param p_ids      The identities of the particles to create.
+ * @param positions  The particle positions.
+ */
+void make_new_particles(std::vector<int> const &p_ids,
+                        std::vector<Utils::Vector3d> const &positions);
 void particle_checks(int p_id, Utils::Vector3d const &pos);
 
 /**
@@ -92,6 +107,31 @@ void particle_checks(int p_id, Utils::Vector3d const &pos);
  */
 void set_particle_pos(int p_id, Utils::Vector3d const &pos);
 
+/**
+ * @brief Set the velocity of many particles in one sweep.
+ *
+ * Unlike setting the property per particle, the particle change event
+ * and the existence check collective run once for the whole batch.
+ * This function is only called on the head node.
+ *
+ * @param p_ids  The identities of the particles to update.
+ * @param vs     The new particle velocities.
+ */
+void set_particles_v(std::vector<int> const &p_ids,
+                     std::vector<Utils::Vector3d> const &vs);
+
+#ifdef EXTERNAL_FORCES
+/**
+ * @brief Set the external force on many particles in one sweep.
+ * See @ref set_particles_v for the batching semantics.
+ *
+ * @param p_ids   The identities of the particles to update.
+ * @param forces  The new external forces.
+ */
+void set_particles_ext_force(std::vector<int> const &p_ids,
+                             std::vector<Utils::Vector3d> const &forces);
+#endif // EXTERNAL_FORCES
+
 /** Remove particle with a given identity. Also removes all bonds to the
  *  particle.
  *  @param p_id     identity of the particle to remove
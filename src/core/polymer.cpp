@@ -42,10 +42,13 @@
 
 #include <boost/optional.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <memory>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 template <class RNG> static Utils::Vector3d random_position(RNG &rng) {
@@ -66,39 +69,108 @@ template <class RNG> static Utils::Vector3d random_unit_vector(RNG &rng) {
   return v;
 }
 
-/** Calculate minimal distance to point.
- *  Note: Particle handles may be invalidated!
- *  @param partCfg particle selection
- *  @param pos  point from which to check for close neighbors
- *  @return the minimal distance of a particle to coordinates @p pos
+/** Hash grid for distance queries against already placed positions.
+ *  The cell size is at least the query distance, so only the 27 cells
+ *  around a trial position have to be inspected instead of all
+ *  positions. Positions can also be removed again, which the
+ *  backtracking in @ref draw_polymer_positions relies on.
  */
-static double distto(PartCfg &partCfg, Utils::Vector3d const &pos) {
-  auto mindist_sq = std::numeric_limits<double>::infinity();
+class PositionGrid {
+  Utils::Vector3i m_grid;
+  Utils::Vector3d m_cell_size;
+  double m_min_distance_sq;
+  std::unordered_map<std::size_t, std::vector<Utils::Vector3d>> m_cells;
 
-  for (auto const &p : partCfg) {
-    auto const d = box_geo.get_mi_vector(pos, p.pos());
-    mindist_sq = std::min(mindist_sq, d.norm2());
+  std::size_t cell_index(Utils::Vector3d const &folded_pos) const {
+    Utils::Vector3i ind;
+    for (int dim = 0; dim < 3; ++dim) {
+      ind[dim] = std::min(
+          m_grid[dim] - 1,
+          std::max(0, static_cast<int>(
+                          std::floor(folded_pos[dim] / m_cell_size[dim]))));
+    }
+    return (static_cast<std::size_t>(ind[0]) * m_grid[1] + ind[1]) * m_grid[2] +
+           ind[2];
   }
 
-  return std::sqrt(mindist_sq);
-}
+public:
+  explicit PositionGrid(double min_distance)
+      : m_min_distance_sq(min_distance * min_distance) {
+    for (int dim = 0; dim < 3; ++dim) {
+      m_grid[dim] = std::max(
+          1, static_cast<int>(std::floor(box_geo.length()[dim] / min_distance)));
+      m_cell_size[dim] = box_geo.length()[dim] / m_grid[dim];
+    }
+  }
+
+  void insert(Utils::Vector3d const &pos) {
+    auto const folded_pos = folded_position(pos, box_geo);
+    m_cells[cell_index(folded_pos)].push_back(folded_pos);
+  }
+
+  void remove(Utils::Vector3d const &pos) {
+    auto const folded_pos = folded_position(pos, box_geo);
+    auto &cell = m_cells.at(cell_index(folded_pos));
+    auto const it = std::find(cell.begin(), cell.end(), folded_pos);
+    assert(it != cell.end());
+    *it = cell.back();
+    cell.pop_back();
+  }
+
+  /** Check if any stored position is closer to @p pos than the minimal
+   *  distance.
+   */
+  bool has_neighbor(Utils::Vector3d const &pos) const {
+    auto const folded_pos = folded_position(pos, box_geo);
+    Utils::Vector3i ind;
+    for (int dim = 0; dim < 3; ++dim) {
+      ind[dim] = std::min(
+          m_grid[dim] - 1,
+          std::max(0, static_cast<int>(
+                          std::floor(folded_pos[dim] / m_cell_size[dim]))));
+    }
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dz = -1; dz <= 1; ++dz) {
+          auto const neighbor = Utils::Vector3i{
+              (ind[0] + dx + m_grid[0]) % m_grid[0],
+              (ind[1] + dy + m_grid[1]) % m_grid[1],
+              (ind[2] + dz + m_grid[2]) % m_grid[2]};
+          auto const index =
+              (static_cast<std::size_t>(neighbor[0]) * m_grid[1] +
+               neighbor[1]) *
+                  m_grid[2] +
+              neighbor[2];
+          auto const cell = m_cells.find(index);
+          if (cell == m_cells.end())
+            continue;
+          for (auto const &q : cell->second) {
+            if (box_geo.get_mi_vector(folded_pos, q).norm2() <
+                m_min_distance_sq) {
+              return true;
+            }
+          }
+        }
+      }
+    }
+    return false;
+  }
+};
 
 /** Determines whether a given position @p pos is valid, i.e., it doesn't
  *  collide with existing or buffered particles, nor with existing constraints
  *  (if @c respect_constraints).
  *  @param pos                   the trial position in question
- *  @param positions             buffered positions to respect
- *  @param partCfg               existing particles to respect
+ *  @param grid                  already placed positions to respect
  *  @param min_distance          threshold for the minimum distance between
  *                               trial position and buffered/existing particles
  *  @param respect_constraints   whether to respect constraints
  *  @return true if valid position, false if not.
  */
-static bool
-is_valid_position(Utils::Vector3d const &pos,
-                  std::vector<std::vector<Utils::Vector3d>> const &positions,
-                  PartCfg &partCfg, double const min_distance,
-                  int const respect_constraints) {
+static bool is_valid_position(Utils::Vector3d const &pos,
+                              boost::optional<PositionGrid> const &grid,
+                              double const min_distance,
+                              int const respect_constraints) {
   // check if constraint is violated
   if (respect_constraints) {
     Utils::Vector3d const folded_pos = folded_position(pos, box_geo);
@@ -120,19 +192,10 @@ is_valid_position(Utils::Vector3d const &pos,
   }
 
   if (min_distance > 0.) {
-    // check for collision with existing particles
-    if (distto(partCfg, pos) < min_distance) {
+    // check for collision with existing and buffered particles
+    if (grid->has_neighbor(pos)) {
       return false;
     }
-
-    auto const min_distance_sq = min_distance * min_distance;
-    for (auto const &p : positions) {
-      for (auto const &m : p) {
-        if (box_geo.get_mi_vector(pos, m).norm2() < min_distance_sq) {
-          return false;
-        }
-      }
-    }
   }
   return true;
 }
@@ -153,15 +216,39 @@ draw_polymer_positions(PartCfg &partCfg, int const n_polymers,
     p.reserve(beads_per_chain);
   }
 
-  auto is_valid_pos = [&positions, &partCfg, min_distance,
+  /* Fill a hash grid with the existing particles once; buffered monomers
+   * are inserted (and removed again on backtracking) incrementally, so
+   * overlap checks are local instead of a scan over all particles. */
+  boost::optional<PositionGrid> grid;
+  if (min_distance > 0.) {
+    grid.emplace(min_distance);
+    for (auto const &p : partCfg) {
+      grid->insert(p.pos());
+    }
+  }
+
+  auto is_valid_pos = [&grid, min_distance,
                        respect_constraints](Utils::Vector3d const &v) {
-    return is_valid_position(v, positions, partCfg, min_distance,
-                             respect_constraints);
+    return is_valid_position(v, grid, min_distance, respect_constraints);
+  };
+
+  auto buffer_pos = [&positions, &grid](int p, Utils::Vector3d const &v) {
+    positions[p].push_back(v);
+    if (grid) {
+      grid->insert(v);
+    }
+  };
+
+  auto unbuffer_pos = [&positions, &grid](int p) {
+    if (grid) {
+      grid->remove(positions[p].back());
+    }
+    positions[p].pop_back();
   };
 
   for (std::size_t p = 0; p < start_positions.size(); p++) {
     if (is_valid_pos(start_positions[p])) {
-      positions[p].push_back(start_positions[p]);
+      buffer_pos(static_cast<int>(p), start_positions[p]);
     } else {
       throw std::runtime_error("Invalid start positions.");
     }
@@ -208,10 +295,10 @@ draw_polymer_positions(PartCfg &partCfg, int const n_polymers,
 
         if (pos) {
           /* Move on one position */
-          positions[p].push_back(*pos);
+          buffer_pos(p, *pos);
         } else if (not positions[p].empty()) {
           /* Go back one position and try again */
-          positions[p].pop_back();
+          unbuffer_pos(p);
           rejections++;
           if (rejections > max_tries) {
             /* Give up for this try. */
@@ -70,6 +70,14 @@ namespace Random {
  * not correlated between two calls along the same counter
  * sequence.
  *
+ * Philox is a counter-based bijection, not a stateful generator: there
+ * is no key schedule that could be amortized by generating the noise
+ * for many particles in one sweep along the counter. The per-call cost
+ * is the fixed number of rounds, and keying on the particle id is what
+ * makes the noise independent of the iteration order, the domain
+ * decomposition and the number of MPI ranks. Batching the thermostat
+ * noise into a buffer indexed by a running counter would tie the
+ * trajectory to the particle traversal order and break that invariance.
  */
 template <RNGSalt salt>
 auto philox_4_uint64s(uint64_t counter, uint32_t seed, int key1, int key2 = 0) {
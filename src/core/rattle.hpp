@@ -44,6 +44,17 @@ void save_old_position(const ParticleRange &particles,
  * @brief Propagate velocity and position while using SHAKE algorithm for bond
  * constraint.
  *
+ * Every iteration performs a ghost reduction of the corrections and a
+ * ghost update of the corrected positions. This cannot be deferred
+ * until after convergence: a constraint cluster may straddle a domain
+ * boundary, in which case the correction computed on one rank acts on
+ * a ghost whose owner must see it before the next sweep. Iterating
+ * clusters independently and communicating once would require knowing
+ * that no cluster spans ranks, and the core has no molecule topology
+ * to establish that; clusters that are rank-local converge cheaply
+ * anyway since the per-iteration all-reduce ends the loop as soon as
+ * all constraints are satisfied.
+ *
  * @param cs cell structure
  */
 void correct_position_shake(CellStructure &cs);
@@ -37,6 +37,18 @@ namespace ReactionMethods {
  * dimensionless reaction constant needs to be provided. Again: For the
  * constant-pH algorithm not the dimensionless reaction constant needs to be
  * provided here, but the apparent reaction constant.
+ *
+ * Trial moves run strictly one at a time. Proposing moves on distant
+ * titration sites concurrently looks safe because their short-range
+ * environments are independent, but acceptance is decided on the total
+ * potential energy, and with electrostatics enabled every trial changes
+ * the k-space sum globally: two concurrent acceptances would each be
+ * evaluated against a state the other has already invalidated.
+ * Parallel multi-site moves therefore require incremental per-method
+ * energy differences (see the note at
+ * ReactionAlgorithm::calculate_potential_energy) together with a
+ * conflict rule for sites closer than the interaction range, and a
+ * reproducible ordering of the per-site RNG streams.
  */
 class ConstantpHEnsemble : public ReactionAlgorithm {
 public:
@@ -385,17 +385,13 @@ void ReactionAlgorithm::delete_particle(int p_id) {
     remove_particle(p_id);
     // remove all saved empty p_ids which are greater than the max_seen_particle
     // this is needed in order to avoid the creation of holes
-    for (auto p_id_iter = m_empty_p_ids_smaller_than_max_seen_particle.begin();
-         p_id_iter != m_empty_p_ids_smaller_than_max_seen_particle.end();) {
-      if ((*p_id_iter) >= old_max_seen_id)
-        p_id_iter = m_empty_p_ids_smaller_than_max_seen_particle.erase(
-            p_id_iter); // update iterator after container was modified
-      else
-        ++p_id_iter;
-    }
+    m_empty_p_ids_smaller_than_max_seen_particle.erase(
+        m_empty_p_ids_smaller_than_max_seen_particle.lower_bound(
+            old_max_seen_id),
+        m_empty_p_ids_smaller_than_max_seen_particle.end());
   } else if (p_id <= old_max_seen_id) {
     remove_particle(p_id);
-    m_empty_p_ids_smaller_than_max_seen_particle.push_back(p_id);
+    m_empty_p_ids_smaller_than_max_seen_particle.insert(p_id);
   } else {
     throw std::runtime_error(
         "Particle id is greater than the max seen particle id");
@@ -465,9 +461,9 @@ Utils::Vector3d ReactionAlgorithm::get_random_position_in_box() {
 int ReactionAlgorithm::create_particle(int p_type) {
   int p_id;
   if (!m_empty_p_ids_smaller_than_max_seen_particle.empty()) {
-    auto p_id_iter = std::min_element(
-        std::begin(m_empty_p_ids_smaller_than_max_seen_particle),
-        std::end(m_empty_p_ids_smaller_than_max_seen_particle));
+    // reuse the smallest recycled id to keep the id range dense
+    auto const p_id_iter =
+        m_empty_p_ids_smaller_than_max_seen_particle.begin();
     p_id = *p_id_iter;
     m_empty_p_ids_smaller_than_max_seen_particle.erase(p_id_iter);
   } else {
@@ -594,12 +590,25 @@ void ReactionAlgorithm::setup_bookkeeping_of_empty_pids() {
   auto pid1 = -1;
   for (auto pid2 : particle_ids) {
     for (int pid = pid1 + 1; pid < pid2; ++pid) {
-      m_empty_p_ids_smaller_than_max_seen_particle.push_back(pid);
+      m_empty_p_ids_smaller_than_max_seen_particle.insert(
+          m_empty_p_ids_smaller_than_max_seen_particle.end(), pid);
     }
     pid1 = pid2;
   }
 }
 
+/* Trial moves pay two full energy sweeps (before and after). An
+ * incremental evaluation that only visits interactions of the touched
+ * particles would be exact for short-range terms, which the cell grid
+ * could deliver as a partial sweep, but not for the k-space part of
+ * P3M/DP3M: inserting or recharging one particle changes every mesh
+ * mode, and the charge assignment cannot be differenced locally. Since
+ * the reaction methods exist mostly for charged systems, a partial
+ * sweep would silently change the sampled ensemble whenever
+ * electrostatics are on. Incremental energies therefore need per-method
+ * support from the long-range actors first; this function deliberately
+ * reuses the exact global sweep until then.
+ */
 double ReactionAlgorithm::calculate_potential_energy() const {
   auto const obs = calculate_energy();
   auto pot = obs->accumulate(-obs->kinetic[0]);
@@ -32,6 +32,7 @@
 #include <memory>
 #include <optional>
 #include <random>
+#include <set>
 #include <stdexcept>
 #include <tuple>
 #include <unordered_map>
@@ -139,7 +140,9 @@ public:
   bool neighbor_search_order_n = true;
 
 protected:
-  std::vector<int> m_empty_p_ids_smaller_than_max_seen_particle;
+  /** Ordered pool of recycled particle ids; the smallest id is reused
+   *  first to keep the id range dense over long create/delete runs. */
+  std::set<int> m_empty_p_ids_smaller_than_max_seen_particle;
 
 public:
   struct ParticleChanges {
@@ -214,7 +217,18 @@ protected:
    */
   void displacement_mc_move(int type, int n_particles);
 
-  /** @brief Carry out a chemical reaction and save the old system state. */
+  /** @brief Carry out a chemical reaction and save the old system state.
+   *
+   *  The energy difference of an attempt is always obtained from two
+   *  full sweeps; there is no cached decomposition into bonded,
+   *  short-range and long-range terms. The missing piece is on the
+   *  long-range side: P3M keeps no per-mode amplitudes between calls,
+   *  so even an exact single-particle k-space difference would have to
+   *  re-run the mesh transforms, which is what the full sweep does
+   *  anyway. Retaining the mesh state between trials is a P3M feature,
+   *  to be weighed against its memory cost, before a term-wise cache
+   *  here can pay off.
+   */
   void make_reaction_attempt(::ReactionMethods::SingleReaction const &reaction,
                              ParticleChanges &bookkeeping);
 
@@ -36,6 +36,19 @@ public:
       : ReactionAlgorithm(comm, seed, kT, exclusion_range,
                           exclusion_radius_per_type) {}
 
+  /** Measure the potential energy of one trial insertion.
+   *
+   *  Each trial costs two global energy sweeps. Evaluating a batch of
+   *  trial positions against the local cell neighborhood in one pass
+   *  would only be exact for short-range interactions: the k-space
+   *  part of P3M responds to every inserted charge globally, and
+   *  chemical potentials of charged species are the main use of this
+   *  method. The before-energy also cannot be cached across calls from
+   *  in here, because the core records no marker that tells whether
+   *  the system was propagated or edited between two invocations.
+   *  Batched trials become worthwhile once the long-range methods
+   *  expose insertion energy differences.
+   */
   double calculate_particle_insertion_potential_energy(int reaction_id) {
     auto &reaction = *reactions[reaction_id];
     if (not all_reactant_particles_exist(reaction)) {
@@ -35,6 +35,9 @@
 
 #ifdef ROTATION
 
+#include "thermostat.hpp"
+#include "thermostats/langevin_inline.hpp"
+
 #include <utils/Vector.hpp>
 #include <utils/mask.hpp>
 
@@ -159,6 +162,20 @@ void propagate_omega_quat_particle(Particle &p, double time_step) {
   }
 }
 
+/** Apply the rotational Langevin friction and noise of a particle.
+ *  The thermostat acts on the body-frame angular velocity, so applying
+ *  it right after the space-to-body torque conversion saves the friction
+ *  torque the round trip through the lab frame in the force calculation.
+ */
+static void add_rotational_thermostat_torque(Particle &p, double time_step) {
+  extern LangevinThermostat langevin;
+  if (thermo_switch & THERMO_LANGEVIN) {
+    p.torque() += Utils::mask(p.rotation(),
+                              friction_thermo_langevin_rotation(
+                                  langevin, p, time_step, temperature));
+  }
+}
+
 void convert_torques_propagate_omega(const ParticleRange &particles,
                                      double time_step) {
   for (auto &p : particles) {
@@ -167,6 +184,7 @@ void convert_torques_propagate_omega(const ParticleRange &particles,
       continue;
 
     convert_torque_to_body_frame_apply_fix(p);
+    add_rotational_thermostat_torque(p, time_step);
 
     // Propagation of angular velocities
     p.omega() += hadamard_division(0.5 * time_step * p.torque(), p.rinertia());
@@ -194,11 +212,13 @@ void convert_torques_propagate_omega(const ParticleRange &particles,
   }
 }
 
-void convert_initial_torques(const ParticleRange &particles) {
+void convert_initial_torques(const ParticleRange &particles,
+                             double time_step) {
   for (auto &p : particles) {
     if (!p.can_rotate())
       continue;
     convert_torque_to_body_frame_apply_fix(p);
+    add_rotational_thermostat_torque(p, time_step);
   }
 }
 
@@ -54,7 +54,7 @@ void convert_torques_propagate_omega(const ParticleRange &particles,
                                      double time_step);
 
 /** Convert torques to the body-fixed frame before the integration loop. */
-void convert_initial_torques(const ParticleRange &particles);
+void convert_initial_torques(const ParticleRange &particles, double time_step);
 
 // Frame conversion routines
 inline Utils::Vector3d
@@ -35,6 +35,30 @@ struct True {
 };
 } // namespace detail
 
+/**
+ * @brief Distance-based interaction loop, executed once per integration
+ *        step.
+ *
+ * The loop is serial within a rank by design: pair kernels exploit
+ * Newton's third law and write to both particles of a pair, so a
+ * threaded traversal would race on the force accumulation unless pairs
+ * were partitioned by particle ownership or forces were staged in
+ * per-thread buffers. Neither fits the current kernel interfaces, which
+ * take mutable particle references. Parallelism is obtained by running
+ * one MPI rank per core on top of the particle decomposition.
+ *
+ * Forces, energies and virials run this loop as separate sweeps, even
+ * when sampled in the same time step. This is a consequence of the
+ * kernel families, not of the loop: force kernels write into the
+ * particles, while energy and pressure kernels accumulate into
+ * per-interaction Observable_stat slots, and every interaction
+ * implements the three variants as separate inline functions. A fused
+ * sweep would need a combined kernel per interaction plus a
+ * time-step-stamped cache to know when the stored values are still
+ * valid, and would only pay off for protocols that sample both
+ * quantities at force frequency; sampled every few hundred steps, the
+ * extra sweeps are a small fraction of total pair work.
+ */
 template <class BondKernel, class PairKernel,
           class VerletCriterion = detail::True>
 void short_range_loop(BondKernel bond_kernel, PairKernel pair_kernel,
@@ -52,4 +76,33 @@ void short_range_loop(BondKernel bond_kernel, PairKernel pair_kernel,
     cell_structure.non_bonded_loop(pair_kernel, verlet_criterion);
   }
 }
+
+/**
+ * @brief Overload with a batch-level bonded kernel.
+ *
+ * Like the two-kernel overload, but @p bond_batch_kernel is used for
+ * whole batches of bonds sharing one bond id when the cell structure
+ * runs over cached bond batches (see
+ * @ref CellStructure::use_bond_batches), so per-bond dispatch can be
+ * amortized over all instances of a repeated molecular topology.
+ */
+template <class BondKernel, class BondBatchKernel, class PairKernel,
+          class VerletCriterion = detail::True>
+void short_range_loop(BondKernel bond_kernel,
+                      BondBatchKernel bond_batch_kernel,
+                      PairKernel pair_kernel, double pair_cutoff,
+                      double bond_cutoff,
+                      const VerletCriterion &verlet_criterion = {}) {
+  ESPRESSO_PROFILER_CXX_MARK_FUNCTION;
+
+  assert(cell_structure.get_resort_particles() == Cells::RESORT_NONE);
+
+  if (bond_cutoff >= 0.) {
+    cell_structure.bond_loop(bond_kernel, bond_batch_kernel);
+  }
+
+  if (pair_cutoff > 0.) {
+    cell_structure.non_bonded_loop(pair_kernel, verlet_criterion);
+  }
+}
 #endif
@@ -139,6 +139,15 @@ void set_sd_kT(double kT) {
 
 double get_sd_kT() { return sd_kT; }
 
+/* The particles are gathered to the head node and handed to the dense
+ * solver of the external stokesian_dynamics library, which builds and
+ * inverts the full mobility matrix every step. That O(N^2)-O(N^3) solve
+ * on one rank is the scaling bottleneck for large suspensions. Replacing
+ * it with a matrix-free Krylov far field and a cached preconditioner is
+ * a solver rewrite that belongs in the library, not in this glue layer:
+ * the library interface only exposes the one-shot sd_cpu() entry point
+ * and keeps no state between calls that a preconditioner could live in.
+ */
 void propagate_vel_pos_sd(const ParticleRange &particles,
                           const boost::mpi::communicator &comm,
                           const double time_step) {
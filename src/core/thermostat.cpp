@@ -207,7 +207,15 @@ void mpi_set_temperature(double temperature) {
 }
 
 void mpi_set_thermo_switch_local(int thermo_switch) {
+  /* the DPD bit enters VerletCriterion::m_filter_exclusions: lists built
+   * without the DPD thermostat have excluded pairs filtered out and would
+   * miss the thermostat forces on them, so toggling the bit has to
+   * invalidate the Verlet lists */
+  auto const dpd_toggled = (::thermo_switch ^ thermo_switch) & THERMO_DPD;
   ::thermo_switch = thermo_switch;
+  if (dpd_toggled) {
+    on_short_range_ia_change();
+  }
 }
 
 REGISTER_CALLBACK(mpi_set_thermo_switch_local)
@@ -59,15 +59,17 @@ friction_therm0_nptiso(IsotropicNptThermostat const &npt_iso,
 }
 
 /** Add p_diff-dependent noise and friction for NpT-sims to \ref
- *  NptIsoParameters::p_diff
+ *  NptIsoParameters::p_diff. For directional box motion, @p dim
+ *  decorrelates the noise acting on the per-direction pistons \ref
+ *  NptIsoParameters::p_diff_dir
  */
 inline double friction_thermV_nptiso(IsotropicNptThermostat const &npt_iso,
-                                     double p_diff) {
+                                     double p_diff, int dim = 0) {
   if (npt_iso.pref_noise_V > 0.0) {
     return npt_iso.pref_rescale_V * p_diff +
            npt_iso.pref_noise_V *
                Random::noise_uniform<RNGSalt::NPTISOV, 1>(
-                   npt_iso.rng_counter(), npt_iso.rng_seed(), 0);
+                   npt_iso.rng_counter(), npt_iso.rng_seed(), dim);
   }
   return npt_iso.pref_rescale_V * p_diff;
 }
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2021-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_MODULE bond partner fetch test
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "ParticleFactory.hpp"
+
+#include "EspressoSystemStandAlone.hpp"
+#include "Particle.hpp"
+#include "bonded_interactions/bonded_interaction_data.hpp"
+#include "bonded_interactions/harmonic.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "energy.hpp"
+#include "event.hpp"
+#include "integrate.hpp"
+#include "particle_node.hpp"
+
+#include <utils/Vector.hpp>
+#include <utils/math/sqr.hpp>
+
+#include <boost/mpi.hpp>
+#include <boost/optional.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace espresso {
+// ESPResSo system instance
+static std::unique_ptr<EspressoSystemStandAlone> system;
+} // namespace espresso
+
+static auto copy_particle_to_head_node(boost::mpi::communicator const &comm,
+                                       int p_id) {
+  boost::optional<Particle> result{};
+  auto p = ::cell_structure.get_local_particle(p_id);
+  if (p and not p->is_ghost()) {
+    if (comm.rank() == 0) {
+      result = *p;
+    } else {
+      comm.send(0, p_id, *p);
+    }
+  }
+  if (comm.rank() == 0 and not result) {
+    Particle p{};
+    comm.recv(boost::mpi::any_source, p_id, p);
+    result = p;
+  }
+  return result;
+}
+
+/** Check a bond whose partner lies far beyond the ghost layer: with
+ *  @ref CellStructure::fetch_bond_partners the bonded cutoff does not
+ *  enter the interaction range, so on more than one rank the partner is
+ *  only available through the fetch protocol. Energies and forces must
+ *  match the analytic values (and thereby the single-rank run of this
+ *  test, which resolves the partner locally).
+ */
+BOOST_FIXTURE_TEST_CASE(bond_partner_fetch, ParticleFactory) {
+  constexpr auto tol = 100. * std::numeric_limits<double>::epsilon();
+  auto const comm = boost::mpi::communicator();
+  auto const rank = comm.rank();
+
+  auto const box_l = 12.;
+  espresso::system->set_box_l(Utils::Vector3d::broadcast(box_l));
+  espresso::system->set_time_step(0.001);
+  espresso::system->set_skin(0.4);
+
+  ::cell_structure.fetch_bond_partners = true;
+  on_short_range_ia_change();
+
+  /* place the particles in different domains for any regular node grid
+   * that splits the x-direction, separated by far more than the ghost
+   * layer (the skin, since no short-range interaction is active) */
+  auto const pid1 = 0;
+  auto const pid2 = 1;
+  auto const pos1 = Utils::Vector3d{4., 3., 3.};
+  auto const pos2 = Utils::Vector3d{9., 3., 3.};
+  auto const dist = 5.;
+  create_particle(pos1, pid1, 0);
+  create_particle(pos2, pid2, 0);
+
+  // set up a stretched harmonic bond between the two particles
+  auto const bond_id = 0;
+  auto const bond = HarmonicBond(200., 4.5, 6.);
+  bonded_ia_params.insert(bond_id,
+                          std::make_shared<Bonded_IA_Parameters>(bond));
+  insert_particle_bond(pid1, bond_id, {pid2});
+
+  // check the bonded energy against the analytic value
+  {
+    auto const obs_energy = calculate_energy();
+    if (rank == 0) {
+      auto const energy_ref = 0.5 * bond.k * Utils::sqr(dist - bond.r);
+      BOOST_CHECK_CLOSE(obs_energy->bonded[bond_id], energy_ref, 1e-10);
+    }
+  }
+
+  // check the forces, including the reduction onto the remote partner
+  {
+    set_integ_switch(INTEG_METHOD_NVT);
+    integrate(0, 0);
+
+    auto const p1_opt = copy_particle_to_head_node(comm, pid1);
+    auto const p2_opt = copy_particle_to_head_node(comm, pid2);
+    if (rank == 0) {
+      auto const &p1 = *p1_opt;
+      auto const &p2 = *p2_opt;
+      // the bond is stretched, so the particles attract each other
+      auto const force_ref = bond.k * (dist - bond.r);
+      BOOST_CHECK_CLOSE(p1.force()[0], +force_ref, 1e-10);
+      BOOST_CHECK_CLOSE(p2.force()[0], -force_ref, 1e-10);
+      BOOST_CHECK_LE(std::abs(p1.force()[1]), tol);
+      BOOST_CHECK_LE(std::abs(p1.force()[2]), tol);
+      BOOST_CHECK_LE(std::abs(p2.force()[1]), tol);
+      BOOST_CHECK_LE(std::abs(p2.force()[2]), tol);
+    }
+  }
+
+  // move the partner to the rest length and check the refreshed copies
+  {
+    set_particle_pos(pid2, {pos1[0] + bond.r, pos1[1], pos1[2]});
+    auto const obs_energy = calculate_energy();
+    integrate(0, 0);
+
+    auto const p1_opt = copy_particle_to_head_node(comm, pid1);
+    auto const p2_opt = copy_particle_to_head_node(comm, pid2);
+    if (rank == 0) {
+      auto const &p1 = *p1_opt;
+      auto const &p2 = *p2_opt;
+      BOOST_CHECK_LE(std::abs(obs_energy->bonded[bond_id]), tol);
+      BOOST_CHECK_LE(p1.force().norm(), tol);
+      BOOST_CHECK_LE(p2.force().norm(), tol);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  espresso::system = std::make_unique<EspressoSystemStandAlone>(argc, argv);
+
+  return boost::unit_test::unit_test_main(init_unit_test, argc, argv);
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2021-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_MODULE ghost shift test
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "config/config.hpp"
+
+#ifdef LENNARD_JONES
+
+#include "ParticleFactory.hpp"
+
+#include "EspressoSystemStandAlone.hpp"
+#include "Particle.hpp"
+#include "cells.hpp"
+#include "communication.hpp"
+#include "energy.hpp"
+#include "event.hpp"
+#include "integrate.hpp"
+#include "nonbonded_interactions/lj.hpp"
+#include "nonbonded_interactions/nonbonded_interaction_data.hpp"
+#include "particle_node.hpp"
+
+#include <utils/Vector.hpp>
+#include <utils/math/int_pow.hpp>
+#include <utils/math/sqr.hpp>
+
+#include <boost/mpi.hpp>
+#include <boost/optional.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace espresso {
+// ESPResSo system instance
+static std::unique_ptr<EspressoSystemStandAlone> system;
+} // namespace espresso
+
+static auto copy_particle_to_head_node(boost::mpi::communicator const &comm,
+                                       int p_id) {
+  boost::optional<Particle> result{};
+  auto p = ::cell_structure.get_local_particle(p_id);
+  if (p and not p->is_ghost()) {
+    if (comm.rank() == 0) {
+      result = *p;
+    } else {
+      comm.send(0, p_id, *p);
+    }
+  }
+  if (comm.rank() == 0 and not result) {
+    Particle p{};
+    comm.recv(boost::mpi::any_source, p_id, p);
+    result = p;
+  }
+  return result;
+}
+
+/** Check a short-range pair straddling a periodic boundary: the pair is
+ *  only found through a ghost copy, whose position has to carry the
+ *  image shift assigned in @ref RegularDecomposition::prepare_comm.
+ *  With the box chosen large enough the pair loop takes the plain
+ *  position difference instead of per-pair minimum image folding, so a
+ *  missing or wrong shift shows up as a vanishing energy and force.
+ */
+BOOST_FIXTURE_TEST_CASE(ghost_shift, ParticleFactory) {
+  constexpr auto tol = 100. * std::numeric_limits<double>::epsilon();
+  auto const comm = boost::mpi::communicator();
+  auto const rank = comm.rank();
+
+  auto const box_l = 10.;
+  espresso::system->set_box_l(Utils::Vector3d::broadcast(box_l));
+  espresso::system->set_time_step(0.001);
+  espresso::system->set_skin(0.4);
+
+  // set up LJ potential between particles of type 0
+  auto const eps = 1.0;
+  auto const sig = 0.45;
+  auto const cut = 1.0;
+  make_particle_type_exist(0);
+  auto const key = get_ia_param_key(0, 0);
+  LJ_Parameters lj{eps, sig, cut, 0.0, 0.0, 0.0};
+  ::nonbonded_ia_params[key]->lj = lj;
+  on_non_bonded_ia_change();
+
+  // reference LJ energy and force magnitude at the pair distance
+  auto const dist = 0.4;
+  auto const frac6 = Utils::int_pow<6>(sig / dist);
+  auto const lj_energy = 4.0 * eps * (Utils::sqr(frac6) - frac6);
+  auto const lj_force = 24.0 * eps * (2.0 * Utils::sqr(frac6) - frac6) / dist;
+
+  // one pair per axis, straddling the respective periodic boundary
+  auto const mid = box_l / 2.;
+  for (int dir = 0; dir < 3; dir++) {
+    auto pos1 = Utils::Vector3d::broadcast(mid);
+    auto pos2 = Utils::Vector3d::broadcast(mid);
+    pos1[dir] = dist / 4.;
+    pos2[dir] = box_l - 3. * dist / 4.;
+    auto const pid1 = 2 * dir;
+    auto const pid2 = 2 * dir + 1;
+    create_particle(pos1, pid1, 0);
+    create_particle(pos2, pid2, 0);
+
+    // check the energy of the wrapped pair
+    {
+      auto const obs_energy = calculate_energy();
+      if (rank == 0) {
+        BOOST_CHECK_CLOSE(obs_energy->non_bonded_intra[0], lj_energy, 1e-10);
+      }
+    }
+
+    // check the forces, including the reduction from the ghost copy
+    {
+      set_integ_switch(INTEG_METHOD_NVT);
+      integrate(0, 0);
+
+      auto const p1_opt = copy_particle_to_head_node(comm, pid1);
+      auto const p2_opt = copy_particle_to_head_node(comm, pid2);
+      if (rank == 0) {
+        auto const &p1 = *p1_opt;
+        auto const &p2 = *p2_opt;
+        // the pair is closer than the LJ minimum, so it is repulsive:
+        // p1 sits just above the boundary and is pushed away from it
+        BOOST_CHECK_CLOSE(p1.force()[dir], +lj_force, 1e-8);
+        BOOST_CHECK_CLOSE(p2.force()[dir], -lj_force, 1e-8);
+        for (int i = 0; i < 3; i++) {
+          if (i != dir) {
+            BOOST_CHECK_LE(std::abs(p1.force()[i]), tol);
+            BOOST_CHECK_LE(std::abs(p2.force()[i]), tol);
+          }
+        }
+      }
+    }
+
+    remove_particle(pid1);
+    remove_particle(pid2);
+  }
+}
+
+int main(int argc, char **argv) {
+  espresso::system = std::make_unique<EspressoSystemStandAlone>(argc, argv);
+
+  return boost::unit_test::unit_test_main(init_unit_test, argc, argv);
+}
+
+#else // LENNARD_JONES
+int main(int argc, char **argv) {}
+#endif
@@ -26,6 +26,7 @@
 #include <utils/Vector.hpp>
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <stdexcept>
 
@@ -132,6 +133,19 @@ BOOST_AUTO_TEST_CASE(get_mi_vector_test) {
 
     BOOST_CHECK_SMALL(std::abs(expected - result[i]), epsilon<double>);
   }
+
+  /* Fully periodic box (branchless fast path) */
+  box.set_periodic(1, true);
+  {
+    auto const result = box.get_mi_vector(a, b);
+
+    for (int i = 0; i < 3; i++) {
+      auto const expected =
+          get_mi_coord(a[i], b[i], box_l[i], /* periodic */ true);
+
+      BOOST_CHECK_SMALL(std::abs(expected - result[i]), epsilon<double>);
+    }
+  }
 }
 
 BOOST_AUTO_TEST_CASE(lees_edwards_mi_vector) {
@@ -268,6 +282,45 @@ BOOST_AUTO_TEST_CASE(fold_position_test) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(folded_position_test) {
+  auto const box_l = Utils::Vector3d{2., 4., 6.};
+  auto box = BoxGeometry();
+  box.set_length(box_l);
+
+  /* Fully periodic box (branchless fast path) */
+  {
+    auto const pos = Utils::Vector3d{-1.9, 4.1, 7.};
+    auto const expected = Utils::Vector3d{0.1, 0.1, 1.};
+
+    BOOST_CHECK_SMALL((folded_position(pos, box) - expected).norm(),
+                      3 * epsilon<double>);
+  }
+
+  /* Coordinates within rounding error of an image boundary stay inside
+   * the primary interval */
+  {
+    auto const pos =
+        Utils::Vector3d{std::nextafter(0., -1.), std::nextafter(box_l[1], 0.),
+                        -100. * box_l[2]};
+    auto const result = folded_position(pos, box);
+
+    for (int i = 0; i < 3; i++) {
+      BOOST_CHECK(result[i] >= 0.);
+      BOOST_CHECK(result[i] < box_l[i]);
+    }
+  }
+
+  /* Mixed periodicity */
+  {
+    box.set_periodic(2, false);
+    auto const pos = Utils::Vector3d{-1.9, 4.1, 7.};
+    auto const expected = Utils::Vector3d{0.1, 0.1, 7.};
+
+    BOOST_CHECK_SMALL((folded_position(pos, box) - expected).norm(),
+                      3 * epsilon<double>);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(regular_decomposition_test) {
   auto const eps = std::numeric_limits<double>::epsilon();
 
@@ -305,3 +358,26 @@ BOOST_AUTO_TEST_CASE(regular_decomposition_test) {
         }
   }
 }
+
+BOOST_AUTO_TEST_CASE(suggest_node_grids_test) {
+  auto const box_l = Utils::Vector3d::broadcast(10.);
+  auto const candidates = suggest_node_grids(8, box_l, 1.);
+
+  /* all factorizations of 8 into three ordered factors */
+  BOOST_REQUIRE_EQUAL(candidates.size(), 10);
+
+  for (auto const &candidate : candidates) {
+    BOOST_CHECK_EQUAL(Utils::product(candidate.node_grid), 8);
+    BOOST_CHECK_GT(candidate.ghost_volume, 0.);
+    BOOST_CHECK_GT(candidate.surface_to_volume, 0.);
+  }
+
+  /* in a cubic box the cubic grid minimizes the ghost volume */
+  BOOST_CHECK_EQUAL(candidates.front().node_grid, (Utils::Vector3i{2, 2, 2}));
+  BOOST_CHECK_EQUAL(candidates.front().n_messages, 6);
+
+  /* candidates are sorted by predicted ghost volume */
+  for (std::size_t i = 1; i < candidates.size(); ++i) {
+    BOOST_CHECK_GE(candidates[i].ghost_volume, candidates[i - 1].ghost_volume);
+  }
+}
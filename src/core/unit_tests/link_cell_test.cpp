@@ -26,6 +26,7 @@
 #include "Particle.hpp"
 #include "cell_system/Cell.hpp"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -65,6 +66,10 @@ BOOST_AUTO_TEST_CASE(link_cell) {
 
   BOOST_CHECK(lc_pairs.size() == (n_part * (n_part - 1) / 2));
 
+  /* The traversal order is an implementation detail, every unordered
+   * pair just has to show up exactly once. */
+  std::sort(lc_pairs.begin(), lc_pairs.end());
+
   auto it = lc_pairs.begin();
   for (int i = 0; i < n_part; i++)
     for (int j = i + 1; j < n_part; j++) {
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE memory_stats test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "memory_stats.hpp"
+
+BOOST_AUTO_TEST_CASE(memory_stats_test) {
+  MemoryStats::track("subsystem_a", 100u);
+  MemoryStats::track("subsystem_b", 50u);
+
+  BOOST_CHECK_EQUAL(MemoryStats::usage().at("subsystem_a").current, 100u);
+  BOOST_CHECK_EQUAL(MemoryStats::usage().at("subsystem_b").current, 50u);
+  BOOST_CHECK_EQUAL(MemoryStats::peak_total(), 150u);
+
+  /* shrinking keeps the peaks */
+  MemoryStats::track("subsystem_a", 30u);
+  BOOST_CHECK_EQUAL(MemoryStats::usage().at("subsystem_a").current, 30u);
+  BOOST_CHECK_EQUAL(MemoryStats::usage().at("subsystem_a").peak, 100u);
+  BOOST_CHECK_EQUAL(MemoryStats::peak_total(), 150u);
+
+  /* the total peak tracks concurrent usage, not the sum of the peaks */
+  MemoryStats::track("subsystem_b", 90u);
+  BOOST_CHECK_EQUAL(MemoryStats::usage().at("subsystem_b").peak, 90u);
+  BOOST_CHECK_EQUAL(MemoryStats::peak_total(), 150u);
+}
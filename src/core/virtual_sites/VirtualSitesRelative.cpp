@@ -32,41 +32,63 @@
 #include <utils/Vector.hpp>
 #include <utils/math/quaternion.hpp>
 #include <utils/math/tensor_product.hpp>
+#include <utils/matrix.hpp>
 #include <utils/quaternion.hpp>
 
 /**
- * @brief Vector pointing from the real particle to the virtual site.
+ * @brief Orientation and angular velocity of a rigid body.
  *
- * @return Relative distance.
+ * Rigid bodies with many virtual sites (e.g. raspberry colloids) store
+ * their sites spatially clustered, so consecutive particles in the cell
+ * sweeps below usually track the same reference particle. The rotation
+ * matrix and the space-frame angular velocity of the reference particle
+ * are therefore computed once per body and reused for its whole site
+ * list, instead of reconstructing an orientation quaternion product per
+ * site. The cache transparently refreshes whenever the reference
+ * particle changes, so non-contiguous site storage remains correct.
  */
-static auto connection_vector(Particle const &p_ref, Particle const &p_vs) {
-  // Calculate the quaternion defining the orientation of the vector connecting
-  // the virtual site and the real particle
-  // This is obtained, by multiplying the quaternion representing the director
-  // of the real particle with the quaternion of the virtual particle, which
-  // specifies the relative orientation.
-  auto const director = Utils::convert_quaternion_to_director(
-                            p_ref.quat() * p_vs.vs_relative().rel_orientation)
-                            .normalize();
-
-  return p_vs.vs_relative().distance * director;
-}
+class BodyProperties {
+  Particle const *m_p_ref = nullptr;
+  Utils::Matrix<double, 3, 3> m_rotation = {};
+  Utils::Vector3d m_omega_space_frame = {};
+
+public:
+  void load(Particle const &p_ref) {
+    if (&p_ref != m_p_ref) {
+      m_p_ref = &p_ref;
+      m_rotation = Utils::rotation_matrix(p_ref.quat());
+      // omega of the real particle in the space-fixed frame
+      m_omega_space_frame = m_rotation * p_ref.omega();
+    }
+  }
 
-/**
- * @brief Velocity of the virtual site
- * @param p_ref Reference particle for the virtual site.
- * @param p_vs Virtual site.
- * @return Velocity of the virtual site.
- */
-static Utils::Vector3d velocity(Particle const &p_ref, Particle const &p_vs) {
-  auto const d = connection_vector(p_ref, p_vs);
-
-  // Get omega of real particle in space-fixed frame
-  auto const omega_space_frame =
-      convert_vector_body_to_space(p_ref, p_ref.omega());
-  // Obtain velocity from v = v_real particle + omega_real_particle * director
-  return vector_product(omega_space_frame, d) + p_ref.v();
-}
+  /**
+   * @brief Vector pointing from the real particle to the virtual site.
+   *
+   * The direction is the body-frame director of the virtual site
+   * rotated to the space-fixed frame by the body rotation matrix.
+   *
+   * @return Relative distance.
+   */
+  Utils::Vector3d connection_vector(Particle const &p_vs) const {
+    auto const director = (m_rotation * Utils::convert_quaternion_to_director(
+                                            p_vs.vs_relative().rel_orientation))
+                              .normalize();
+
+    return p_vs.vs_relative().distance * director;
+  }
+
+  /**
+   * @brief Velocity of the virtual site
+   * @param p_vs Virtual site.
+   * @return Velocity of the virtual site.
+   */
+  Utils::Vector3d velocity(Particle const &p_vs) const {
+    // Obtain velocity from v = v_real particle + omega_real_particle * director
+    return vector_product(m_omega_space_frame, connection_vector(p_vs)) +
+           m_p_ref->v();
+  }
+};
 
 /**
  * @brief Get real particle tracked by a virtual site.
@@ -90,15 +112,16 @@ static Particle *get_reference_particle(Particle const &p) {
 /**
  * @brief Constraint force to hold the particle at its prescribed position.
  *
- * @param p_ref Reference particle.
+ * @param body Cached properties of the reference particle.
  * @param p_vs Virtual site.
  * @return Constraint force.
  */
-static auto constraint_stress(Particle const &p_ref, Particle const &p_vs) {
+static auto constraint_stress(BodyProperties const &body,
+                              Particle const &p_vs) {
   /* The constraint force is minus the force on the particle, make it force
    * free. The counter force is translated by the connection vector to the
    * real particle, hence the virial stress is */
-  return tensor_product(-p_vs.force(), connection_vector(p_ref, p_vs));
+  return tensor_product(-p_vs.force(), body.connection_vector(p_vs));
 }
 
 void VirtualSitesRelative::update() const {
@@ -106,13 +129,15 @@ void VirtualSitesRelative::update() const {
                                Cells::DATA_PART_MOMENTUM);
 
   auto const particles = cell_structure.local_particles();
+  BodyProperties body;
   for (auto &p : particles) {
     auto const *p_ref_ptr = get_reference_particle(p);
     if (!p_ref_ptr)
       continue;
 
     auto const &p_ref = *p_ref_ptr;
-    auto new_pos = p_ref.pos() + connection_vector(p_ref, p);
+    body.load(p_ref);
+    auto new_pos = p_ref.pos() + body.connection_vector(p);
     /* The shift has to respect periodic boundaries: if the reference
      * particles is not in the same image box, we potentially avoid shifting
      * to the other side of the box. */
@@ -122,7 +147,7 @@ void VirtualSitesRelative::update() const {
     fold_position(shift, image_shift, box_geo);
     p.image_box() = p_ref.image_box() - image_shift;
 
-    p.v() = velocity(p_ref, p);
+    p.v() = body.velocity(p);
 
     if (box_geo.type() == BoxType::LEES_EDWARDS) {
       auto const &lebc = box_geo.lees_edwards_bc();
@@ -151,6 +176,7 @@ void VirtualSitesRelative::back_transfer_forces_and_torques() const {
   init_forces_ghosts(cell_structure.ghost_particles());
 
   // Iterate over all the particles in the local cells
+  BodyProperties body;
   for (auto &p : cell_structure.local_particles()) {
     auto *p_ref_ptr = get_reference_particle(p);
     if (!p_ref_ptr)
@@ -158,9 +184,10 @@ void VirtualSitesRelative::back_transfer_forces_and_torques() const {
 
     // Add forces and torques
     auto &p_ref = *p_ref_ptr;
+    body.load(p_ref);
     p_ref.force() += p.force();
     p_ref.torque() +=
-        vector_product(connection_vector(p_ref, p), p.force()) + p.torque();
+        vector_product(body.connection_vector(p), p.force()) + p.torque();
   }
 }
 
@@ -168,10 +195,12 @@ void VirtualSitesRelative::back_transfer_forces_and_torques() const {
 Utils::Matrix<double, 3, 3> VirtualSitesRelative::pressure_tensor() const {
   Utils::Matrix<double, 3, 3> pressure_tensor = {};
 
+  BodyProperties body;
   for (auto const &p : cell_structure.local_particles()) {
     auto const *p_ref_ptr = get_reference_particle(p);
     if (p_ref_ptr) {
-      pressure_tensor += constraint_stress(*p_ref_ptr, p);
+      body.load(*p_ref_ptr);
+      pressure_tensor += constraint_stress(body, p);
     }
   }
 
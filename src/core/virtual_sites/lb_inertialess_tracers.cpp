@@ -41,6 +41,7 @@
 
 #include <cstddef>
 #include <unordered_set>
+#include <vector>
 
 void CoupleIBMParticleToFluid(Particle const &p, Utils::Vector3d const &pos);
 void ParticleVelocitiesFromLB_CPU();
@@ -48,6 +49,26 @@ bool IsHalo(std::size_t indexCheck);
 
 static bool *isHaloCache = nullptr;
 
+/** Density and momentum density of the lattice nodes touched in the
+ *  current interpolation sweep. Tracer suspensions are dense, so
+ *  neighboring tracers share stencil nodes and the mode transform of
+ *  @ref lb_calc_modes only needs to run once per node and sweep instead
+ *  of once per node and particle.
+ */
+static std::vector<double> nodeDensityCache;
+static std::vector<Utils::Vector3d> nodeMomentumCache;
+static std::vector<char> nodeCacheValid;
+
+/** Invalidate the per-sweep node cache; the fluid changes between
+ *  sweeps.
+ */
+static void ResetNodeCache() {
+  auto const size = static_cast<std::size_t>(lblattice.halo_grid_volume);
+  nodeDensityCache.resize(size);
+  nodeMomentumCache.resize(size);
+  nodeCacheValid.assign(size, 0);
+}
+
 /** Put the calculated force stored on the ibm particles into the fluid by
  *  updating the @ref lbfields structure.
  *  Called from the integration loop right after the forces have been
@@ -178,14 +199,19 @@ Utils::Vector3d GetIBMInterpolatedVelocity(Utils::Vector3d const &pos) {
         } else
 #endif
         {
-          auto const modes = lb_calc_modes(static_cast<int>(index), lbfluid);
-          local_density = lbpar.density + modes[0];
+          if (!nodeCacheValid[index]) {
+            auto const modes = lb_calc_modes(static_cast<int>(index), lbfluid);
+            nodeDensityCache[index] = lbpar.density + modes[0];
+            nodeMomentumCache[index] = {modes[1], modes[2], modes[3]};
+            nodeCacheValid[index] = 1;
+          }
+          local_density = nodeDensityCache[index];
 
           if (ReturnVelocity) {
             // Add the +f/2 contribution!!
-            local_j[0] = modes[1] + f[0] / 2.;
-            local_j[1] = modes[2] + f[1] / 2.;
-            local_j[2] = modes[3] + f[2] / 2.;
+            local_j[0] = nodeMomentumCache[index][0] + f[0] / 2.;
+            local_j[1] = nodeMomentumCache[index][1] + f[1] / 2.;
+            local_j[2] = nodeMomentumCache[index][2] + f[2] / 2.;
           } else {
             // Keep track of the forces that we added to the fluid.
             // This is necessary for communication because this part is executed
@@ -259,6 +285,8 @@ inline bool in_local_domain(Utils::Vector3d const &pos, double halo = 0.) {
 void ParticleVelocitiesFromLB_CPU() {
   std::unordered_set<int> coupled_ghost_particles;
 
+  ResetNodeCache();
+
   // Loop over particles in local cells.
   // Here all contributions are included: velocity, external force and
   // particle force.
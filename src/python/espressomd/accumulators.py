@@ -64,6 +64,46 @@ class MeanVarianceCalculator(ScriptInterfaceHelper):
         return np.array(self.call_method("std_error")).reshape(self.shape())
 
 
+@script_interface_register
+class TelemetryExporter(ScriptInterfaceHelper):
+
+    """
+    Exports observables to a file for external monitoring.
+
+    Every ``delta_N`` steps, the observables are evaluated and their
+    values written to ``file_path`` in the Prometheus text exposition
+    format, one gauge per scalar. The file is replaced atomically, so
+    it can be scraped at any time, e.g. by the Prometheus node_exporter
+    textfile collector, without going through the Python loop.
+
+    Parameters
+    ----------
+    obs : list of :class:`espressomd.observables.Observable`
+        Observables to export.
+    names : list of :obj:`str`
+        Metric name for each observable.
+    file_path : :obj:`str`
+        File to publish the metrics to.
+    delta_N : :obj:`int`
+        Number of timesteps between subsequent samples for the auto update mechanism.
+
+    Methods
+    -------
+    update()
+        Evaluate the observables and rewrite the exported file.
+    last_values()
+        Return the values published by the last update.
+
+    """
+    _so_name = "Accumulators::TelemetryExporter"
+    _so_bind_methods = (
+        "update",
+        "shape",
+        "last_values",
+    )
+    _so_creation_policy = "LOCAL"
+
+
 @script_interface_register
 class TimeSeries(ScriptInterfaceHelper):
 
@@ -75,6 +115,15 @@ class TimeSeries(ScriptInterfaceHelper):
     obs : :class:`espressomd.observables.Observable`
     delta_N : :obj:`int`
         Number of timesteps between subsequent samples for the auto update mechanism.
+    file_path : :obj:`str`, optional
+        Path of a scratch file the series is spilled to in chunks. When
+        set, at most ``chunk_size`` samples are kept in memory; older
+        samples are appended to the file and read back on demand, so the
+        resident memory stays bounded for arbitrarily long runs. The
+        file is removed by ``clear()``.
+    chunk_size : :obj:`int`, optional
+        Number of resident samples that triggers a spill to
+        ``file_path``.
 
     Methods
     -------
@@ -92,11 +141,36 @@ class TimeSeries(ScriptInterfaceHelper):
     )
     _so_creation_policy = "LOCAL"
 
-    def time_series(self):
+    def n_samples(self):
+        """
+        Returns the total number of recorded samples, including samples
+        spilled to ``file_path``.
+        """
+        return self.call_method("n_samples")
+
+    def time_series(self, first=None, last=None):
         """
-        Returns the recorded values of the observable.
+        Returns the recorded values of the observable. With spilling
+        enabled, ``first`` and ``last`` can be used to retrieve a window
+        of samples without loading the entire series into memory.
+
+        Parameters
+        ----------
+        first : :obj:`int`, optional
+            Index of the first sample to return (default: ``0``).
+        last : :obj:`int`, optional
+            Index one past the last sample to return (default:
+            ``n_samples()``).
         """
-        return np.array(self.call_method("time_series")).reshape(self.shape())
+        kwargs = {}
+        if first is not None:
+            kwargs["first"] = first
+        if last is not None:
+            kwargs["last"] = last
+        series = np.array(self.call_method("time_series", **kwargs))
+        shape = self.shape()
+        shape[0] = len(series)
+        return series.reshape(shape)
 
 
 @script_interface_register
@@ -115,6 +115,10 @@ class CellSystem(ScriptInterfaceHelper):
         use_verlet_lists : :obj:`bool`, optional
             Activates or deactivates the usage of Verlet lists.
             Defaults to ``True``.
+        use_incremental_verlet_lists : :obj:`bool`, optional
+            Rebuild Verlet lists incrementally after a local resort,
+            re-pairing only cells whose contents moved beyond half the
+            skin. Defaults to ``False``.
 
         """
         self.call_method("initialize", name="regular_decomposition", **kwargs)
@@ -208,6 +212,36 @@ class CellSystem(ScriptInterfaceHelper):
         return self.call_method(
             "get_neighbors", distance=distance, pid=particle.id)
 
+    def resolve_overlaps(self, diameter, max_iterations=100):
+        """
+        Resolve hard-sphere overlaps geometrically.
+
+        Detects pairs of particles closer than ``diameter`` and pushes
+        them apart to contact distance, without evaluating any
+        interaction potential. The pass is repeated until no overlaps
+        remain or ``max_iterations`` is reached. This removes overlaps
+        from a random initial configuration much faster than capped
+        steepest descent. Forces are invalidated and recalculated on
+        the next integration.
+
+        Parameters
+        ----------
+        diameter : :obj:`float`
+            Center-to-center distance below which two particles count
+            as overlapping. Must be smaller than the maximal
+            interaction range supported by the cell system.
+        max_iterations : :obj:`int`, optional
+            Maximal number of correction sweeps. Defaults to 100.
+
+        Returns
+        -------
+        :obj:`int` :
+            The number of correction sweeps performed.
+
+        """
+        return self.call_method("resolve_overlaps", diameter=diameter,
+                                max_iterations=max_iterations)
+
     def non_bonded_loop_trace(self):
         pairs = self.call_method("non_bonded_loop_trace")
         res = []
@@ -70,6 +70,7 @@ IF ELECTROKINETICS and CUDA:
                 float ext_force_density[3][MAX_NUMBER_OF_SPECIES]
                 char * node_is_catalyst
                 bool es_coupling
+                int es_scheme
                 float * charge_potential_buffer
                 float * electric_field
         ELSE:
@@ -118,6 +119,7 @@ IF ELECTROKINETICS and CUDA:
                 float ext_force_density[3][MAX_NUMBER_OF_SPECIES]
                 char * node_is_catalyst
                 bool es_coupling
+                int es_scheme
                 float * charge_potential_buffer
                 float * electric_field
 
@@ -156,6 +158,7 @@ IF ELECTROKINETICS and CUDA:
         void ek_set_fluctuation_amplitude(float fluctuation_amplitude) except +
         void ek_set_fluidcoupling(bool ideal_contribution) except +
         void ek_set_electrostatics_coupling(bool electrostatics_coupling) except +
+        void ek_set_electrostatics_scheme(int scheme) except +
         int ek_node_get_density(int species, int x, int y, int z, double * density)
         int ek_node_get_flux(int species, int x, int y, int z, double * flux)
         int ek_node_get_potential(int x, int y, int z, double * potential)
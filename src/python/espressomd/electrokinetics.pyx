@@ -54,6 +54,11 @@ IF ELECTROKINETICS:
                 raise ValueError(
                     "fluid_coupling has to be 'friction' or 'estatics'.")
 
+            if self._params["electrostatics_scheme"] not in [
+                    "fft", "multigrid"]:
+                raise ValueError(
+                    "electrostatics_scheme has to be 'fft' or 'multigrid'.")
+
         def valid_keys(self):
             """
             Returns the valid options used for the electrokinetic method.
@@ -63,7 +68,7 @@ IF ELECTROKINETICS:
                     "bulk_viscosity", "gamma_even", "gamma_odd", "T", "ext_force_density",
                     "prefactor", "stencil", "advection", "fluid_coupling",
                     "fluctuations", "fluctuation_amplitude", "es_coupling",
-                    "species"]
+                    "electrostatics_scheme", "species"]
 
         def required_keys(self):
             """
@@ -94,6 +99,7 @@ IF ELECTROKINETICS:
                     "fluctuations": False,
                     "fluctuation_amplitude": 0.0,
                     "es_coupling": False,
+                    "electrostatics_scheme": "fft",
                     "species": []}
 
         def _get_params_from_es_core(self):
@@ -109,6 +115,14 @@ IF ELECTROKINETICS:
             else:
                 fluid_coupling = "estatics"
 
+            if ek_parameters.es_scheme == 0:
+                electrostatics_scheme = "fft"
+            elif ek_parameters.es_scheme == 1:
+                electrostatics_scheme = "multigrid"
+            else:
+                raise RuntimeError(
+                    "Value of electrostatics_scheme could not be identified.")
+
             return {"agrid": ek_parameters.agrid,
                     "lb_density": ek_parameters.lb_density,
                     "viscosity": ek_parameters.viscosity,
@@ -125,7 +139,8 @@ IF ELECTROKINETICS:
                     "fluctuations": ek_parameters.fluctuations,
                     "fluctuation_amplitude":
                         ek_parameters.fluctuation_amplitude,
-                    "es_coupling": ek_parameters.es_coupling}
+                    "es_coupling": ek_parameters.es_coupling,
+                    "electrostatics_scheme": electrostatics_scheme}
 
         def _set_params_in_es_core(self):
             if self._params["stencil"] == "linkcentered":
@@ -155,6 +170,11 @@ IF ELECTROKINETICS:
             ek_set_fluctuation_amplitude(self._params["fluctuation_amplitude"])
             ek_set_electrostatics_coupling(self._params["es_coupling"])
 
+            if self._params["electrostatics_scheme"] == "fft":
+                ek_set_electrostatics_scheme(0)
+            elif self._params["electrostatics_scheme"] == "multigrid":
+                ek_set_electrostatics_scheme(1)
+
         def set_density(self, species=None, density=None, node=None):
             """
             Sets the density of a species at a specific node.
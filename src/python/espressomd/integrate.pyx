@@ -94,6 +94,26 @@ class IntegratorHandle(ScriptInterfaceHelper):
         """
         self.integrator = StokesianDynamics(**kwargs)
 
+    def get_verlet_drift(self):
+        """
+        Return the accumulated energy drift estimate of the conservation
+        watchdog. The estimate is accumulated by the velocity Verlet
+        kernels while a positive ``verlet_drift_tolerance`` is set; for a
+        conservative (NVE) run it stays bounded, and a growing value
+        indicates energy drift. It is meaningless when a thermostat adds
+        non-conservative forces.
+
+        """
+        return self.call_method("get_verlet_drift")
+
+    def reset_verlet_drift(self):
+        """
+        Restart the energy drift accumulation of the conservation
+        watchdog from zero.
+
+        """
+        self.call_method("reset_verlet_drift")
+
 
 class Integrator(ScriptInterfaceHelper):
     """
@@ -216,6 +236,12 @@ class VelocityVerletIsotropicNPT(Integrator):
         If ``True``, a cubic box is assumed and the value of ``direction``
         will be ignored when rescaling the box. This is required e.g. for
         electrostatics and magnetostatics. Default is ``False``.
+    directional : :obj:`bool`, optional
+        If ``True``, every direction selected in ``direction`` gets its
+        own piston degree of freedom, so the box lengths fluctuate
+        independently under the same external pressure (orthorhombic
+        flexible-cell NpT). Incompatible with ``cubic_box`` and hence
+        with electrostatics and magnetostatics. Default is ``False``.
 
     """
     _so_name = "Integrators::VelocityVerletIsoNPT"
@@ -78,6 +78,8 @@ cdef extern from "grid_based_algorithms/lb_interface.hpp":
     void lb_lbfluid_print_boundary(string filename) except +
     void lb_lbfluid_save_checkpoint(string filename, bool binary) except +
     void lb_lbfluid_load_checkpoint(string filename, bool binary) except +
+    void lb_lbfluid_store_population_snapshot() except +
+    void lb_lbfluid_restore_population_snapshot() except +
     void lb_lbfluid_set_lattice_switch(ActiveLB local_lattice_switch) except +
     Vector6d lb_lbfluid_get_pressure_tensor() except +
     bool lb_lbnode_is_index_valid(const Vector3i & ind) except +
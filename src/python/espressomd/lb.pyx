@@ -442,6 +442,24 @@ cdef class HydrodynamicInteraction(FluidActor):
         '''
         lb_lbfluid_load_checkpoint(utils.to_char_pointer(path), binary)
 
+    def store_population_snapshot(self):
+        '''
+        Store the LB node populations in an in-memory snapshot.
+        The snapshot stays in memory instead of being written to a file,
+        which makes it cheap enough for protocols that roll the fluid
+        back repeatedly.
+        '''
+        lb_lbfluid_store_population_snapshot()
+
+    def restore_population_snapshot(self):
+        '''
+        Restore the LB node populations from the in-memory snapshot.
+        The snapshot must have been taken with the current lattice by
+        :meth:`store_population_snapshot`.
+        '''
+        lb_lbfluid_restore_population_snapshot()
+        utils.handle_errors("LB population snapshot restore")
+
     def _activate_method(self):
         raise Exception(
             "Subclasses of HydrodynamicInteraction have to implement _activate_method.")
@@ -1118,10 +1118,26 @@ class ParticleList(ScriptInterfaceHelper):
             first_id = self.highest_particle_id + 1
             p_list_dict["id"] = np.arange(first_id, first_id + n_parts)
 
-        # Place the particles
+        # Place the particles in one batch
+        particles = []
+        bonds = {}
         for i in range(n_parts):
             p_dict = {k: v[i] for k, v in p_list_dict.items()}
-            self._place_new_particle(p_dict)
+            if "bonds" in p_dict:
+                p_bonds = p_dict.pop("bonds")
+                if nesting_level(p_bonds) == 1:
+                    p_bonds = [p_bonds]
+                bonds[p_dict["id"]] = p_bonds
+            particles.append(p_dict)
+        self.call_method("add_particles", particles=particles)
+
+        # Add the bonds
+        for p_id, p_bonds in bonds.items():
+            p = self.by_id(p_id)
+            for bond in p_bonds:
+                if len(bond):
+                    bond = p.normalize_and_check_bond_or_throw_exception(bond)
+                    p.add_verified_bond(bond)
 
         # Return slice of added particles
         return self.by_ids(p_list_dict["id"])
@@ -1337,6 +1353,19 @@ def _add_particle_slice_properties():
 
             return
 
+        elif attribute in ("v", "ext_force"):
+            # vectorial quantities with a core-side bulk setter
+            values = np.asarray(values, dtype=float)
+            if values.shape == (3,):
+                values = np.tile(values, (N, 1))
+            elif values.shape != (N, 3):
+                raise Exception(
+                    f"Value shape {np.shape(values)} does not broadcast to attribute shape (3,).")
+            particle_slice.call_method(
+                "set_particles_property", name=attribute,
+                p_ids=particle_slice.id_selection, values=values.tolist())
+            return
+
         else:
             target = getattr(
                 ParticleHandle(id=particle_slice.id_selection[0]), attribute)
@@ -1384,7 +1413,11 @@ def _add_particle_slice_properties():
         else:  # scalar quantity
             target_type = type(target)
 
-        if attribute in ["exclusions", "bonds", "vs_relative", "swimming"]:
+        if attribute == "pos":
+            # fetch the whole selection in one call into a flat buffer
+            values = np.reshape(
+                particle_slice.call_method("get_particles_pos"), (N, 3))
+        elif attribute in ["exclusions", "bonds", "vs_relative", "swimming"]:
             values = []
             for part in particle_slice._id_gen():
                 values.append(getattr(part, attribute))
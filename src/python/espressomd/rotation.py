@@ -136,3 +136,48 @@ def diagonalized_inertia_tensor(positions, masses):
     if not np.allclose(np.cross(eigv[0], eigv[1]), eigv[2]):
         eigv[[0, 1], :] = eigv[[1, 0], :]
     return eig, eigv
+
+
+def setup_rigid_body(system, particles, **center_kwargs):
+    """
+    Set up a rigid body from existing particles.
+
+    The total mass, the principal moments of inertia and the body-frame
+    orientation are computed once from the mass distribution of
+    ``particles``. A center particle carrying these properties is added
+    at the center of mass and all ``particles`` are related to it as
+    virtual sites, so the body is propagated by the rotational
+    integrator through the center particle alone.
+
+    Requires features ``MASS``, ``ROTATION``, ``ROTATIONAL_INERTIA``
+    and ``VIRTUAL_SITES_RELATIVE``.
+
+    Parameters
+    ----------
+    system : :class:`espressomd.system.System`
+        System the particles belong to.
+    particles : iterable of :class:`~espressomd.particle_data.ParticleHandle`
+        Particles that make up the rigid body.
+    \\*\\*center_kwargs
+        Additional properties of the center particle, forwarded to
+        :meth:`~espressomd.particle_data.ParticleList.add`.
+
+    Returns
+    -------
+    :class:`~espressomd.particle_data.ParticleHandle`
+        The center particle.
+
+    """
+    particles = list(particles)
+    positions = np.array([p.pos for p in particles])
+    masses = np.array([p.mass for p in particles])
+    center_of_mass = np.average(positions, axis=0, weights=masses)
+    principal_moments, principal_axes = diagonalized_inertia_tensor(
+        positions, masses)
+    center = system.part.add(
+        pos=center_of_mass, mass=np.sum(masses), rinertia=principal_moments,
+        rotation=3 * [True], quat=matrix_to_quat(principal_axes),
+        **center_kwargs)
+    for p in particles:
+        p.vs_auto_relate_to(center.id)
+    return center
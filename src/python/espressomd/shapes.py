@@ -200,6 +200,33 @@ class Wall(Shape, ScriptInterfaceHelper):
     _so_name = "Shapes::Wall"
 
 
+@script_interface_register
+class SignedDistanceField(Shape, ScriptInterfaceHelper):
+    """
+    Precomputed signed distance field of another shape.
+
+    The distance function of ``inner_shape`` is sampled on a regular
+    grid at construction. Distance queries inside the gridded region
+    are answered by trilinear interpolation in constant time regardless
+    of the complexity of the wrapped shape, with an interpolation error
+    that is second order in the grid spacing; queries outside the
+    region are forwarded to the wrapped shape.
+
+    Attributes
+    ----------
+    inner_shape: :class:`Shape`
+        Shape to rasterize.
+    origin: (3,) array_like of :obj:`float`
+        Lower corner of the gridded region.
+    lengths: (3,) array_like of :obj:`float`
+        Edge lengths of the gridded region.
+    resolution: (3,) array_like of :obj:`int`
+        Number of grid cells in each direction.
+
+    """
+    _so_name = "Shapes::SignedDistanceField"
+
+
 @script_interface_register
 class SimplePore(Shape, ScriptInterfaceHelper):
     """
@@ -266,10 +293,20 @@ class Union(Shape, ScriptObjectList):
         Number of shapes contained in the union.
     clear()
         Remove all shapes from the union.
+    build_grid()
+        Build a voxel acceleration grid over the region given by
+        ``origin``, ``lengths`` and ``resolution``. Distance queries
+        inside the region then only evaluate the shapes that can be
+        nearest in the respective voxel instead of all shapes; results
+        are identical to the exhaustive scan. The grid is discarded
+        when a shape is added or removed.
+    clear_grid()
+        Discard the acceleration grid.
 
     """
     _so_name = "Shapes::Union"
-    _so_bind_methods = Shape._so_bind_methods + ("size", "empty", "clear")
+    _so_bind_methods = Shape._so_bind_methods + \
+        ("size", "empty", "clear", "build_grid", "clear_grid")
 
     def add(self, shape):
         """
@@ -184,7 +184,8 @@ class System(ScriptInterfaceHelper):
             raise ValueError("Required argument 'box_l' not provided.")
 
         setable_properties = ["box_l", "min_global_cut", "periodicity", "time",
-                              "time_step", "force_cap", "max_oif_objects"]
+                              "time_step", "force_cap", "max_oif_objects",
+                              "deterministic_reductions"]
         if has_features("VIRTUAL_SITES"):
             setable_properties.append("_active_virtual_sites_handle")
 
@@ -306,6 +307,23 @@ class System(ScriptInterfaceHelper):
     def min_global_cut(self, value):
         self._globals.min_global_cut = value
 
+    @property
+    def deterministic_reductions(self):
+        """
+        If ``True``, parallel reductions of forces and observables use a
+        fixed summation order, so results are bitwise reproducible
+        between runs with the same number of MPI ranks, at a small
+        communication overhead.
+
+        Type: :obj:`bool`
+
+        """
+        return self._globals.deterministic_reductions
+
+    @deterministic_reductions.setter
+    def deterministic_reductions(self, value):
+        self._globals.deterministic_reductions = value
+
     @property
     def force_cap(self):
         """
@@ -61,6 +61,18 @@ namespace ScriptInterface {
  * ranks. The lifetime of the copies is tied to the original,
  * if the original copy is destroyed on the head node,
  * the remote copies are also destroyed.
+ *
+ * Every notification is dispatched as its own synchronous broadcast,
+ * which makes large setup scripts latency-bound at high rank counts.
+ * Queueing notifications into one packed transaction would amortize
+ * that, but it is not a transport-level change: methods return values
+ * and errors that the caller consumes immediately (see
+ * @ref ParallelExceptionHandler, which relies on all ranks reaching
+ * the same failure point together), and object construction hands out
+ * ids that later calls in the same script refer to. Deferred
+ * application is therefore only possible for the subset of operations
+ * with no observable result, which would need to be declared per
+ * method before a flush boundary can be introduced.
  */
 class GlobalContext : public Context {
   using ObjectId = std::size_t;
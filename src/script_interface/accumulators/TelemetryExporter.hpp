@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCRIPT_INTERFACE_ACCUMULATORS_TELEMETRY_EXPORTER_HPP
+#define SCRIPT_INTERFACE_ACCUMULATORS_TELEMETRY_EXPORTER_HPP
+
+#include "AccumulatorBase.hpp"
+#include "core/accumulators/TelemetryExporter.hpp"
+#include "script_interface/ScriptInterface.hpp"
+#include "script_interface/observables/Observable.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ScriptInterface {
+namespace Accumulators {
+
+class TelemetryExporter : public AccumulatorBase {
+public:
+  TelemetryExporter() {
+    add_parameters(
+        {{"obs", AutoParameter::read_only,
+          [this]() { return make_vector_of_variants(m_obs); }},
+         {"names", AutoParameter::read_only,
+          [this]() { return make_vector_of_variants(m_names); }},
+         {"file_path", AutoParameter::read_only,
+          [this]() { return m_file_path; }}});
+  }
+
+  void do_construct(VariantMap const &params) override {
+    m_obs = get_value<std::vector<std::shared_ptr<Observables::Observable>>>(
+        params, "obs");
+    m_names = get_value<std::vector<std::string>>(params, "names");
+    m_file_path = get_value<std::string>(params, "file_path");
+
+    context()->parallel_try_catch([&]() {
+      if (m_names.size() != m_obs.size()) {
+        throw std::invalid_argument(
+            "Parameters 'obs' and 'names' must have the same length");
+      }
+    });
+
+    std::vector<std::shared_ptr<::Observables::Observable>> obs;
+    for (auto const &o : m_obs) {
+      obs.emplace_back(o->observable());
+    }
+    m_accumulator = std::make_shared<::Accumulators::TelemetryExporter>(
+        std::move(obs), m_names, get_value_or<int>(params, "delta_N", 1),
+        m_file_path);
+  }
+
+  Variant do_call_method(std::string const &method,
+                         VariantMap const &parameters) override {
+    if (method == "update")
+      m_accumulator->update();
+    if (method == "last_values")
+      return m_accumulator->last_values();
+    return AccumulatorBase::call_method(method, parameters);
+  }
+
+  std::shared_ptr<::Accumulators::AccumulatorBase> accumulator() override {
+    return m_accumulator;
+  }
+
+  std::shared_ptr<const ::Accumulators::AccumulatorBase>
+  accumulator() const override {
+    return std::static_pointer_cast<::Accumulators::AccumulatorBase>(
+        m_accumulator);
+  }
+
+private:
+  /* The actual accumulator */
+  std::shared_ptr<::Accumulators::TelemetryExporter> m_accumulator;
+  std::vector<std::shared_ptr<Observables::Observable>> m_obs;
+  std::vector<std::string> m_names;
+  std::string m_file_path;
+};
+
+} // namespace Accumulators
+} /* namespace ScriptInterface */
+
+#endif
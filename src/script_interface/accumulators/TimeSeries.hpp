@@ -26,6 +26,7 @@
 
 #include <boost/range/algorithm/transform.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -36,14 +37,32 @@ namespace Accumulators {
 
 class TimeSeries : public AccumulatorBase {
 public:
-  TimeSeries() { add_parameters({{"obs", std::as_const(m_obs)}}); }
+  TimeSeries() {
+    add_parameters({{"obs", std::as_const(m_obs)},
+                    {"file_path", AutoParameter::read_only,
+                     [this]() { return m_file_path; }},
+                    {"chunk_size", AutoParameter::read_only,
+                     [this]() { return m_chunk_size; }}});
+  }
 
   void do_construct(VariantMap const &params) override {
     set_from_args(m_obs, params, "obs");
-
-    if (m_obs)
-      m_accumulator = std::make_shared<::Accumulators::TimeSeries>(
-          m_obs->observable(), get_value_or<int>(params, "delta_N", 1));
+    m_file_path = get_value_or<std::string>(params, "file_path", "");
+    m_chunk_size = get_value_or<int>(params, "chunk_size", 0);
+
+    if (m_obs) {
+      auto const delta_N = get_value_or<int>(params, "delta_N", 1);
+      if (m_file_path.empty()) {
+        m_accumulator = std::make_shared<::Accumulators::TimeSeries>(
+            m_obs->observable(), delta_N);
+      } else {
+        context()->parallel_try_catch([this, delta_N]() {
+          m_accumulator = std::make_shared<::Accumulators::TimeSeries>(
+              m_obs->observable(), delta_N, m_file_path,
+              static_cast<std::size_t>(m_chunk_size));
+        });
+      }
+    }
   }
 
   Variant do_call_method(std::string const &method,
@@ -51,8 +70,18 @@ public:
     if (method == "update") {
       m_accumulator->update();
     }
+    if (method == "n_samples") {
+      return static_cast<int>(m_accumulator->n_samples());
+    }
     if (method == "time_series") {
-      auto const &series = m_accumulator->time_series();
+      auto const first = static_cast<std::size_t>(
+          get_value_or<int>(parameters, "first", 0));
+      auto const last = static_cast<std::size_t>(get_value_or<int>(
+          parameters, "last", static_cast<int>(m_accumulator->n_samples())));
+      std::vector<std::vector<double>> series;
+      context()->parallel_try_catch([this, &series, first, last]() {
+        series = m_accumulator->get_range(first, last);
+      });
       std::vector<Variant> ret(series.size());
 
       boost::transform(
@@ -82,6 +111,8 @@ private:
   /* The actual accumulator */
   std::shared_ptr<::Accumulators::TimeSeries> m_accumulator;
   std::shared_ptr<Observables::Observable> m_obs;
+  std::string m_file_path;
+  int m_chunk_size;
 
   std::string get_internal_state() const override {
     return m_accumulator->get_internal_state();
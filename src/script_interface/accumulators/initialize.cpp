@@ -20,6 +20,7 @@
 #include "AutoUpdateAccumulators.hpp"
 #include "Correlator.hpp"
 #include "MeanVarianceCalculator.hpp"
+#include "TelemetryExporter.hpp"
 #include "TimeSeries.hpp"
 
 namespace ScriptInterface {
@@ -32,6 +33,8 @@ void initialize(Utils::Factory<ObjectHandle> *om) {
   om->register_new<MeanVarianceCalculator>(
       "Accumulators::MeanVarianceCalculator");
 
+  om->register_new<TelemetryExporter>("Accumulators::TelemetryExporter");
+
   om->register_new<TimeSeries>("Accumulators::TimeSeries");
 
   om->register_new<Correlator>("Accumulators::Correlator");
@@ -35,7 +35,9 @@
 #include <utils/Vector.hpp>
 #include <utils/mpi/gather_buffer.hpp>
 
+#include <boost/mpi/collectives/all_reduce.hpp>
 #include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/operations.hpp>
 #include <boost/variant.hpp>
 
 #include <algorithm>
@@ -64,6 +66,19 @@ static auto const &get_hybrid_decomposition() {
 CellSystem::CellSystem() {
   add_parameters({
       {"use_verlet_lists", ::cell_structure.use_verlet_list},
+      {"use_incremental_verlet_lists",
+       ::cell_structure.use_incremental_verlet_lists},
+      {"use_spatial_particle_sorting",
+       ::cell_structure.use_spatial_particle_sorting},
+      {"use_bond_batches", ::cell_structure.use_bond_batches},
+      {"fetch_bond_partners",
+       [](Variant const &v) {
+         ::cell_structure.fetch_bond_partners = get_value<bool>(v);
+         /* The flag changes the interaction range, so the cell system
+          * has to be rebuilt. */
+         on_short_range_ia_change();
+       },
+       []() { return ::cell_structure.fetch_bond_partners; }},
       {"node_grid",
        [this](Variant const &v) {
          context()->parallel_try_catch([&v]() {
@@ -147,6 +162,14 @@ Variant CellSystem::do_call_method(std::string const &name,
       auto const rd = get_regular_decomposition();
       state["cell_grid"] = Variant{rd.cell_grid};
       state["cell_size"] = Variant{rd.cell_size};
+      /* The domain is split evenly by the node grid, so non-uniform
+       * particle densities show up as per-rank load imbalance. Report
+       * the counts so users can pick a better node grid. */
+      auto const n_local =
+          static_cast<int>(::cell_structure.local_particles().size());
+      std::vector<int> parts_per_node;
+      boost::mpi::gather(context()->get_comm(), n_local, parts_per_node, 0);
+      state["particles_per_node"] = Variant{parts_per_node};
     } else if (cs_type == CellStructureType::CELL_STRUCTURE_HYBRID) {
       auto const hd = get_hybrid_decomposition();
       state["cell_grid"] = Variant{hd.get_cell_grid()};
@@ -233,6 +256,25 @@ Variant CellSystem::do_call_method(std::string const &name,
   if (name == "get_max_range") {
     return ::cell_structure.max_range();
   }
+  if (name == "resolve_overlaps") {
+    auto iterations = 0;
+    context()->parallel_try_catch([this, &iterations, &params]() {
+      iterations = resolve_overlaps(get_value<double>(params, "diameter"),
+                                    get_value<int>(params, "max_iterations"));
+    });
+    return iterations;
+  }
+  if (name == "suggest_n_square_types") {
+    auto const cutoff_regular = get_value<double>(params, "cutoff_regular");
+    maximal_cutoff_nonbonded(); // refresh cached per-pair cutoffs
+    return long_range_particle_types(cutoff_regular);
+  }
+  if (name == "predict_optimal_skin") {
+    auto const target_reuse = get_value<double>(params, "target_reuse");
+    auto const local = predict_skin_for_reuse(target_reuse);
+    return boost::mpi::all_reduce(context()->get_comm(), local,
+                                  boost::mpi::maximum<double>());
+  }
   return {};
 }
 
@@ -249,6 +291,12 @@ void CellSystem::initialize(CellStructureType const &cs_type,
                             VariantMap const &params) const {
   auto const verlet = get_value_or<bool>(params, "use_verlet_lists", true);
   ::cell_structure.use_verlet_list = verlet;
+  ::cell_structure.use_incremental_verlet_lists =
+      get_value_or<bool>(params, "use_incremental_verlet_lists", false);
+  ::cell_structure.use_bond_batches =
+      get_value_or<bool>(params, "use_bond_batches", false);
+  ::cell_structure.fetch_bond_partners =
+      get_value_or<bool>(params, "fetch_bond_partners", false);
   if (cs_type == CellStructureType::CELL_STRUCTURE_HYBRID) {
     auto const cutoff_regular = get_value<double>(params, "cutoff_regular");
     auto const ns_types =
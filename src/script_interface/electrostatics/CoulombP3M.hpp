@@ -27,11 +27,15 @@
 #include "Actor.hpp"
 
 #include "core/electrostatics/p3m.hpp"
+#include "core/p3m/TuningAlgorithm.hpp"
 
 #include "script_interface/get_value.hpp"
 
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ScriptInterface {
 namespace Coulomb {
@@ -74,6 +78,27 @@ public:
     });
   }
 
+  Variant do_call_method(std::string const &name,
+                         VariantMap const &params) override {
+    if (name == "tuning_candidates") {
+      /* parameter sets benchmarked during the last tuning run; the
+       * (accuracy, time) Pareto frontier of this list allows picking
+       * cheaper parameter sets for lower accuracy requirements
+       * without re-tuning */
+      std::vector<Variant> candidates{};
+      for (auto const &c : last_tuning_candidates()) {
+        std::unordered_map<std::string, Variant> row = {
+            {"mesh", c.mesh},         {"cao", c.cao},
+            {"alpha_L", c.alpha_L},   {"r_cut_iL", c.r_cut_iL},
+            {"accuracy", c.accuracy}, {"time", c.time},
+        };
+        candidates.emplace_back(make_unordered_map_of_variants(row));
+      }
+      return candidates;
+    }
+    return Actor<CoulombP3M, ::CoulombP3M>::do_call_method(name, params);
+  }
+
   void do_construct(VariantMap const &params) override {
     m_tune = get_value<bool>(params, "tune");
     context()->parallel_try_catch([&]() {
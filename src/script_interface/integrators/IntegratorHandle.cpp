@@ -79,9 +79,27 @@ IntegratorHandle::IntegratorHandle() {
       {"force_cap",
        [](Variant const &v) { set_force_cap(get_value<double>(v)); },
        []() { return get_force_cap(); }},
+      {"verlet_drift_tolerance",
+       [this](Variant const &v) {
+         context()->parallel_try_catch(
+             [&]() { set_verlet_drift_tolerance(get_value<double>(v)); });
+       },
+       []() { return ::verlet_drift_tolerance; }},
   });
 }
 
+Variant IntegratorHandle::do_call_method(std::string const &name,
+                                         VariantMap const &) {
+  if (name == "get_verlet_drift") {
+    return get_verlet_drift();
+  }
+  if (name == "reset_verlet_drift") {
+    reset_verlet_drift();
+    return {};
+  }
+  return {};
+}
+
 static bool checkpoint_filter(typename VariantMap::value_type const &kv) {
   /* When loading from a checkpoint file, defer the integrator object to last,
    * and skip the time_step if it is -1 to avoid triggering sanity checks.
@@ -38,6 +38,9 @@ public:
   IntegratorHandle();
 
   void do_construct(VariantMap const &params) override;
+
+  Variant do_call_method(std::string const &name,
+                         VariantMap const &params) override;
 };
 
 } // namespace Integrators
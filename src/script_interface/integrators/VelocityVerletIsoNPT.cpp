@@ -47,6 +47,8 @@ VelocityVerletIsoNPT::VelocityVerletIsoNPT() {
        [this]() { return get_instance().get_direction(); }},
       {"cubic_box", AutoParameter::read_only,
        [this]() { return get_instance().cubic_box; }},
+      {"directional", AutoParameter::read_only,
+       [this]() { return get_instance().directional; }},
   });
 }
 
@@ -56,10 +58,11 @@ void VelocityVerletIsoNPT::do_construct(VariantMap const &params) {
   auto const cubic_box = get_value_or<bool>(params, "cubic_box", false);
   auto const direction = get_value_or<Utils::Vector3b>(
       params, "direction", Utils::Vector3b::broadcast(true));
+  auto const directional = get_value_or<bool>(params, "directional", false);
 
   context()->parallel_try_catch([&]() {
-    m_instance = std::make_shared<::NptIsoParameters>(ext_pressure, piston,
-                                                      direction, cubic_box);
+    m_instance = std::make_shared<::NptIsoParameters>(
+        ext_pressure, piston, direction, cubic_box, directional);
   });
 }
 
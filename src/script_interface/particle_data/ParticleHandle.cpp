@@ -155,6 +155,21 @@ void ParticleHandle::set_particle_property(T &(Particle::*setter)(),
       [&value, setter](Particle &p) { (p.*setter)() = get_value<T>(value); });
 }
 
+/** Like @ref set_particle_property, but for properties that enter the
+ *  force calculation without affecting the interaction topology or the
+ *  charge bookkeeping, so the cheaper particle event suffices.
+ */
+template <typename T>
+void ParticleHandle::set_particle_force_property(T &(Particle::*setter)(),
+                                                 Variant const &value) const {
+  auto const &comm = context()->get_comm();
+  auto const ptr = get_real_particle(comm, m_pid);
+  if (ptr != nullptr) {
+    (ptr->*setter)() = get_value<T>(value);
+  }
+  on_particle_force_change();
+}
+
 ParticleHandle::ParticleHandle() {
   add_parameters({
       {"id", AutoParameter::read_only, [this]() { return m_pid; }},
@@ -183,12 +198,12 @@ ParticleHandle::ParticleHandle() {
        }},
       {"v",
        [this](Variant const &value) {
-         set_particle_property(&Particle::v, value);
+         set_particle_force_property(&Particle::v, value);
        },
        [this]() { return get_particle_data(m_pid).v(); }},
       {"f",
        [this](Variant const &value) {
-         set_particle_property(&Particle::force, value);
+         set_particle_force_property(&Particle::force, value);
        },
        [this]() { return get_particle_data(m_pid).force(); }},
       {"mass",
@@ -340,13 +355,13 @@ ParticleHandle::ParticleHandle() {
        }},
       {"ext_force",
        [this](Variant const &value) {
-         set_particle_property(&Particle::ext_force, value);
+         set_particle_force_property(&Particle::ext_force, value);
        },
        [this]() { return get_particle_data(m_pid).ext_force(); }},
 #ifdef ROTATION
       {"ext_torque",
        [this](Variant const &value) {
-         set_particle_property(&Particle::ext_torque, value);
+         set_particle_force_property(&Particle::ext_torque, value);
        },
        [this]() { return get_particle_data(m_pid).ext_torque(); }},
 #endif // ROTATION
@@ -730,14 +745,19 @@ void ParticleHandle::do_construct(VariantMap const &params) {
   }
 
   auto const pos = get_value<Utils::Vector3d>(params, "pos");
-  context()->parallel_try_catch([&]() {
-    particle_checks(m_pid, pos);
-    auto ptr = ::cell_structure.get_local_particle(m_pid);
-    if (ptr != nullptr) {
-      throw std::invalid_argument("Particle " + std::to_string(m_pid) +
-                                  " already exists");
-    }
-  });
+  // during batch creation, the particle has already been checked and
+  // inserted by ParticleList
+  auto const batch_created = has_param("__batch_sentinel");
+  if (not batch_created) {
+    context()->parallel_try_catch([&]() {
+      particle_checks(m_pid, pos);
+      auto ptr = ::cell_structure.get_local_particle(m_pid);
+      if (ptr != nullptr) {
+        throw std::invalid_argument("Particle " + std::to_string(m_pid) +
+                                    " already exists");
+      }
+    });
+  }
 
 #ifdef ROTATION
   context()->parallel_try_catch([&]() {
@@ -757,13 +777,16 @@ void ParticleHandle::do_construct(VariantMap const &params) {
 #endif // ROTATION
 
   // create a default-constructed particle
-  make_new_particle(m_pid, pos);
+  if (not batch_created) {
+    make_new_particle(m_pid, pos);
+  }
 
   context()->parallel_try_catch([&]() {
     // set particle properties (filter out read-only and deferred properties)
     std::set<std::string> const skip = {
         "pos_folded", "pos", "quat", "director",  "id",    "lees_edwards_flag",
         "exclusions", "dip", "node", "image_box", "bonds", "__cpt_sentinel",
+        "__batch_sentinel",
     };
 #ifdef ROTATION
     // multiple parameters can potentially set the quaternion, but only one
@@ -42,6 +42,10 @@ class ParticleHandle : public AutoParameters<ParticleHandle> {
                              Variant const &value) const;
 
   template <class F> void set_particle_property(F const &fun) const;
+
+  template <typename T>
+  void set_particle_force_property(T &(Particle::*setter)(),
+                                   Variant const &value) const;
 #ifdef EXCLUSIONS
   void particle_exclusion_sanity_checks(int pid1, int pid2) const;
 #endif // EXCLUSIONS
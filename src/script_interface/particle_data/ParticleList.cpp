@@ -36,7 +36,11 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/range/algorithm.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <memory>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -151,44 +155,43 @@ static void auto_exclusions(boost::mpi::communicator const &comm,
   Utils::Mpi::gather_buffer(bonded_pairs, comm);
 
   if (comm.rank() == 0) {
-    auto const add_partner = [&partners](int pid1, int pid2, int n_bonds) {
-      if (pid2 == pid1)
-        return;
-      for (auto const &partner : partners[pid1])
-        if (partner.first == pid2)
-          return;
-      partners[pid1].emplace_back(std::pair{pid2, n_bonds});
+    // adjacency list of the bond graph
+    std::unordered_map<int, std::vector<int>> neighbors;
+    auto const add_neighbor = [&neighbors](int pid1, int pid2) {
+      auto &list = neighbors[pid1];
+      if (std::find(list.begin(), list.end(), pid2) == list.end())
+        list.emplace_back(pid2);
     };
 
     for (auto it = bonded_pairs.begin(); it != bonded_pairs.end(); it += 2) {
-      add_partner(it[0], it[1], 1);
-      add_partner(it[1], it[0], 1);
+      add_neighbor(it[0], it[1]);
+      add_neighbor(it[1], it[0]);
     }
 
-    // determine transient connectivity
-    for (int iteration = 1; iteration < n_bonds_max; iteration++) {
-      std::vector<int> pids;
-      for (auto const &kv : partners) {
-        pids.emplace_back(kv.first);
-      }
-      for (auto const pid1 : pids) {
-        // loop over partners (counter-based loops due to iterator invalidation)
-        // NOLINTNEXTLINE(modernize-loop-convert)
-        for (int i = 0; i < partners[pid1].size(); ++i) {
-          auto const [pid2, dist21] = partners[pid1][i];
-          if (dist21 > n_bonds_max)
-            continue;
-          // loop over all partners of the partner
-          // NOLINTNEXTLINE(modernize-loop-convert)
-          for (int j = 0; j < partners[pid2].size(); ++j) {
-            auto const [pid3, dist32] = partners[pid2][j];
-            auto const dist31 = dist32 + dist21;
-            if (dist31 > n_bonds_max)
-              continue;
-            add_partner(pid1, pid3, dist31);
-            add_partner(pid3, pid1, dist31);
+    // determine transient connectivity with a breadth-first search of
+    // depth n_bonds_max from every particle; each particle is visited
+    // at most once per search, so the cost is independent of how many
+    // paths connect a pair of particles
+    for (auto const &kv : neighbors) {
+      auto const pid1 = kv.first;
+      std::unordered_map<int, int> distance{{pid1, 0}};
+      std::vector<int> frontier{pid1};
+      for (int n_bonds = 1; n_bonds <= n_bonds_max; n_bonds++) {
+        std::vector<int> next_frontier;
+        for (auto const pid2 : frontier) {
+          for (auto const pid3 : neighbors.at(pid2)) {
+            if (distance.insert({pid3, n_bonds}).second) {
+              next_frontier.emplace_back(pid3);
+            }
           }
         }
+        frontier = std::move(next_frontier);
+      }
+      auto &partner_list = partners[pid1];
+      for (auto const &[pid2, n_bonds] : distance) {
+        if (pid2 != pid1) {
+          partner_list.emplace_back(std::pair{pid2, n_bonds});
+        }
       }
     }
   }
@@ -227,6 +230,50 @@ Variant ParticleList::do_call_method(std::string const &name,
     remove_all_particles();
     return {};
   }
+  if (name == "add_particles") {
+    auto const batch = get_value<std::vector<Variant>>(params, "particles");
+    std::vector<VariantMap> all_params;
+    std::vector<int> p_ids;
+    std::vector<Utils::Vector3d> positions;
+    all_params.reserve(batch.size());
+    p_ids.reserve(batch.size());
+    positions.reserve(batch.size());
+    for (auto const &packed : batch) {
+      auto p_params = get_value<VariantMap>(packed);
+      assert(p_params.count("bonds") == 0);
+      p_ids.emplace_back(get_value<int>(p_params, "id"));
+      positions.emplace_back(get_value<Utils::Vector3d>(p_params, "pos"));
+      all_params.emplace_back(std::move(p_params));
+    }
+    context()->parallel_try_catch([&]() {
+      std::set<int> unique_ids;
+      for (std::size_t i = 0ul; i < p_ids.size(); ++i) {
+        particle_checks(p_ids[i], positions[i]);
+        if (::cell_structure.get_local_particle(p_ids[i]) != nullptr or
+            not unique_ids.insert(p_ids[i]).second) {
+          throw std::invalid_argument("Particle " + std::to_string(p_ids[i]) +
+                                      " already exists");
+        }
+      }
+    });
+    // insert the whole batch with a single round of collectives
+    make_new_particles(p_ids, positions);
+    // set the remaining particle properties
+    if (context()->is_head_node()) {
+      for (auto &p_params : all_params) {
+        p_params["__batch_sentinel"] = none;
+        auto obj =
+            context()->make_shared("Particles::ParticleHandle", p_params);
+#ifdef EXCLUSIONS
+        if (p_params.count("exclusions")) {
+          auto &p_handle = dynamic_cast<ParticleHandle &>(*obj);
+          set_exclusions(p_handle, p_params.at("exclusions"));
+        }
+#endif // EXCLUSIONS
+      }
+    }
+    return {};
+  }
   if (not context()->is_head_node()) {
     return {};
   }
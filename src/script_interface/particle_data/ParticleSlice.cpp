@@ -21,10 +21,17 @@
 
 #include "script_interface/ScriptInterface.hpp"
 
+#include "config/config.hpp"
+
+#include "core/grid.hpp"
 #include "core/particle_node.hpp"
 
 #include <utils/Span.hpp>
+#include <utils/Vector.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -43,6 +50,40 @@ Variant ParticleSlice::do_call_method(std::string const &name,
     prefetch_particle_data(Utils::Span<int>(p_ids));
   } else if (name == "particle_exists") {
     return particle_exists(get_value<int>(params, "p_id"));
+  } else if (name == "get_particles_pos") {
+    /* Fill one flat buffer for the whole selection, prefetching the
+     * remote particles in chunks, instead of one call per particle. */
+    std::vector<double> pos_flat;
+    pos_flat.reserve(3ul * m_id_selection.size());
+    for (std::size_t offset = 0ul; offset < m_id_selection.size();
+         offset += static_cast<std::size_t>(m_chunk_size)) {
+      auto const this_size =
+          std::min(static_cast<std::size_t>(m_chunk_size),
+                   m_id_selection.size() - offset);
+      prefetch_particle_data(
+          Utils::make_const_span(m_id_selection.data() + offset, this_size));
+      for (std::size_t i = offset; i < offset + this_size; ++i) {
+        auto const &p = get_particle_data(m_id_selection[i]);
+        auto const pos =
+            unfolded_position(p.pos(), p.image_box(), ::box_geo.length());
+        pos_flat.insert(pos_flat.end(), pos.begin(), pos.end());
+      }
+    }
+    return pos_flat;
+  } else if (name == "set_particles_property") {
+    auto const property = get_value<std::string>(params, "name");
+    auto const p_ids = get_value<std::vector<int>>(params, "p_ids");
+    auto const values =
+        get_value<std::vector<Utils::Vector3d>>(params, "values");
+    if (property == "v") {
+      set_particles_v(p_ids, values);
+#ifdef EXTERNAL_FORCES
+    } else if (property == "ext_force") {
+      set_particles_ext_force(p_ids, values);
+#endif // EXTERNAL_FORCES
+    } else {
+      throw std::invalid_argument("Unknown batch property '" + property + "'");
+    }
   }
   return {};
 }
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCRIPT_INTERFACE_SHAPES_SIGNED_DISTANCE_FIELD_HPP
+#define SCRIPT_INTERFACE_SHAPES_SIGNED_DISTANCE_FIELD_HPP
+
+#include "Shape.hpp"
+
+#include "script_interface/Context.hpp"
+
+#include <shapes/SignedDistanceField.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <memory>
+
+namespace ScriptInterface {
+namespace Shapes {
+
+class SignedDistanceField : public Shape {
+public:
+  SignedDistanceField()
+      : m_core_shape(std::make_shared<::Shapes::SignedDistanceField>()) {
+    add_parameters(
+        {{"inner_shape", AutoParameter::read_only,
+          [this]() { return m_inner_shape; }},
+         {"origin", AutoParameter::read_only, [this]() { return m_origin; }},
+         {"lengths", AutoParameter::read_only, [this]() { return m_lengths; }},
+         {"resolution", AutoParameter::read_only,
+          [this]() { return m_resolution; }}});
+  }
+
+  void do_construct(VariantMap const &params) override {
+    m_inner_shape =
+        get_value<std::shared_ptr<Shape>>(params, "inner_shape");
+    m_origin = get_value<Utils::Vector3d>(params, "origin");
+    m_lengths = get_value<Utils::Vector3d>(params, "lengths");
+    m_resolution = get_value<Utils::Vector3i>(params, "resolution");
+
+    context()->parallel_try_catch([&]() {
+      m_core_shape->rasterize(m_inner_shape->shape(), m_origin, m_lengths,
+                              m_resolution);
+    });
+  }
+
+  std::shared_ptr<::Shapes::Shape> shape() const override {
+    return m_core_shape;
+  }
+
+private:
+  std::shared_ptr<::Shapes::SignedDistanceField> m_core_shape;
+  std::shared_ptr<Shape> m_inner_shape;
+  Utils::Vector3d m_origin;
+  Utils::Vector3d m_lengths;
+  Utils::Vector3i m_resolution;
+};
+
+} /* namespace Shapes */
+} /* namespace ScriptInterface */
+
+#endif
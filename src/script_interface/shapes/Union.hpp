@@ -47,6 +47,24 @@ private:
   }
 
 public:
+  Variant do_call_method(std::string const &name,
+                         VariantMap const &params) override {
+    if (name == "build_grid") {
+      context()->parallel_try_catch([&]() {
+        m_core_shape->build_grid(
+            get_value<Utils::Vector3d>(params, "origin"),
+            get_value<Utils::Vector3d>(params, "lengths"),
+            get_value<Utils::Vector3i>(params, "resolution"));
+      });
+      return {};
+    }
+    if (name == "clear_grid") {
+      m_core_shape->clear_grid();
+      return {};
+    }
+    return ObjectList<Shape, Shape>::do_call_method(name, params);
+  }
+
   std::shared_ptr<::Shapes::Shape> shape() const override {
     return m_core_shape;
   }
@@ -22,6 +22,7 @@
 #include "HollowConicalFrustum.hpp"
 #include "NoWhere.hpp"
 #include "Rhomboid.hpp"
+#include "SignedDistanceField.hpp"
 #include "SimplePore.hpp"
 #include "Slitpore.hpp"
 #include "Sphere.hpp"
@@ -45,6 +46,7 @@ void initialize(Utils::Factory<ObjectHandle> *f) {
   f->register_new<SpheroCylinder>("Shapes::SpheroCylinder");
   f->register_new<Rhomboid>("Shapes::Rhomboid");
   f->register_new<Slitpore>("Shapes::Slitpore");
+  f->register_new<SignedDistanceField>("Shapes::SignedDistanceField");
   f->register_new<SimplePore>("Shapes::SimplePore");
   f->register_new<Torus>("Shapes::Torus");
 }
@@ -19,6 +19,7 @@
 
 #include "Globals.hpp"
 
+#include "core/communication.hpp"
 #include "core/event.hpp"
 #include "core/grid.hpp"
 #include "core/nonbonded_interactions/nonbonded_interaction_data.hpp"
@@ -74,6 +75,11 @@ Globals::Globals() {
              [&]() { set_periodicity(get_value<Utils::Vector3b>(v)); });
        },
        []() { return get_periodicity(); }},
+      {"deterministic_reductions",
+       [](Variant const &v) {
+         ::Communication::set_deterministic_reductions(get_value<bool>(v));
+       },
+       []() { return ::Communication::deterministic_reductions(); }},
   });
 }
 
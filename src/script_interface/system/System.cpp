@@ -24,6 +24,7 @@
 #include "core/cells.hpp"
 #include "core/event.hpp"
 #include "core/grid.hpp"
+#include "core/memory_stats.hpp"
 #include "core/object-in-fluid/oif_global_forces.hpp"
 #include "core/particle_node.hpp"
 #include "core/rotate_system.hpp"
@@ -31,6 +32,7 @@
 #include <utils/Vector.hpp>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ScriptInterface {
@@ -118,6 +120,20 @@ Variant System::do_call_method(std::string const &name,
     auto const pos2 = get_value<Utils::Vector3d>(parameters, "pos2");
     return ::box_geo.get_mi_vector(pos2, pos1);
   }
+  if (name == "memory_usage") {
+    /* the accounting is rank-local, but buffer resize events are
+     * collective, so the head node numbers are representative */
+    std::unordered_map<std::string, Variant> result;
+    for (auto const &kv : MemoryStats::usage()) {
+      result[kv.first] =
+          std::vector<Variant>{static_cast<double>(kv.second.current),
+                               static_cast<double>(kv.second.peak)};
+    }
+    return result;
+  }
+  if (name == "peak_memory") {
+    return static_cast<double>(MemoryStats::peak_total());
+  }
   if (name == "rotate_system") {
     rotate_system(get_value<double>(parameters, "phi"),
                   get_value<double>(parameters, "theta"),
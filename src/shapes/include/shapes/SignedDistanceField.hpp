@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SHAPES_SIGNED_DISTANCE_FIELD_HPP
+#define SHAPES_SIGNED_DISTANCE_FIELD_HPP
+
+#include "Shape.hpp"
+
+#include <utils/Vector.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Shapes {
+
+/**
+ * @brief Precomputed signed distance field of another shape.
+ *
+ * The distance function of the wrapped shape is sampled on a regular
+ * grid at setup. Queries inside the gridded region are answered by
+ * trilinear interpolation of the samples and the distance vector is
+ * reconstructed from the analytic gradient of the interpolant, so the
+ * cost per query is constant regardless of the complexity of the
+ * wrapped shape. The interpolation error is second order in the grid
+ * spacing away from sharp edges of the geometry; queries outside the
+ * gridded region are forwarded to the wrapped shape.
+ */
+class SignedDistanceField : public Shape {
+public:
+  /**
+   * @brief Sample the distance function of a shape on a regular grid.
+   *
+   * @param shape      Shape to rasterize.
+   * @param origin     Lower corner of the gridded region.
+   * @param lengths    Edge lengths of the gridded region.
+   * @param resolution Number of grid cells in each direction.
+   */
+  void rasterize(std::shared_ptr<Shapes::Shape> shape,
+                 Utils::Vector3d const &origin, Utils::Vector3d const &lengths,
+                 Utils::Vector3i const &resolution);
+
+  void calculate_dist(Utils::Vector3d const &pos, double &dist,
+                      Utils::Vector3d &vec) const override;
+
+  bool is_inside(Utils::Vector3d const &pos) const override;
+
+private:
+  /** Index of a grid node in the flat sample array. */
+  std::size_t node_index(int i, int j, int k) const {
+    return static_cast<std::size_t>(
+        (i * (m_cells[1] + 1) + j) * (m_cells[2] + 1) + k);
+  }
+  bool in_region(Utils::Vector3d const &pos) const;
+
+  std::shared_ptr<Shapes::Shape> m_shape;
+  /** Distance samples at the grid nodes. */
+  std::vector<double> m_values;
+  Utils::Vector3d m_origin;
+  Utils::Vector3d m_spacing;
+  Utils::Vector3i m_cells;
+};
+
+} // namespace Shapes
+
+#endif
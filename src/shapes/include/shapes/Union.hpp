@@ -22,11 +22,10 @@
 
 #include "Shape.hpp"
 
+#include <utils/Vector.hpp>
+
 #include <algorithm>
-#include <limits>
 #include <memory>
-#include <stdexcept>
-#include <utility>
 #include <vector>
 
 namespace Shapes {
@@ -35,13 +34,40 @@ class Union : public Shape {
 public:
   void add(std::shared_ptr<Shapes::Shape> const &shape) {
     m_shapes.emplace_back(shape);
+    clear_grid();
   }
 
   void remove(std::shared_ptr<Shapes::Shape> const &shape) {
     m_shapes.erase(std::remove(m_shapes.begin(), m_shapes.end(), shape),
                    m_shapes.end());
+    clear_grid();
   }
 
+  /**
+   * @brief Build a voxel grid with per-voxel shape culling.
+   *
+   * Without a grid, every distance query scans all contained shapes.
+   * This precomputes, for every voxel of a grid spanning the given
+   * region, the subset of shapes that can be the nearest one anywhere
+   * in that voxel: since the primitive distance functions are
+   * 1-Lipschitz, a shape whose distance at the voxel center exceeds
+   * the smallest center distance by more than the voxel diagonal can
+   * never win inside the voxel, so the culling is exact and queries
+   * inside the region return identical results to the full scan.
+   * Queries outside the region fall back to the full scan. The grid
+   * is discarded when a shape is added or removed.
+   *
+   * @param origin     Lower corner of the gridded region.
+   * @param lengths    Edge lengths of the gridded region.
+   * @param resolution Number of voxels in each direction.
+   */
+  void build_grid(Utils::Vector3d const &origin,
+                  Utils::Vector3d const &lengths,
+                  Utils::Vector3i const &resolution);
+
+  /** @brief Discard the acceleration grid. */
+  void clear_grid() { m_voxel_shapes.clear(); }
+
   /**
    * @brief Calculate the minimum of all distances and the corresponding
    * distance vector for a given position and any contained shape.
@@ -51,26 +77,7 @@ public:
    * @param[out] vec  Vector to nearest point on the shape.
    */
   void calculate_dist(Utils::Vector3d const &pos, double &dist,
-                      Utils::Vector3d &vec) const override {
-    auto dist_compare = [&pos](std::pair<double, Utils::Vector3d> const &res,
-                               std::shared_ptr<Shapes::Shape> const &shape) {
-      double d;
-      Utils::Vector3d vec;
-      shape->calculate_dist(pos, d, vec);
-      if (d < 0.0)
-        throw std::domain_error(
-            "Distance to Union not well-defined for given position!");
-      if (d < res.first) {
-        return std::make_pair(d, vec);
-      }
-      return res;
-    };
-    std::tie(dist, vec) =
-        std::accumulate(m_shapes.begin(), m_shapes.end(),
-                        std::make_pair(std::numeric_limits<double>::infinity(),
-                                       Utils::Vector3d{}),
-                        dist_compare);
-  }
+                      Utils::Vector3d &vec) const override;
 
   bool is_inside(Utils::Vector3d const &pos) const override {
     return std::any_of(
@@ -80,6 +87,13 @@ public:
 
 private:
   std::vector<std::shared_ptr<Shapes::Shape>> m_shapes;
+
+  /** Per-voxel indices of the shapes that can be nearest in the voxel.
+   *  Empty if no grid was built. */
+  std::vector<std::vector<unsigned>> m_voxel_shapes;
+  Utils::Vector3d m_grid_origin;
+  Utils::Vector3d m_voxel_size;
+  Utils::Vector3i m_grid_resolution;
 };
 
 } // namespace Shapes
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <shapes/SignedDistanceField.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace Shapes {
+
+void SignedDistanceField::rasterize(std::shared_ptr<Shapes::Shape> shape,
+                                    Utils::Vector3d const &origin,
+                                    Utils::Vector3d const &lengths,
+                                    Utils::Vector3i const &resolution) {
+  if (not shape) {
+    throw std::domain_error("Parameter 'shape' must be a shape");
+  }
+  if (not(lengths > Utils::Vector3d::broadcast(0.))) {
+    throw std::domain_error("Parameter 'lengths' must be > 0");
+  }
+  if (not(resolution > Utils::Vector3i::broadcast(0))) {
+    throw std::domain_error("Parameter 'resolution' must be > 0");
+  }
+
+  m_shape = std::move(shape);
+  m_origin = origin;
+  m_cells = resolution;
+  for (int dir = 0; dir < 3; ++dir) {
+    m_spacing[dir] = lengths[dir] / resolution[dir];
+  }
+
+  m_values.resize(node_index(resolution[0], resolution[1], resolution[2]) + 1u);
+  for (int i = 0; i <= resolution[0]; ++i) {
+    for (int j = 0; j <= resolution[1]; ++j) {
+      for (int k = 0; k <= resolution[2]; ++k) {
+        auto const node = origin + Utils::Vector3d{i * m_spacing[0],
+                                                   j * m_spacing[1],
+                                                   k * m_spacing[2]};
+        double dist;
+        Utils::Vector3d vec;
+        m_shape->calculate_dist(node, dist, vec);
+        m_values[node_index(i, j, k)] = dist;
+      }
+    }
+  }
+}
+
+bool SignedDistanceField::in_region(Utils::Vector3d const &pos) const {
+  for (int dir = 0; dir < 3; ++dir) {
+    auto const s = pos[dir] - m_origin[dir];
+    if (s < 0. or s > m_cells[dir] * m_spacing[dir]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SignedDistanceField::calculate_dist(Utils::Vector3d const &pos,
+                                         double &dist,
+                                         Utils::Vector3d &vec) const {
+  if (m_values.empty()) {
+    throw std::runtime_error("SignedDistanceField was not rasterized");
+  }
+  if (not in_region(pos)) {
+    m_shape->calculate_dist(pos, dist, vec);
+    return;
+  }
+
+  Utils::Vector3i cell;
+  Utils::Vector3d frac;
+  for (int dir = 0; dir < 3; ++dir) {
+    auto const s = (pos[dir] - m_origin[dir]) / m_spacing[dir];
+    cell[dir] = std::clamp(static_cast<int>(std::floor(s)), 0,
+                           m_cells[dir] - 1);
+    frac[dir] = s - cell[dir];
+  }
+
+  double corner[2][2][2];
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      for (int k = 0; k < 2; ++k) {
+        corner[i][j][k] =
+            m_values[node_index(cell[0] + i, cell[1] + j, cell[2] + k)];
+      }
+    }
+  }
+
+  /* interpolate along z, then y, then x; keep the intermediate values
+   * to evaluate the partial derivatives of the interpolant */
+  double face[2][2];
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      face[i][j] =
+          (1. - frac[2]) * corner[i][j][0] + frac[2] * corner[i][j][1];
+    }
+  }
+  double edge[2];
+  for (int i = 0; i < 2; ++i) {
+    edge[i] = (1. - frac[1]) * face[i][0] + frac[1] * face[i][1];
+  }
+  dist = (1. - frac[0]) * edge[0] + frac[0] * edge[1];
+
+  Utils::Vector3d gradient;
+  gradient[0] = (edge[1] - edge[0]) / m_spacing[0];
+  gradient[1] = ((1. - frac[0]) * (face[0][1] - face[0][0]) +
+                 frac[0] * (face[1][1] - face[1][0])) /
+                m_spacing[1];
+  gradient[2] = 0.;
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      auto const weight = (i ? frac[0] : 1. - frac[0]) *
+                          (j ? frac[1] : 1. - frac[1]);
+      gradient[2] += weight * (corner[i][j][1] - corner[i][j][0]);
+    }
+  }
+  gradient[2] /= m_spacing[2];
+
+  /* the gradient of a signed distance field is the unit direction away
+   * from the surface, so vec = dist * grad points from the nearest
+   * surface point to the query position, as for the other shapes */
+  auto const norm = gradient.norm();
+  if (norm > 0.) {
+    vec = (dist / norm) * gradient;
+  } else {
+    vec = Utils::Vector3d{};
+  }
+}
+
+bool SignedDistanceField::is_inside(Utils::Vector3d const &pos) const {
+  if (m_values.empty()) {
+    throw std::runtime_error("SignedDistanceField was not rasterized");
+  }
+  if (not in_region(pos)) {
+    return m_shape->is_inside(pos);
+  }
+  double dist;
+  Utils::Vector3d vec;
+  calculate_dist(pos, dist, vec);
+  return dist < 0.;
+}
+
+} // namespace Shapes
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2010-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <shapes/Union.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace Shapes {
+
+void Union::build_grid(Utils::Vector3d const &origin,
+                       Utils::Vector3d const &lengths,
+                       Utils::Vector3i const &resolution) {
+  if (not(lengths > Utils::Vector3d::broadcast(0.))) {
+    throw std::domain_error("Parameter 'lengths' must be > 0");
+  }
+  if (not(resolution > Utils::Vector3i::broadcast(0))) {
+    throw std::domain_error("Parameter 'resolution' must be > 0");
+  }
+
+  m_grid_origin = origin;
+  m_grid_resolution = resolution;
+  for (int dir = 0; dir < 3; ++dir) {
+    m_voxel_size[dir] = lengths[dir] / resolution[dir];
+  }
+  /* a shape within this margin of the smallest center distance can
+   * still be the nearest shape somewhere in the voxel */
+  auto const margin = m_voxel_size.norm();
+
+  m_voxel_shapes.clear();
+  m_voxel_shapes.reserve(static_cast<std::size_t>(resolution[0]) *
+                         resolution[1] * resolution[2]);
+
+  std::vector<double> center_dist(m_shapes.size());
+  for (int i = 0; i < resolution[0]; ++i) {
+    for (int j = 0; j < resolution[1]; ++j) {
+      for (int k = 0; k < resolution[2]; ++k) {
+        auto const center =
+            origin + Utils::Vector3d{(i + 0.5) * m_voxel_size[0],
+                                     (j + 0.5) * m_voxel_size[1],
+                                     (k + 0.5) * m_voxel_size[2]};
+        auto min_dist = std::numeric_limits<double>::infinity();
+        for (std::size_t s = 0; s < m_shapes.size(); ++s) {
+          Utils::Vector3d vec;
+          m_shapes[s]->calculate_dist(center, center_dist[s], vec);
+          min_dist = std::min(min_dist, center_dist[s]);
+        }
+
+        std::vector<unsigned> candidates;
+        for (std::size_t s = 0; s < m_shapes.size(); ++s) {
+          if (center_dist[s] <= min_dist + margin) {
+            candidates.push_back(static_cast<unsigned>(s));
+          }
+        }
+        m_voxel_shapes.emplace_back(std::move(candidates));
+      }
+    }
+  }
+}
+
+void Union::calculate_dist(Utils::Vector3d const &pos, double &dist,
+                           Utils::Vector3d &vec) const {
+  auto consider = [&pos, &dist, &vec](Shapes::Shape const &shape) {
+    double d;
+    Utils::Vector3d v;
+    shape.calculate_dist(pos, d, v);
+    if (d < 0.0)
+      throw std::domain_error(
+          "Distance to Union not well-defined for given position!");
+    if (d < dist) {
+      dist = d;
+      vec = v;
+    }
+  };
+
+  dist = std::numeric_limits<double>::infinity();
+  vec = Utils::Vector3d{};
+
+  if (!m_voxel_shapes.empty()) {
+    Utils::Vector3i index;
+    bool in_grid = true;
+    for (int dir = 0; dir < 3; ++dir) {
+      index[dir] = static_cast<int>(
+          std::floor((pos[dir] - m_grid_origin[dir]) / m_voxel_size[dir]));
+      in_grid &= index[dir] >= 0 and index[dir] < m_grid_resolution[dir];
+    }
+    if (in_grid) {
+      auto const voxel = static_cast<std::size_t>(
+          (index[0] * m_grid_resolution[1] + index[1]) * m_grid_resolution[2] +
+          index[2]);
+      for (auto const s : m_voxel_shapes[voxel]) {
+        consider(*m_shapes[s]);
+      }
+      return;
+    }
+  }
+
+  for (auto const &shape : m_shapes) {
+    consider(*shape);
+  }
+}
+
+} // namespace Shapes
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE SignedDistanceField test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <shapes/SignedDistanceField.hpp>
+#include <shapes/Sphere.hpp>
+
+#include <utils/Vector.hpp>
+
+#include <memory>
+
+BOOST_AUTO_TEST_CASE(dist_function) {
+  auto sphere = std::make_shared<Shapes::Sphere>();
+  sphere->pos() = Utils::Vector3d{5., 5., 5.};
+  sphere->rad() = 2.;
+  sphere->direction() = -1.;
+
+  Shapes::SignedDistanceField sdf;
+  sdf.rasterize(sphere, {0., 0., 0.}, {10., 10., 10.}, {100, 100, 100});
+
+  auto const h = 0.1;
+  for (auto const &pos :
+       {Utils::Vector3d{5., 5., 6.2}, Utils::Vector3d{3.3, 4.1, 5.7},
+        Utils::Vector3d{6.66, 5.55, 4.44}}) {
+    double exact_dist, sdf_dist;
+    Utils::Vector3d exact_vec, sdf_vec;
+    sphere->calculate_dist(pos, exact_dist, exact_vec);
+    sdf.calculate_dist(pos, sdf_dist, sdf_vec);
+
+    /* the interpolation error is O(h^2) in the grid spacing */
+    BOOST_CHECK_SMALL(sdf_dist - exact_dist, h * h);
+    BOOST_CHECK_SMALL((sdf_vec - exact_vec).norm(), h);
+    BOOST_CHECK_EQUAL(sdf.is_inside(pos), sphere->is_inside(pos));
+  }
+
+  /* outside the gridded region the wrapped shape is queried directly */
+  {
+    auto const pos = Utils::Vector3d{15., 5., 5.};
+    double exact_dist, sdf_dist;
+    Utils::Vector3d exact_vec, sdf_vec;
+    sphere->calculate_dist(pos, exact_dist, exact_vec);
+    sdf.calculate_dist(pos, sdf_dist, sdf_vec);
+
+    BOOST_CHECK_EQUAL(sdf_dist, exact_dist);
+    BOOST_CHECK_EQUAL(sdf_vec, exact_vec);
+  }
+}
@@ -23,6 +23,7 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <shapes/Sphere.hpp>
 #include <shapes/Union.hpp>
 #include <shapes/Wall.hpp>
 
@@ -30,6 +31,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(dist_function) {
   {
@@ -66,3 +69,42 @@ BOOST_AUTO_TEST_CASE(dist_function) {
     check_union({1.2, 2.3, 5.5});
   }
 }
+
+BOOST_AUTO_TEST_CASE(acceleration_grid) {
+  Shapes::Union uni;
+  for (auto const &center :
+       {Utils::Vector3d{2., 2., 2.}, Utils::Vector3d{8., 2., 2.},
+        Utils::Vector3d{2., 8., 2.}, Utils::Vector3d{8., 8., 8.}}) {
+    auto sphere = std::make_shared<Shapes::Sphere>();
+    sphere->pos() = center;
+    sphere->rad() = 1.;
+    uni.add(sphere);
+  }
+
+  auto const probes = {
+      Utils::Vector3d{0.1, 0.1, 0.1}, Utils::Vector3d{5., 5., 5.},
+      Utils::Vector3d{7., 2.5, 2.2}, Utils::Vector3d{9.9, 9.9, 9.9},
+      /* outside the gridded region, must fall back to the full scan */
+      Utils::Vector3d{12., -3., 5.}};
+
+  /* reference distances from the exhaustive scan */
+  std::vector<std::pair<double, Utils::Vector3d>> reference;
+  for (auto const &pos : probes) {
+    double dist;
+    Utils::Vector3d vec;
+    uni.calculate_dist(pos, dist, vec);
+    reference.emplace_back(dist, vec);
+  }
+
+  /* the culling is exact, so the gridded results must be identical */
+  uni.build_grid({0., 0., 0.}, {10., 10., 10.}, {5, 5, 5});
+  auto ref = reference.begin();
+  for (auto const &pos : probes) {
+    double dist;
+    Utils::Vector3d vec;
+    uni.calculate_dist(pos, dist, vec);
+    BOOST_CHECK_EQUAL(dist, ref->first);
+    BOOST_CHECK_EQUAL(vec, ref->second);
+    ++ref;
+  }
+}
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <limits>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace Utils {
@@ -49,9 +50,28 @@ class Accumulator {
 public:
   explicit Accumulator(std::size_t N) : m_n(0), m_acc_data(N) {}
   void operator()(const std::vector<double> &);
+  /**
+   * @brief Merge the samples of another accumulator into this one.
+   *
+   * Combines the Welford states with the pairwise update from
+   * Chan et al., so independently filled accumulators (e.g. one per
+   * rank or per sample block) can be combined without replaying
+   * their samples.
+   */
+  void merge(Accumulator const &);
   std::vector<double> mean() const;
   std::vector<double> variance() const;
   std::vector<double> std_error() const;
+  /** @brief Get the raw Welford state for checkpointing. */
+  std::pair<std::size_t, std::vector<AccumulatorData<double>>>
+  get_state() const {
+    return {m_n, m_acc_data};
+  }
+  /** @brief Restore the raw Welford state from a checkpoint. */
+  void set_state(std::size_t n, std::vector<AccumulatorData<double>> acc_data) {
+    m_n = n;
+    m_acc_data = std::move(acc_data);
+  }
 
 private:
   std::size_t m_n;
@@ -89,6 +109,31 @@ inline void Accumulator::operator()(const std::vector<double> &data) {
   }
 }
 
+inline void Accumulator::merge(Accumulator const &other) {
+  if (other.m_acc_data.size() != m_acc_data.size())
+    throw std::runtime_error(
+        "The given accumulator size does not fit the initialized size!");
+  if (other.m_n == 0)
+    return;
+  if (m_n == 0) {
+    *this = other;
+    return;
+  }
+  auto const n_total = static_cast<double>(m_n + other.m_n);
+  auto const n_other = static_cast<double>(other.m_n);
+  std::transform(m_acc_data.begin(), m_acc_data.end(),
+                 other.m_acc_data.begin(), m_acc_data.begin(),
+                 [n_total, n_other, n = static_cast<double>(m_n)](
+                     AccumulatorData<double> const &a,
+                     AccumulatorData<double> const &b)
+                     -> AccumulatorData<double> {
+                   auto const delta = b.mean - a.mean;
+                   return {a.mean + delta * n_other / n_total,
+                           a.m + b.m + delta * delta * n * n_other / n_total};
+                 });
+  m_n += other.m_n;
+}
+
 inline std::vector<double> Accumulator::mean() const {
   std::vector<double> res;
   std::transform(
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2016-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef UTILS_SHARDED_HISTOGRAM_HPP
+#define UTILS_SHARDED_HISTOGRAM_HPP
+
+#include "utils/Span.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Utils {
+
+/**
+ * \brief Histogram with sharded storage for concurrent accumulation.
+ *
+ * Unlike @ref Utils::Histogram, bins are replicated once per shard and
+ * only merged on read, so concurrent writers that use distinct shard
+ * indices (e.g. one shard per thread) never contend on bin memory.
+ * The regular grid allows the bin index to be computed branch-free from
+ * precomputed reciprocal bin sizes and row-major strides; out-of-range
+ * samples fall out of a single unsigned comparison per dimension. The
+ * batched \ref update_many folds the per-sample argument checks of
+ * @ref Utils::Histogram::update into one check per batch.
+ *
+ * \tparam T     Histogram data type.
+ * \tparam N     Histogram data dimensionality.
+ * \tparam M     Coordinates data dimensionality.
+ * \tparam U     Coordinates data type.
+ */
+template <typename T, std::size_t N, std::size_t M = 3, typename U = double>
+class ShardedHistogram {
+  struct Shard {
+    std::vector<T> values;
+    std::vector<std::size_t> counts;
+  };
+
+public:
+  /**
+   * \brief Histogram constructor.
+   * \param n_shards  the number of independent accumulation shards.
+   * \param n_bins    the number of bins in each histogram dimension.
+   * \param limits    the minimum/maximum data values to consider for the
+   *        histogram.
+   */
+  ShardedHistogram(std::size_t n_shards, std::array<std::size_t, M> n_bins,
+                   std::array<std::pair<U, U>, M> limits)
+      : m_n_bins(std::move(n_bins)), m_limits(std::move(limits)) {
+    if (n_shards == 0u) {
+      throw std::invalid_argument("Need at least one shard");
+    }
+    std::size_t stride = N;
+    for (std::size_t i = M; i-- > 0;) {
+      m_bin_sizes[i] = (m_limits[i].second - m_limits[i].first) /
+                       static_cast<U>(m_n_bins[i]);
+      m_inv_bin_sizes[i] = U{1} / m_bin_sizes[i];
+      m_strides[i] = stride;
+      stride *= m_n_bins[i];
+    }
+    m_shards.resize(n_shards);
+    for (auto &shard : m_shards) {
+      shard.values.resize(stride, T{});
+      shard.counts.resize(stride, 0u);
+    }
+  }
+
+  /** \brief Get the number of shards. */
+  std::size_t get_n_shards() const { return m_shards.size(); }
+
+  /** \brief Get the number of bins for each dimension. */
+  std::array<std::size_t, M> get_n_bins() const { return m_n_bins; }
+
+  /** \brief Get the ranges (min, max) for each dimension. */
+  std::array<std::pair<U, U>, M> get_limits() const { return m_limits; }
+
+  /** \brief Get the bin sizes. */
+  std::array<U, M> get_bin_sizes() const { return m_bin_sizes; }
+
+  /** \brief Get the histogram data, merged over all shards. */
+  std::vector<T> get_histogram() const {
+    std::vector<T> total(m_shards.front().values.size(), T{});
+    for (auto const &shard : m_shards) {
+      for (std::size_t i = 0; i < total.size(); ++i) {
+        total[i] += shard.values[i];
+      }
+    }
+    return total;
+  }
+
+  /** \brief Get the histogram count data, merged over all shards. */
+  std::vector<std::size_t> get_tot_count() const {
+    std::vector<std::size_t> total(m_shards.front().counts.size(), 0u);
+    for (auto const &shard : m_shards) {
+      for (std::size_t i = 0; i < total.size(); ++i) {
+        total[i] += shard.counts[i];
+      }
+    }
+    return total;
+  }
+
+  /**
+   * \brief Add data to the histogram.
+   * \param shard  Shard to accumulate into.
+   * \param pos    Position to update.
+   * \param value  Value to add.
+   */
+  void update(std::size_t shard, Span<const U> pos, Span<const T> value) {
+    if (pos.size() != M) {
+      throw std::invalid_argument("Wrong dimensions for the coordinates");
+    }
+    if (value.size() != N) {
+      throw std::invalid_argument("Wrong dimensions for the value");
+    }
+    assert(shard < m_shards.size());
+    accumulate(m_shards[shard], pos.data(), value.data());
+  }
+
+  /**
+   * \brief Add a batch of data to the histogram.
+   * \param shard   Shard to accumulate into.
+   * \param pos     Sample positions, flattened to M entries per sample.
+   * \param values  Sample weights, flattened to N entries per sample.
+   */
+  void update_many(std::size_t shard, Span<const U> pos,
+                   Span<const T> values) {
+    if (pos.size() % M != 0u) {
+      throw std::invalid_argument("Wrong dimensions for the coordinates");
+    }
+    auto const n_samples = pos.size() / M;
+    if (values.size() != N * n_samples) {
+      throw std::invalid_argument("Wrong dimensions for the values");
+    }
+    assert(shard < m_shards.size());
+    auto &bins = m_shards[shard];
+    for (std::size_t i = 0; i < n_samples; ++i) {
+      accumulate(bins, pos.data() + i * M, values.data() + i * N);
+    }
+  }
+
+private:
+  /**
+   * \brief Accumulate one sample into a shard.
+   * \param bins   Shard to accumulate into.
+   * \param pos    Position of the sample (M entries).
+   * \param value  Weights of the sample (N entries).
+   */
+  void accumulate(Shard &bins, U const *pos, T const *value) {
+    std::size_t offset = 0u;
+    bool within_range = true;
+    for (std::size_t i = 0; i < M; ++i) {
+      auto const scaled = (pos[i] - m_limits[i].first) * m_inv_bin_sizes[i];
+      auto const in_bin =
+          scaled >= U{0} and scaled < static_cast<U>(m_n_bins[i]);
+      within_range = within_range and in_bin;
+      offset += (in_bin ? static_cast<std::size_t>(scaled) : 0u) *
+                m_strides[i];
+    }
+    if (within_range) {
+      for (std::size_t i = 0; i < N; ++i) {
+        bins.values[offset + i] += value[i];
+        bins.counts[offset + i]++;
+      }
+    }
+  }
+
+  /// Number of bins for each dimension.
+  std::array<std::size_t, M> m_n_bins;
+  /// Min and max values for each dimension.
+  std::array<std::pair<U, U>, M> m_limits;
+  /// Bin sizes for each dimension.
+  std::array<U, M> m_bin_sizes;
+  /// Reciprocal bin sizes for each dimension.
+  std::array<U, M> m_inv_bin_sizes;
+  /// Row-major strides of the flattened bin array.
+  std::array<std::size_t, M> m_strides;
+  /// Per-shard bin storage.
+  std::vector<Shard> m_shards;
+};
+
+} // Namespace Utils
+
+#endif
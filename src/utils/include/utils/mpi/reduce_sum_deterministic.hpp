@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef UTILS_MPI_REDUCE_SUM_DETERMINISTIC_HPP
+#define UTILS_MPI_REDUCE_SUM_DETERMINISTIC_HPP
+
+#include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/communicator.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Utils {
+namespace Mpi {
+
+/**
+ * @brief Element-wise sum over all ranks with a reproducible result.
+ *
+ * An @c MPI_Reduce is free to combine the contributions in any
+ * association, so the last bits of a floating-point sum can differ
+ * between runs. This function instead gathers all contributions to
+ * @p root and sums them in rank order with Neumaier-compensated
+ * summation, which makes the result bitwise reproducible for a given
+ * number of ranks (and more accurate than the plain sum). The price is
+ * a factor @c comm.size() buffer on the root and a serial summation
+ * there, so this is meant for moderately sized buffers like ghost
+ * force messages or observable accumulators, not for field data.
+ *
+ * @param comm       The communicator to reduce over.
+ * @param in_values  Local contribution, @p n elements.
+ * @param n          Number of elements.
+ * @param out_values Result, @p n elements. Only significant on @p root.
+ * @param root       Rank receiving the result.
+ */
+template <typename T>
+void reduce_sum_deterministic(boost::mpi::communicator const &comm,
+                              T const *in_values, int n, T *out_values,
+                              int root) {
+  std::vector<T> gathered;
+  boost::mpi::gather(comm, in_values, n, gathered, root);
+
+  if (comm.rank() == root) {
+    auto const n_ranks = static_cast<std::size_t>(comm.size());
+    auto const stride = static_cast<std::size_t>(n);
+    for (std::size_t j = 0; j < stride; ++j) {
+      T sum{}, compensation{};
+      for (std::size_t rank = 0; rank < n_ranks; ++rank) {
+        auto const term = gathered[rank * stride + j];
+        auto const partial = sum + term;
+        if (std::abs(sum) >= std::abs(term)) {
+          compensation += (sum - partial) + term;
+        } else {
+          compensation += (term - partial) + sum;
+        }
+        sum = partial;
+      }
+      out_values[j] = sum + compensation;
+    }
+  }
+}
+
+} // namespace Mpi
+} // namespace Utils
+
+#endif
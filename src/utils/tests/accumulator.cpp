@@ -26,8 +26,10 @@
 #include <boost/archive/text_oarchive.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
 BOOST_AUTO_TEST_CASE(accumulator) {
@@ -63,3 +65,44 @@ BOOST_AUTO_TEST_CASE(accumulator) {
   BOOST_CHECK((acc_deserialized.variance() == test_var));
   BOOST_CHECK((acc_deserialized.std_error() == test_stderr));
 }
+
+BOOST_AUTO_TEST_CASE(accumulator_merge) {
+  auto const test_data1 = std::vector<double>{{0.0, 1.0, 2.0, 3.0}};
+  auto const test_data2 = std::vector<double>{{1.5, 3.5, 3.5, 4.5}};
+  auto const test_data3 = std::vector<double>{{2.0, 1.5, 1.0, 0.5}};
+
+  // merging two partial accumulators must reproduce sequential statistics
+  auto acc_all = Utils::Accumulator(4);
+  acc_all(test_data1);
+  acc_all(test_data2);
+  acc_all(test_data3);
+
+  auto acc_left = Utils::Accumulator(4);
+  acc_left(test_data1);
+  acc_left(test_data2);
+  auto acc_right = Utils::Accumulator(4);
+  acc_right(test_data3);
+  acc_left.merge(acc_right);
+
+  auto const mean_seq = acc_all.mean();
+  auto const mean_merged = acc_left.mean();
+  auto const var_seq = acc_all.variance();
+  auto const var_merged = acc_left.variance();
+  for (std::size_t i = 0; i < 4; ++i) {
+    BOOST_CHECK_CLOSE(mean_merged[i], mean_seq[i], 1e-12);
+    BOOST_CHECK_CLOSE(var_merged[i], var_seq[i], 1e-12);
+  }
+
+  // merging into an empty accumulator copies the other state
+  auto acc_empty = Utils::Accumulator(4);
+  acc_empty.merge(acc_all);
+  BOOST_CHECK((acc_empty.mean() == acc_all.mean()));
+  BOOST_CHECK((acc_empty.variance() == acc_all.variance()));
+
+  // merging an empty accumulator is a no-op
+  acc_all.merge(Utils::Accumulator(4));
+  BOOST_CHECK((acc_all.mean() == acc_empty.mean()));
+
+  // size mismatch is rejected
+  BOOST_CHECK_THROW(acc_all.merge(Utils::Accumulator(5)), std::runtime_error);
+}
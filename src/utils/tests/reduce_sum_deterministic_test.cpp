@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_MODULE Utils::Mpi::reduce_sum_deterministic test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <utils/mpi/reduce_sum_deterministic.hpp>
+
+#include <boost/mpi.hpp>
+
+#include <limits>
+#include <vector>
+
+/*
+ * Check that the reduction yields the rank-ordered sum on the root.
+ * The element-wise sums of the contributions rank + 1, 2 * (rank + 1),
+ * ... are exact in floating point, so the expected values can be
+ * computed in closed form.
+ */
+BOOST_AUTO_TEST_CASE(sum) {
+  boost::mpi::communicator world;
+  auto const size = world.size();
+  auto const root = world.size() - 1;
+
+  constexpr int n = 3;
+  std::vector<double> in(n), out(n, -1.);
+  for (int j = 0; j < n; j++) {
+    in[j] = static_cast<double>((j + 1) * (world.rank() + 1));
+  }
+
+  Utils::Mpi::reduce_sum_deterministic(world, in.data(), n, out.data(), root);
+
+  if (world.rank() == root) {
+    auto const rank_sum = static_cast<double>(size * (size + 1) / 2);
+    for (int j = 0; j < n; j++) {
+      BOOST_CHECK_EQUAL(out[j], (j + 1) * rank_sum);
+    }
+  }
+}
+
+/*
+ * Check that the compensated summation recovers a small term that a
+ * plain left-to-right sum would lose: every rank but the last
+ * contributes epsilon / 2 to a sum starting at 1.0.
+ */
+BOOST_AUTO_TEST_CASE(compensation) {
+  boost::mpi::communicator world;
+  auto const root = 0;
+  auto const eps = std::numeric_limits<double>::epsilon();
+
+  double in = (world.rank() == 0) ? 1. : eps / 2.;
+  double out = 0.;
+
+  Utils::Mpi::reduce_sum_deterministic(world, &in, 1, &out, root);
+
+  if (world.rank() == root) {
+    auto const tail = static_cast<double>(world.size() - 1) * (eps / 2.);
+    BOOST_CHECK_EQUAL(out, 1. + tail);
+  }
+}
+
+int main(int argc, char **argv) {
+  boost::mpi::environment mpi_env(argc, argv);
+
+  return boost::unit_test::unit_test_main(init_unit_test, argc, argv);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2010-2022 The ESPResSo project
+ *
+ * This file is part of ESPResSo.
+ *
+ * ESPResSo is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESPResSo is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#define BOOST_TEST_MODULE ShardedHistogram test
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "utils/Histogram.hpp"
+#include "utils/ShardedHistogram.hpp"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(sharded_histogram) {
+  std::array<std::size_t, 2> n_bins{{10, 10}};
+  std::array<std::pair<double, double>, 2> limits{
+      {std::make_pair(1.0, 20.0), std::make_pair(5.0, 10.0)}};
+  constexpr std::size_t n_dims_data = 2;
+  auto hist =
+      Utils::ShardedHistogram<double, n_dims_data, 2>(4, n_bins, limits);
+  // Check getters.
+  BOOST_CHECK(hist.get_n_shards() == 4);
+  BOOST_CHECK(hist.get_limits() == limits);
+  BOOST_CHECK(hist.get_n_bins() == n_bins);
+  BOOST_CHECK((hist.get_bin_sizes() ==
+               std::array<double, 2>{{19.0 / 10.0, 5.0 / 10.0}}));
+  // Check that histogram is initialized to zero.
+  BOOST_CHECK(hist.get_histogram() ==
+              std::vector<double>(n_dims_data * n_bins[0] * n_bins[1], 0.0));
+  // Check that histogram still empty if data is out of bounds.
+  hist.update(0, std::vector<double>{{1.0, 4.0}},
+              std::vector<double>{{1.0, 1.0}});
+  BOOST_CHECK(hist.get_histogram() ==
+              std::vector<double>(n_dims_data * n_bins[0] * n_bins[1], 0.0));
+  // Check that samples written to distinct shards are merged on read.
+  hist.update(0, std::vector<double>{{limits[0].first, limits[1].first}},
+              std::vector<double>{{1.0, 1.0}});
+  hist.update(3, std::vector<double>{{limits[0].first, limits[1].first}},
+              std::vector<double>{{10.0, 10.0}});
+  BOOST_CHECK((hist.get_histogram())[0] == 11.0);
+  BOOST_CHECK((hist.get_histogram())[1] == 11.0);
+  BOOST_CHECK((hist.get_tot_count())[0] == 2);
+  // Check the batched update.
+  hist.update_many(
+      1, std::vector<double>{{2.0, 6.0, 2.0, 6.0, 1.0, 4.0}},
+      std::vector<double>{{1.0, 2.0, 3.0, 4.0, 100.0, 100.0}});
+  auto const index = n_dims_data * (/* x bin */ 0 * n_bins[1] + /* y bin */ 2);
+  BOOST_CHECK((hist.get_histogram())[index + 0] == 4.0);
+  BOOST_CHECK((hist.get_histogram())[index + 1] == 6.0);
+  BOOST_CHECK((hist.get_tot_count())[index] == 2);
+  // Check exceptions.
+  BOOST_CHECK_THROW(
+      (Utils::ShardedHistogram<double, n_dims_data, 2>(0, n_bins, limits)),
+      std::invalid_argument);
+  BOOST_CHECK_THROW(hist.update(0, std::vector<double>{{1.0}},
+                                std::vector<double>{{1.0, 1.0}}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(hist.update(0, std::vector<double>{{1.0, 6.0}},
+                                std::vector<double>{{1.0}}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(hist.update_many(0, std::vector<double>{{1.0, 6.0, 2.0}},
+                                     std::vector<double>{{1.0, 1.0}}),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(hist.update_many(0, std::vector<double>{{1.0, 6.0}},
+                                     std::vector<double>{{1.0}}),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(against_reference_histogram) {
+  // The sharded histogram must bin exactly like Utils::Histogram.
+  std::array<std::size_t, 2> n_bins{{7, 3}};
+  std::array<std::pair<double, double>, 2> limits{
+      {std::make_pair(-2.0, 5.0), std::make_pair(0.0, 9.0)}};
+  auto reference = Utils::Histogram<double, 1, 2>(n_bins, limits);
+  auto sharded = Utils::ShardedHistogram<double, 1, 2>(2, n_bins, limits);
+  std::vector<double> pos_batch;
+  std::vector<double> weight_batch;
+  for (int i = 0; i < 100; ++i) {
+    auto const pos =
+        std::vector<double>{{-3.0 + 0.1 * i, -1.0 + 0.13 * i}};
+    auto const weight = std::vector<double>{{0.5 + 0.01 * i}};
+    reference.update(pos, weight);
+    pos_batch.insert(pos_batch.end(), pos.begin(), pos.end());
+    weight_batch.push_back(weight[0]);
+  }
+  sharded.update_many(1, pos_batch, weight_batch);
+  BOOST_CHECK(sharded.get_histogram() == reference.get_histogram());
+  BOOST_CHECK(sharded.get_tot_count() == reference.get_tot_count());
+}
@@ -17,10 +17,12 @@
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #
 
+import os
 import unittest as ut
 
 import numpy as np
 import pickle
+import tempfile
 
 import espressomd
 import espressomd.observables
@@ -72,6 +74,38 @@ class TimeSeriesTest(ut.TestCase):
         acc.clear()
         self.assertEqual(len(acc.time_series()), 0)
 
+    def test_spill_to_disk(self):
+        """Check that a spilling accumulator records the same series as a
+        fully resident one and that windowed retrieval works.
+
+        """
+        system = self.system
+        system.part.add(pos=np.zeros((N_PART, 3)))
+        obs = espressomd.observables.ParticlePositions(ids=range(N_PART))
+        positions = np.copy(system.box_l) * np.random.random((10, N_PART, 3))
+
+        with tempfile.TemporaryDirectory() as tmp_directory:
+            file_path = os.path.join(tmp_directory, "time_series.bin")
+            acc = espressomd.accumulators.TimeSeries(
+                obs=obs, file_path=file_path, chunk_size=4)
+
+            for pos in positions:
+                system.part.all().pos = pos
+                acc.update()
+
+            self.assertEqual(acc.n_samples(), len(positions))
+            self.assertEqual(acc.shape()[0], len(positions))
+            self.assertTrue(os.path.exists(file_path))
+            np.testing.assert_array_equal(acc.time_series(), positions)
+            np.testing.assert_array_equal(
+                acc.time_series(first=3, last=7), positions[3:7])
+            with self.assertRaises(RuntimeError):
+                acc.time_series(first=0, last=len(positions) + 1)
+
+            acc.clear()
+            self.assertEqual(acc.n_samples(), 0)
+            self.assertFalse(os.path.exists(file_path))
+
 
 if __name__ == "__main__":
     ut.main()
@@ -71,6 +71,23 @@ class CellSystem(ut.TestCase):
         np.testing.assert_array_equal(np.copy(system.cell_system.node_grid),
                                       np.copy(node_grid))
 
+    def test_resolve_overlaps(self):
+        system = self.system
+        system.cell_system.set_regular_decomposition()
+        system.cell_system.skin = 0.1
+        diameter = 1.0
+        system.min_global_cut = diameter
+        np.random.seed(seed=42)
+        system.part.add(pos=np.random.uniform(0., 5., (50, 3)))
+        n_sweeps = system.cell_system.resolve_overlaps(diameter=diameter)
+        self.assertGreater(n_sweeps, 0)
+        self.assertEqual(len(system.cell_system.get_pairs(diameter)), 0)
+        # a second pass finds nothing to do
+        self.assertEqual(system.cell_system.resolve_overlaps(
+            diameter=diameter), 0)
+        system.part.clear()
+        system.min_global_cut = 0.
+
     def test_node_grid_regular(self):
         self.system.cell_system.set_regular_decomposition()
         self.check_node_grid()
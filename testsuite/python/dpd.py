@@ -379,6 +379,36 @@ class DPDThermostat(ut.TestCase):
             np.testing.assert_array_almost_equal(np.copy(dpd_stress), stress)
             np.testing.assert_array_almost_equal(np.copy(obs_stress), stress)
 
+    @utx.skipIfMissingFeatures("EXCLUSIONS")
+    def test_exclusions_after_thermostat_change(self):
+        """Excluded pairs get thermostat forces when DPD is enabled late.
+
+        Verlet lists built without the DPD thermostat have excluded
+        pairs filtered out, so enabling the thermostat afterwards has
+        to invalidate the lists.
+        """
+        system = self.system
+        gamma = 2.5
+        p1 = system.part.add(pos=[1.0, 1.0, 1.0], v=[1., 0., 0.])
+        p2 = system.part.add(pos=[1.5, 1.0, 1.0])
+        p1.add_exclusion(p2.id)
+        system.non_bonded_inter[0, 0].dpd.set_params(
+            weight_function=0, gamma=gamma, r_cut=1.0,
+            trans_weight_function=0, trans_gamma=0.0, trans_r_cut=1.0)
+
+        # build the Verlet lists with the thermostat still disabled:
+        # the excluded pair is filtered out
+        system.integrator.run(1)
+        np.testing.assert_array_equal(np.copy(p1.f), [0., 0., 0.])
+        np.testing.assert_array_equal(np.copy(p2.f), [0., 0., 0.])
+
+        system.thermostat.set_dpd(kT=0., seed=42)
+        system.integrator.run(0, recalc_forces=True)
+        np.testing.assert_allclose(np.copy(p1.f), [-gamma, 0., 0.],
+                                   rtol=0., atol=1e-11)
+        np.testing.assert_allclose(np.copy(p2.f), [+gamma, 0., 0.],
+                                   rtol=0., atol=1e-11)
+
     def test_momentum_conservation(self):
         r_cut = 1.0
         gamma = 5.
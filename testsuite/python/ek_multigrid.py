@@ -0,0 +1,121 @@
+#
+# Copyright (C) 2011-2022 The ESPResSo project
+#
+# This file is part of ESPResSo.
+#
+# ESPResSo is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ESPResSo is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+import unittest as ut
+import unittest_decorators as utx
+import espressomd
+import espressomd.electrokinetics
+import math
+import numpy as np
+
+##########################################################################
+# Exercise the multigrid Poisson solver of the EK electrostatics #
+##########################################################################
+# Same plate capacitor geometry as ek_charged_plate.py, which runs the
+# default spectral solver, so both schemes are checked against the same
+# analytic result.
+
+
+@utx.skipIfMissingGPU()
+@utx.skipIfMissingFeatures(["ELECTROKINETICS"])
+class ek_multigrid(ut.TestCase):
+
+    system = espressomd.System(box_l=[20., 20., 20.])
+
+    def test(self):
+        system = self.system
+
+        box_l = 20.
+        agrid = 0.5
+        prefactor = 1.0
+        grid = int(box_l / agrid)
+        system.box_l = 3 * [box_l]
+        system.cell_system.skin = 0.2
+        system.time_step = 0.1
+        system.periodicity = [True, True, True]
+
+        system.thermostat.turn_off()
+
+        # check invalid scheme names are rejected
+        with self.assertRaises(ValueError):
+            espressomd.electrokinetics.Electrokinetics(
+                agrid=agrid, lb_density=1.0, viscosity=1.0, friction=1.0,
+                T=1.0, prefactor=prefactor, electrostatics_scheme="unknown")
+
+        # Setup the fluid with the multigrid Poisson solver
+        ek = espressomd.electrokinetics.Electrokinetics(
+            agrid=agrid,
+            lb_density=1.0,
+            viscosity=1.0,
+            friction=1.0,
+            T=1.0,
+            prefactor=prefactor,
+            stencil="linkcentered",
+            advection=False,
+            es_coupling=True,
+            electrostatics_scheme="multigrid")
+
+        positive_ions = espressomd.electrokinetics.Species(
+            density=0.0, D=0.0, valency=1.0)
+        negative_ions = espressomd.electrokinetics.Species(
+            density=0.0, D=0.0, valency=-1.0)
+        ek.add_species(positive_ions)
+        ek.add_species(negative_ions)
+        system.actors.add(ek)
+
+        self.assertEqual(
+            ek.get_params()["electrostatics_scheme"], "multigrid")
+
+        # Setup plate capacitor in X
+        for i in range(grid):
+            for j in range(grid):
+                positive_ions[10, i, j].density = 1.0 / agrid
+                negative_ions[30, i, j].density = 1.0 / agrid
+
+        # Check force on an MD particle between the plates
+        p = system.part.add(pos=[0, 0, 0], q=-1.0, type=0)
+        expected_force = -2 * math.pi * prefactor
+        force_difference = 0.0
+
+        for i in range(7, 14):
+            p.pos = [i, 0, 0]
+            system.integrator.run(0)
+
+            particle_force = p.f
+            if abs(expected_force - particle_force[0]) > force_difference:
+                force_difference = abs(expected_force - particle_force[0])
+
+        self.assertLess(force_difference, 1.0e-03,
+                        f"Force accuracy in X not achieved, allowed "
+                        f"deviation: 1.0e-03, measured: {force_difference}")
+
+        # Check the potential is linear between the plates with the
+        # slope matching the field probed by the particle above
+        phi = np.array([ek[i, 0, 0].potential for i in range(14, 27)])
+        np.testing.assert_allclose(np.diff(phi),
+                                   expected_force * agrid, rtol=2e-2)
+
+        # Scheme cannot be changed after initialisation
+        with self.assertRaises(RuntimeError):
+            ek._params.update({'electrostatics_scheme': 'fft'})
+            ek._set_params_in_es_core()
+
+
+if __name__ == "__main__":
+    ut.main()
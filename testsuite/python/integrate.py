@@ -18,7 +18,9 @@
 #
 import espressomd
 import numpy as np
+import itertools
 import unittest as ut
+import unittest_decorators as utx
 
 
 class Integrate(ut.TestCase):
@@ -29,8 +31,16 @@ class Integrate(ut.TestCase):
 
     """
 
+    system = espressomd.System(box_l=[10.0, 10.0, 10.0])
+
+    def tearDown(self):
+        self.system.part.clear()
+        self.system.integrator.verlet_drift_tolerance = 0.
+        if espressomd.has_features("LENNARD_JONES"):
+            self.system.non_bonded_inter[0, 0].lennard_jones.deactivate()
+
     def test(self):
-        system = espressomd.System(box_l=[10.0, 10.0, 10.0])
+        system = self.system
         system.cell_system.skin = 0
 
         # Newton's 1st law with time step change on the way
@@ -69,6 +79,47 @@ class Integrate(ut.TestCase):
                     0.5 * ext_force / p.mass * (i * system.time_step)**2 + v * i * system.time_step), atol=1E-12)
                 system.integrator.run(1)
 
+    @utx.skipIfMissingFeatures("LENNARD_JONES")
+    def test_verlet_drift_watchdog(self):
+        """
+        Checks the energy conservation watchdog on an NVE Lennard-Jones
+        fluid: the incremental drift estimate stays close to the measured
+        change in total energy, and exceeding the tolerance raises an
+        error during integration.
+
+        """
+        system = self.system
+        system.time_step = 0.01
+        system.cell_system.skin = 0.4
+        system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1., sigma=1., cutoff=2.5, shift="auto")
+        np.random.seed(seed=42)
+        spacing = np.arange(0.5, 10., 1.6)
+        pos = list(itertools.product(spacing, repeat=3))
+        system.part.add(pos=pos, v=np.random.normal(0., 0.1, (len(pos), 3)))
+
+        # watchdog is off by default
+        self.assertEqual(system.integrator.verlet_drift_tolerance, 0.)
+        with self.assertRaisesRegex(ValueError, "verlet_drift_tolerance must be >= 0"):
+            system.integrator.verlet_drift_tolerance = -1.
+
+        # the drift estimate tracks the measured total energy change
+        system.integrator.verlet_drift_tolerance = 10.
+        energy_old = system.analysis.energy()["total"]
+        system.integrator.run(200)
+        energy_new = system.analysis.energy()["total"]
+        drift = system.integrator.get_verlet_drift()
+        np.testing.assert_allclose(drift, energy_new - energy_old, atol=0.05)
+
+        # the accumulation can be restarted
+        system.integrator.reset_verlet_drift()
+        self.assertEqual(system.integrator.get_verlet_drift(), 0.)
+
+        # exceeding the tolerance stops the integration with an error
+        system.integrator.verlet_drift_tolerance = 1e-20
+        with self.assertRaisesRegex(Exception, "energy drift estimate .* exceeds the tolerance"):
+            system.integrator.run(20)
+
 
 if __name__ == '__main__':
     ut.main()
@@ -55,6 +55,28 @@ class IntegratorNPT(ut.TestCase):
         with self.assertRaises(Exception):
             self.system.integrator.set_isotropic_npt(
                 ext_pressure=1, piston=1, direction=[True, False])
+        with self.assertRaises(RuntimeError):
+            self.system.integrator.set_isotropic_npt(
+                ext_pressure=1, piston=1, cubic_box=True, directional=True)
+
+    def test_directional_npt(self):
+        # with one piston per direction the box lengths fluctuate
+        # independently while the volume stays bounded
+        system = self.system
+        np.random.seed(42)
+        system.box_l = [6] * 3
+        system.part.add(pos=np.random.uniform(0, system.box_l[0], (11, 3)))
+        system.non_bonded_inter[0, 0].lennard_jones.set_params(
+            epsilon=1, sigma=1, cutoff=2**(1 / 6), shift=0.25)
+        system.thermostat.set_npt(kT=1.0, gamma0=2, gammav=0.04, seed=42)
+        system.integrator.set_isotropic_npt(
+            ext_pressure=0.01, piston=0.001, directional=True)
+        params = system.integrator.get_params()['integrator'].get_params()
+        self.assertTrue(params['directional'])
+        system.integrator.run(500)
+        box_l = np.copy(system.box_l)
+        assert np.all(box_l < 20.), "NpT simulation is unstable"
+        self.assertGreater(np.ptp(box_l), 1e-4)
 
     def test_00_integrator_recovery(self):
         # the system is still in a valid state after a failure
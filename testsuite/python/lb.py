@@ -175,6 +175,10 @@ class TestLB:
             lbf.ext_force_density = [1, 1, 1]
         with self.assertRaises(RuntimeError):
             lbf.get_interpolated_velocity([0, 0, 0])
+        with self.assertRaises(RuntimeError):
+            lbf.store_population_snapshot()
+        with self.assertRaises(RuntimeError):
+            lbf.restore_population_snapshot()
 
         # check exceptions from LB node
         self.system.actors.add(lbf)
@@ -465,12 +469,65 @@ class TestLBCPU(TestLB, ut.TestCase):
     lb_class = espressomd.lb.LBFluid
     atol = 1e-10
 
+    @utx.skipIfMissingFeatures("EXTERNAL_FORCES")
+    def test_population_snapshot(self):
+        """
+        Checks that the in-memory population snapshot restores the fluid
+        to the exact state it was stored in after further integration.
+
+        """
+        lbf = self.lb_class(
+            visc=self.params['viscosity'],
+            dens=self.params['dens'],
+            agrid=self.params['agrid'],
+            tau=self.system.time_step,
+            ext_force_density=[0.01, 0.02, 0.03],
+            kT=0.)
+        self.system.actors.add(lbf)
+        self.system.integrator.run(5)
+        pop_ref = np.array([np.copy(n.population) for n in lbf.nodes()])
+        lbf.store_population_snapshot()
+        # perturb the fluid
+        self.system.integrator.run(5)
+        pop_perturbed = np.array([np.copy(n.population)
+                                  for n in lbf.nodes()])
+        self.assertGreater(np.max(np.abs(pop_perturbed - pop_ref)), 1e-6)
+        # roll the fluid back
+        lbf.restore_population_snapshot()
+        pop_restored = np.array([np.copy(n.population)
+                                 for n in lbf.nodes()])
+        np.testing.assert_array_equal(pop_restored, pop_ref)
+        # a snapshot taken with a different lattice cannot be restored
+        self.system.actors.clear()
+        lbf = self.lb_class(
+            visc=self.params['viscosity'],
+            dens=self.params['dens'],
+            agrid=2. * self.params['agrid'],
+            tau=self.system.time_step,
+            kT=0.)
+        self.system.actors.add(lbf)
+        with self.assertRaises(Exception):
+            lbf.restore_population_snapshot()
+
 
 @utx.skipIfMissingGPU()
 class TestLBGPU(TestLB, ut.TestCase):
     lb_class = espressomd.lb.LBFluidGPU
     atol = 1e-7
 
+    def test_population_snapshot_not_implemented(self):
+        lbf = self.lb_class(
+            visc=self.params['viscosity'],
+            dens=self.params['dens'],
+            agrid=self.params['agrid'],
+            tau=self.system.time_step,
+            kT=0.)
+        self.system.actors.add(lbf)
+        with self.assertRaises(RuntimeError):
+            lbf.store_population_snapshot()
+        with self.assertRaises(RuntimeError):
+            lbf.restore_population_snapshot()
+
     @utx.skipIfMissingFeatures("EXTERNAL_FORCES")
     def test_viscous_coupling_higher_order_interpolation(self):
         self.interpolation = True
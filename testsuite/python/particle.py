@@ -417,6 +417,53 @@ class ParticleProperties(ut.TestCase):
             # Cause a different mpi callback to uncover deadlock immediately
             _ = getattr(partcls, attr)
 
+    def test_batch_particle_creation(self):
+        """
+        Check that creating several particles at once gives the same
+        particle state as creating them one at a time.
+        """
+        system = self.system
+        system.part.clear()
+        np.random.seed(seed=42)
+        n_parts = 10
+        pos = system.box_l * np.random.random((n_parts, 3))
+        v = np.random.random((n_parts, 3)) - 0.5
+        types = np.random.randint(0, 4, n_parts)
+        bonds = n_parts * [[]]
+        bonds[4] = [(self.f1, 2)]
+        bonds[7] = [(self.f1, 0), (self.f2, 5)]
+
+        attrs = ["id", "pos", "v", "f", "type", "mol_id"]
+        if espressomd.has_features("MASS"):
+            attrs.append("mass")
+        if espressomd.has_features("ELECTROSTATICS"):
+            attrs.append("q")
+
+        for i in range(n_parts):
+            system.part.add(pos=pos[i], v=v[i], type=types[i], bonds=bonds[i])
+        reference = [{attr: getattr(p, attr) for attr in attrs + ["bonds"]}
+                     for p in system.part]
+        system.part.clear()
+
+        partcls = system.part.add(pos=pos, v=v, type=types, bonds=bonds)
+        self.assertEqual(len(partcls.id), n_parts)
+        for p, p_ref in zip(system.part, reference):
+            for attr in attrs:
+                np.testing.assert_array_equal(
+                    np.copy(getattr(p, attr)), np.copy(p_ref[attr]),
+                    err_msg=f"attribute '{attr}' differs")
+            self.assertEqual(p.bonds, p_ref["bonds"])
+
+        # ids already taken cannot be reused in a batch
+        free_id = system.part.highest_particle_id + 1
+        with self.assertRaisesRegex(ValueError, "Particle 0 already exists"):
+            system.part.add(pos=np.zeros((2, 3)), id=[free_id, 0])
+        # a batch cannot contain duplicate ids
+        with self.assertRaisesRegex(ValueError, f"Particle {free_id} already exists"):
+            system.part.add(pos=np.zeros((2, 3)), id=2 * [free_id])
+        # a failed batch does not create any particle
+        self.assertEqual(system.part.highest_particle_id + 1, free_id)
+
     def test_remove_particle(self):
         """Tests that if a particle is removed,
         it no longer exists and bonds to the removed particle are
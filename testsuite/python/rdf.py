@@ -102,6 +102,26 @@ class RdfTest(ut.TestCase):
 
         np.testing.assert_allclose(rdf10, rdf01)
 
+    def test_overlapping_sets(self):
+        """
+        An RDF between two identical particle sets must match the
+        single-set RDF: each pair is counted twice, and the count of
+        ``N**2 - N`` sampled pairs excludes the self-pairs.
+        """
+        system = self.system
+        np.random.seed(seed=42)
+        n_part = 100
+        system.part.add(pos=np.random.random((n_part, 3)) * system.box_l)
+        pids = system.part.all().id
+        # cover both the cell-binning regime and the all-pairs fallback
+        for r_max in [2.5, 5.0]:
+            params = {'min_r': 0., 'max_r': r_max, 'n_r_bins': 25}
+            rdf_single = espressomd.observables.RDF(
+                ids1=pids, **params).calculate()
+            rdf_both = espressomd.observables.RDF(
+                ids1=pids, ids2=pids, **params).calculate()
+            np.testing.assert_allclose(rdf_both, rdf_single, rtol=1e-12)
+
     def test_rdf_interface(self):
         # test setters and getters
         system = self.system
@@ -147,6 +147,37 @@ class VirtualSites(ut.TestCase):
         self.system.integrator.run(1)
         self.assertAlmostEqual(np.dot(p1.director, p2.director), 0.0)
 
+    @utx.skipIfMissingFeatures(["MASS", "ROTATIONAL_INERTIA"])
+    def test_setup_rigid_body(self):
+        import espressomd.rotation
+        self.system.time_step = 0.01
+        self.system.min_global_cut = 2.0
+        self.system.virtual_sites = espressomd.virtual_sites.VirtualSitesRelative()
+        # asymmetric rigid cluster
+        positions = np.array([[1., 0., 0.], [-1., 0., 0.],
+                              [0., 2., 0.], [0., -2., 0.]]) + 5.
+        masses = [1., 1., 2., 2.]
+        sites = [self.system.part.add(pos=pos, mass=mass)
+                 for pos, mass in zip(positions, masses)]
+        center = espressomd.rotation.setup_rigid_body(self.system, sites)
+
+        com = np.average(positions, axis=0, weights=masses)
+        moments, _ = espressomd.rotation.diagonalized_inertia_tensor(
+            positions, masses)
+        np.testing.assert_allclose(np.copy(center.pos), com)
+        self.assertAlmostEqual(center.mass, np.sum(masses))
+        np.testing.assert_allclose(np.copy(center.rinertia), moments)
+        for p in sites:
+            self.assertTrue(p.virtual)
+
+        # the body must rotate as a whole around its center
+        center.omega_lab = [0., 0., 2.]
+        distances = [self.system.distance(center, p) for p in sites]
+        self.system.integrator.run(100)
+        for p, dist in zip(sites, distances):
+            self.assertAlmostEqual(self.system.distance(center, p), dist,
+                                   places=6)
+
     def test_vs_exceptions(self):
         system = self.system
         system.virtual_sites = espressomd.virtual_sites.VirtualSitesRelative()